@@ -20,6 +20,7 @@ STATIC_MEMORY(CoreInput,           Core::Input)
 STATIC_MEMORY(CorePlatform,        Core::Platform)
 STATIC_MEMORY(CoreDebug,           Core::Debug)
 STATIC_MEMORY(coreMemoryManager,   Core::Manager::Memory)
+STATIC_MEMORY(coreJobManager,      Core::Manager::Job)
 STATIC_MEMORY(coreResourceManager, Core::Manager::Resource)
 STATIC_MEMORY(coreObjectManager,   Core::Manager::Object)
 STATIC_MEMORY(CoreApp,             Core::Application)
@@ -57,6 +58,7 @@ Core::Core()noexcept
     // init managers
     Log->Header("Other");
     STATIC_NEW(Manager::Memory)
+    STATIC_NEW(Manager::Job)
     STATIC_NEW(Manager::Resource)
     STATIC_NEW(Manager::Object)
 
@@ -100,6 +102,7 @@ Core::~Core()
     // delete managers
     STATIC_DELETE(Manager::Object)
     STATIC_DELETE(Manager::Resource)
+    STATIC_DELETE(Manager::Job)
     STATIC_DELETE(Manager::Memory)
 
     // delete main components
@@ -231,9 +234,6 @@ coreInt32 SDLCALL coreMain(coreInt32 argc, coreChar** argv)
     coreMath::EnableRoundToNearest();
     coreMath::DisableDenormals();
 
-    // initialize temp-storage
-    coreTempStorageInit(0u);
-
     // run unit tests
     const coreStatus eStatusTest = Core::__RunTest();
     if(eStatusTest != CORE_BUSY) return eStatusTest;
@@ -322,6 +322,9 @@ coreStatus Core::__RunEngine()
 
         // unload all unreferenced resources
         Manager::Resource->ApplyNullify();
+
+        // reset the shared frame memory-arena
+        coreFrameArena()->Reset();
     }
 
 #if defined(_CORE_EMSCRIPTEN_)
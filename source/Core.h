@@ -377,6 +377,7 @@
 #include <AL/alext.h>
 #include <AL/efx-presets.h>
 #include <zstd/zstd.h>
+#include <zstd/zdict.h>
 #include <opus/opusfile.h>
 
 
@@ -695,13 +696,15 @@ enum coreStatus : coreInt8
 class  coreMatrix2;
 class  coreMatrix3;
 class  coreMatrix4;
-class  coreString;
 class  coreArchive;
+class  coreReadQueue;
 class  coreObject2D;
 class  coreObject3D;
 class  coreParticleEffect;
 struct coreTextureSpec;
 template <typename T> class coreResourcePtr;
+template <typename M> class coreStringAlloc;
+using coreString = coreStringAlloc<std::allocator<coreChar>>;
 
 class  coreLog;
 class  coreConfig;
@@ -715,6 +718,7 @@ class  CoreInput;
 class  CorePlatform;
 class  CoreDebug;
 class  coreMemoryManager;
+class  coreJobManager;
 class  coreResourceManager;
 class  coreObjectManager;
 
@@ -811,6 +815,7 @@ public:
     struct INTERFACE Manager final
     {
         static coreMemoryManager*   const Memory;     // memory manager
+        static coreJobManager*      const Job;        // job manager
         static coreResourceManager* const Resource;   // resource manager
         static coreObjectManager*   const Object;     // object manager
     };
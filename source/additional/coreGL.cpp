@@ -164,6 +164,7 @@ void __coreInitOpenGL()
         __IMPROVE(GLEW_ARB_depth_buffer_float,               GLEW_VERSION_3_0)
         __IMPROVE(GLEW_ARB_depth_clamp,                      GLEW_VERSION_3_2 || GLEW_NV_depth_clamp)
         __IMPROVE(GLEW_ARB_direct_state_access,              GLEW_VERSION_4_5)
+        __IMPROVE(GLEW_ARB_draw_elements_base_vertex,        GLEW_VERSION_3_2)
         __IMPROVE(GLEW_ARB_enhanced_layouts,                 GLEW_VERSION_4_4)                                             // shader extension
         __IMPROVE(GLEW_ARB_framebuffer_sRGB,                 GLEW_VERSION_3_0 || GLEW_EXT_framebuffer_sRGB)
         __IMPROVE(GLEW_ARB_geometry_shader4,                 GLEW_VERSION_3_2 || GLEW_EXT_geometry_shader4)
@@ -309,6 +309,19 @@ void __coreInitOpenGLES()
     if(g_sExtensions.contains("GL_ANGLE_depth_texture ")) g_ContextGLES.__GL_OES_depth_texture = true;
     if(g_sExtensions.contains("GL_WEBGL_depth_texture ")) g_ContextGLES.__GL_OES_depth_texture = true;
 
+    // implement GL_OES_draw_elements_base_vertex
+    if(__CORE_GLES_CHECK(GL_OES_draw_elements_base_vertex, bES32))
+    {
+        __CORE_GLES_FETCH(glDrawRangeElementsBaseVertex,     OES, bES32)
+        __CORE_GLES_FETCH(glDrawElementsInstancedBaseVertex, OES, bES32)
+    }
+    else if(g_sExtensions.contains("GL_EXT_draw_elements_base_vertex "))
+    {
+        g_ContextGLES.__GL_OES_draw_elements_base_vertex = true;
+        __CORE_GLES_FETCH(glDrawRangeElementsBaseVertex,     EXT, false)
+        __CORE_GLES_FETCH(glDrawElementsInstancedBaseVertex, EXT, false)
+    }
+
     // implement GL_OES_geometry_shader
     __CORE_GLES_CHECK(GL_OES_geometry_shader, bES32 || bAndroidPack);
     if(g_sExtensions.contains("GL_EXT_geometry_shader ")) g_ContextGLES.__GL_OES_geometry_shader = true;
@@ -359,6 +359,16 @@ using PFNGLCOPYIMAGESUBDATAPROC = void (GL_APIENTRY *) (GLuint srcName, GLenum s
 #define CORE_GL_ARB_depth_texture (__CORE_GLES_VAR(GL_OES_depth_texture))
 
 
+// ****************************************************************
+/* GL_OES_draw_elements_base_vertex (mapped on GL_ARB_draw_elements_base_vertex) */
+#define CORE_GL_ARB_draw_elements_base_vertex (__CORE_GLES_VAR(GL_OES_draw_elements_base_vertex) && __CORE_GLES_VAR(bES30) && !DEFINED(_CORE_EMSCRIPTEN_))
+
+using PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC     = void (GL_APIENTRY *) (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices, GLint basevertex);
+using PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC = void (GL_APIENTRY *) (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex);
+#define glDrawRangeElementsBaseVertex     __CORE_GLES_FUNC(glDrawRangeElementsBaseVertex)
+#define glDrawElementsInstancedBaseVertex __CORE_GLES_FUNC(glDrawElementsInstancedBaseVertex)
+
+
 // ****************************************************************
 /* GL_OES_geometry_shader (mapped on GL_ARB_geometry_shader4) */
 #define CORE_GL_ARB_geometry_shader4 (__CORE_GLES_VAR(GL_OES_geometry_shader) && !DEFINED(_CORE_EMSCRIPTEN_))
@@ -569,6 +579,7 @@ struct coreContextGLES final
     coreBool __GL_NV_pixel_buffer_object;
     coreBool __GL_OES_copy_image;
     coreBool __GL_OES_depth_texture;
+    coreBool __GL_OES_draw_elements_base_vertex;
     coreBool __GL_OES_geometry_shader;
     coreBool __GL_OES_get_program_binary;
     coreBool __GL_OES_packed_depth_stencil;
@@ -610,6 +621,8 @@ struct coreContextGLES final
     PFNGLBLITFRAMEBUFFERPROC                        __glBlitFramebuffer;
     PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC         __glRenderbufferStorageMultisample;
     PFNGLCOPYIMAGESUBDATAPROC                       __glCopyImageSubData;
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC            __glDrawRangeElementsBaseVertex;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC        __glDrawElementsInstancedBaseVertex;
     PFNGLGETPROGRAMBINARYPROC                       __glGetProgramBinary;
     PFNGLPROGRAMBINARYPROC                          __glProgramBinary;
     PFNGLMINSAMPLESHADINGPROC                       __glMinSampleShading;
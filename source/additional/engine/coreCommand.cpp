@@ -23,8 +23,11 @@ coreStatus Core::__RunCommand()
         // init log file
         STATIC_NEW(Log, coreData::UserFolderShared("log.html"))
 
+        // init job manager (for parallel compression)
+        STATIC_NEW(Manager::Job)
+
         // automatically shut down everything on exit
-        WARN_IF(std::atexit([]() {STATIC_DELETE(Log) SDL_Quit();})) {}
+        WARN_IF(std::atexit([]() {STATIC_DELETE(Manager::Job) STATIC_DELETE(Log) SDL_Quit();})) {}
     };
 
     // return available arguments
@@ -39,11 +42,17 @@ coreStatus Core::__RunCommand()
         std::puts("  --config-override <value>    override config values (e.g. \"Base.AsyncMode:false;System.Width:1024\")");
         std::puts("  --input <value>              input file or directory for some commands");
         std::puts("  --output <value>             output file or directory for some commands");
+        std::puts("  --level <value>              compression level for some commands (0 = no compression)");
+        std::puts("  --dictionary <value>         dictionary size in KB for compressing small files (0 = no dictionary)");
+        std::puts("  --threads <value>            number of threads for some commands (0 = all cores)");
+        std::puts("  --format <value>             texture format for cooking (dxt, fast, bc7, raw)");
+        std::puts("  --mipmap <value>             mipmap filter for cooking (box, kaiser, lanczos)");
         std::puts("");
         std::puts("Commands:");
         std::puts("  --compress                   compress <input> file");
         std::puts("  --decompress                 decompress <input> file");
         std::puts("  --pack                       pack <input> directory into <output> file archive");
+        std::puts("  --cook                       cook <input> image/model file or directory into <output> (GPU-ready resources)");
         std::puts("  --record                     record <output> replay");
         std::puts("  --playback                   play back <input> replay");
         std::puts("  --help                       display available arguments");
@@ -198,6 +207,15 @@ coreStatus Core::__RunCommand()
         // cut off common path
         const coreUintW iLen = coreStrLen(pcInput) + 1u;
 
+        // retrieve optional command options
+        const coreChar* pcLevel      = coreData::GetCommandLine("level");
+        const coreChar* pcDictionary = coreData::GetCommandLine("dictionary");
+        const coreChar* pcThreads    = coreData::GetCommandLine("threads");
+
+        const coreInt32  iLevel    = pcLevel      ? CLAMP(coreData::FromChars<coreInt32>(pcLevel, coreStrLen(pcLevel)), 0, ZSTD_maxCLevel()) : ZSTD_maxCLevel();
+        const coreUint32 iDictSize = pcDictionary ? MIN(coreData::FromChars<coreUint32>(pcDictionary, coreStrLen(pcDictionary)), 1024u) * 1024u : 0u;
+        const coreUintW  iThreads  = pcThreads    ? coreData::FromChars<coreUint32>(pcThreads, coreStrLen(pcThreads)) : 0u;
+
         // add all files to the archive
         coreArchive oArchive;
         FOR_EACH(it, asFileList)
@@ -205,8 +223,8 @@ coreStatus Core::__RunCommand()
             oArchive.AddFile(it->c_str(), it->c_str() + iLen);
         }
 
-        // save output file
-        if(oArchive.Save(pcOutput) != CORE_OK)
+        // save output file (output does not depend on the number of threads)
+        if(oArchive.Save(pcOutput, iLevel, iDictSize, iThreads) != CORE_OK)
         {
             std::printf("Archive (%s) could not be saved\n", pcOutput);
             return CORE_ERROR_FILE;
@@ -216,6 +234,137 @@ coreStatus Core::__RunCommand()
         return CORE_OK;
     }
 
+    // cook textures and models
+    if(coreData::GetCommandLine("cook"))
+    {
+        // handle required components
+        nSetupFunc();
+
+        // retrieve command options
+        const coreChar* pcInput  = coreData::GetCommandLine("input");
+        const coreChar* pcOutput = coreData::GetCommandLine("output");
+        if(!pcInput || !pcOutput)
+        {
+            std::puts("<input> or <output> parameter missing or invalid");
+            return CORE_INVALID_DATA;
+        }
+
+        // retrieve optional command options
+        const coreChar* pcFormat = coreData::GetCommandLine("format");
+        const coreChar* pcMipmap = coreData::GetCommandLine("mipmap");
+
+        const coreTextureCook   eCook   = (!pcFormat || !coreStrCmp(pcFormat, "dxt"))    ? CORE_TEXTURE_COOK_DXT      : !coreStrCmp(pcFormat, "fast") ? CORE_TEXTURE_COOK_DXT_FAST : !coreStrCmp(pcFormat, "bc7") ? CORE_TEXTURE_COOK_BC7      : CORE_TEXTURE_COOK_RAW;
+        const coreTextureMipmap eMipmap = (!pcMipmap || !coreStrCmp(pcMipmap, "kaiser")) ? CORE_TEXTURE_MIPMAP_KAISER : !coreStrCmp(pcMipmap, "box")  ? CORE_TEXTURE_MIPMAP_BOX    :                                   CORE_TEXTURE_MIPMAP_LANCZOS;
+
+        const auto nCookTextureFunc = [&](coreFile* pFile, coreUint32* OUTPUT piSize) -> coreByte*
+        {
+            // decode image file
+            coreSurfaceScope pSurface = IMG_LoadTyped_IO(pFile->CreateReadStream(), true, coreData::StrExtension(pFile->GetPath()));
+            if(!pSurface || !pSurface->w || !pSurface->h) return NULL;
+
+            // convert from unsupported format
+            if(SDL_ISPIXELFORMAT_INDEXED(pSurface->format) || (SDL_BYTESPERPIXEL(pSurface->format) > 4u))
+            {
+                pSurface = SDL_ConvertSurface(pSurface, SDL_PIXELFORMAT_RGBA32);
+            }
+
+            const coreUintW iComponents = SDL_BYTESPERPIXEL(pSurface->format);
+            const coreUintW iRowSize    = pSurface->w * iComponents;
+
+            // remove row padding
+            const coreByte* pPixels = s_cast<const coreByte*>(pSurface->pixels);
+            coreByte*       pPacked = NULL;
+            if(coreUintW(pSurface->pitch) != iRowSize)
+            {
+                pPacked = TEMP_NEW(coreByte, iRowSize * pSurface->h);
+                for(coreUintW i = 0u, ie = pSurface->h; i < ie; ++i) std::memcpy(pPacked + i * iRowSize, pPixels + i * pSurface->pitch, iRowSize);
+                pPixels = pPacked;
+            }
+
+            // create GPU-ready texture data
+            coreByte* pData = coreTexture::CreateCooked(pSurface->w, pSurface->h, iComponents, pPixels, eCook, eMipmap, piSize);
+
+            TEMP_DELETE(pPacked)
+            return pData;
+        };
+
+        const auto nCookModelFunc = [](coreFile* pFile, coreUint32* OUTPUT piSize) -> coreByte*
+        {
+            // import model file
+            coreModel::coreImport oImport;
+            if(coreModel::Import(pFile, &oImport) != CORE_OK) return NULL;
+
+            // create optimized and packed model data (always with clusters)
+            return coreModel::CreateCooked(&oImport, true, piSize);
+        };
+
+        const auto nCookFunc = [&](const coreChar* pcFrom, const coreChar* pcTo)
+        {
+            // open input file
+            coreFile oFile(pcFrom);
+            if(!oFile.GetSize())
+            {
+                std::printf("File (%s) could not be opened\n", pcFrom);
+                return false;
+            }
+
+            // select resource type by file extension
+            const coreChar* pcExtension = coreData::StrToLower(coreData::StrExtension(pcFrom));
+            const coreBool  bModel      = !std::memcmp(pcExtension, "md5", 3u) || !std::memcmp(pcExtension, "md3", 3u);
+
+            // process resource
+            coreUint32 iSize;
+            coreByte*  pData = bModel ? nCookModelFunc(&oFile, &iSize) : nCookTextureFunc(&oFile, &iSize);
+            if(!pData)
+            {
+                std::printf("File (%s) is not a valid %s\n", pcFrom, bModel ? "model" : "image");
+                return false;
+            }
+
+            // save output file (takes ownership of the data)
+            coreFile oCooked(pcTo, pData, iSize);
+            if(oCooked.Save() != CORE_OK)
+            {
+                std::printf("File (%s) could not be saved\n", pcTo);
+                return false;
+            }
+
+            return true;
+        };
+
+        if(coreData::DirectoryExists(pcInput))
+        {
+            // scan input directory
+            coreList<coreString> asFileList;
+            if(coreData::DirectoryScanTree(pcInput, "*", &asFileList) != CORE_OK)
+            {
+                std::printf("Directory (%s) could not be scanned\n", pcInput);
+                return CORE_ERROR_FILE;
+            }
+
+            // cut off common path
+            const coreUintW iLen = coreStrLen(pcInput) + 1u;
+
+            // cook all images and models (keep names, cooked resources are detected by their content)
+            coreUintW iCount = 0u;
+            FOR_EACH(it, asFileList)
+            {
+                if(nCookFunc(it->c_str(), coreString(PRINT("%s/%s", pcOutput, it->c_str() + iLen)).c_str())) ++iCount;
+            }
+
+            std::printf("Directory (%s, %zu of %zu files) cooked into directory (%s)\n", pcInput, iCount, asFileList.size(), pcOutput);
+        }
+        else
+        {
+            // cook single image or model
+            if(!nCookFunc(pcInput, pcOutput)) return CORE_ERROR_FILE;
+
+            std::printf("File (%s, %.1f KB -> %.1f KB) cooked\n", pcInput, I_TO_F(coreData::FileSize(pcInput)) / 1024.0f, I_TO_F(coreData::FileSize(pcOutput)) / 1024.0f);
+        }
+
+        return CORE_OK;
+    }
+
     // unpack archive (hidden command)
     if(coreData::GetCommandLine("unpack"))
     {
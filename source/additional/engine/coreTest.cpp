@@ -29,6 +29,52 @@ extern "C" const coreChar* const* g_ppcArgv;
 /* unit tests */
 DOCTEST_TEST_CASE("Unit Tests")
 {
+    DOCTEST_SUBCASE("coreArena")
+    {
+        DOCTEST_SUBCASE("Rewind/Reset")
+        {
+            coreArena oArena(0x1000u);
+
+            const void* pFirst = oArena.Allocate(100u, 16u);
+            DOCTEST_CHECK(coreMath::IsAligned(P_TO_UI(pFirst), 16u));
+
+            const coreArena::coreMarker oMarker = oArena.GetMarker();
+            const coreUintW             iUsed   = oArena.GetUsed();
+
+            DOCTEST_CHECK(coreMath::IsAligned(P_TO_UI(oArena.Allocate(0x2000u, 64u)), 64u));
+            DOCTEST_CHECK(oArena.GetNumPages()     == 2u);
+            DOCTEST_CHECK(oArena.GetNumOverflows() == 1u);
+
+            oArena.Rewind(oMarker);
+            DOCTEST_CHECK(oArena.GetNumPages() == 1u);
+            DOCTEST_CHECK(oArena.GetUsed()     == iUsed);
+
+            oArena.Reset();
+            oArena.Allocate(0x2000u, 64u);
+            DOCTEST_CHECK(oArena.GetNumPages()     == 1u);
+            DOCTEST_CHECK(oArena.GetNumOverflows() == 0u);
+        }
+
+        DOCTEST_SUBCASE("coreArenaAllocator")
+        {
+            coreArena oArena(0x1000u);
+            {
+                const coreArenaScope oScope(&oArena);
+
+                coreArenaList<coreUint32> aiList {coreArenaAllocator<coreUint32>(&oArena)};
+                for(coreUintW i = 0u; i < 1000u; ++i) aiList.push_back(i);
+
+                coreArenaString sString {coreArenaAllocator<coreChar>(&oArena)};
+                for(coreUintW i = 0u; i < 100u; ++i) sString += "trans";
+
+                DOCTEST_CHECK(aiList.size()  == 1000u);
+                DOCTEST_CHECK(aiList.back()  == 999u);
+                DOCTEST_CHECK(sString.size() == 500u);
+            }
+            DOCTEST_CHECK(oArena.GetUsed() == 0u);
+        }
+    }
+
     DOCTEST_SUBCASE("coreData")
     {
         DOCTEST_SUBCASE("Compress/Decompress")
@@ -50,6 +96,29 @@ DOCTEST_TEST_CASE("Unit Tests")
             SAFE_DELETE_ARRAY(pDecompress)
         }
 
+        DOCTEST_SUBCASE("CompressStream/DecompressStream")
+        {
+            const coreByte acData[] = "trans rights are human rights";
+
+            SDL_IOStream* pInput    = SDL_IOFromConstMem(acData, sizeof(acData));
+            SDL_IOStream* pCompress = SDL_IOFromDynamicMem();
+            DOCTEST_CHECK(coreData::CompressStream(pInput, pCompress) == CORE_OK);
+
+            SDL_IOStream* pDecompress = SDL_IOFromDynamicMem();
+            SDL_SeekIO(pCompress, 0, SDL_IO_SEEK_SET);
+            DOCTEST_CHECK(coreData::DecompressStream(pCompress, pDecompress) == CORE_OK);
+
+            coreByte acResult[sizeof(acData)] = {};
+            SDL_SeekIO(pDecompress, 0, SDL_IO_SEEK_SET);
+            DOCTEST_CHECK(coreUintW(SDL_GetIOSize(pDecompress)) == sizeof(acData));
+            DOCTEST_CHECK(SDL_ReadIO(pDecompress, acResult, sizeof(acResult)) == sizeof(acResult));
+            DOCTEST_CHECK(!std::memcmp(acResult, "trans rights are human rights", sizeof(acResult)));
+
+            SDL_CloseIO(pInput);
+            SDL_CloseIO(pCompress);
+            SDL_CloseIO(pDecompress);
+        }
+
         DOCTEST_SUBCASE("Scramble/Unscramble")
         {
             coreByte acData[] = "be gay, do crime";
@@ -72,6 +141,115 @@ DOCTEST_TEST_CASE("Unit Tests")
         }
     }
 
+    DOCTEST_SUBCASE("coreHashMap")
+    {
+        DOCTEST_SUBCASE("Emplace/Erase")
+        {
+            coreHashMap<coreUint32, coreUint32> aiMap;
+            for(coreUint32 i = 0u; i < 1000u; ++i) aiMap.emplace(i * 7u, i);
+
+            for(coreUint32 i = 0u; i < 1000u; i += 2u) DOCTEST_CHECK(aiMap.erase(i * 7u));
+            DOCTEST_CHECK(!aiMap.erase(7000u));
+            DOCTEST_CHECK(aiMap.size() == 500u);
+
+            for(coreUint32 i = 0u; i < 1000u; ++i)
+            {
+                DOCTEST_CHECK(aiMap.count(i * 7u) == coreBool(i & 0x01u));
+                if(i & 0x01u) DOCTEST_CHECK(aiMap.at(i * 7u) == i);
+            }
+
+            aiMap.sort_asc();
+            DOCTEST_CHECK(std::is_sorted(aiMap.get_keylist().begin(), aiMap.get_keylist().end()));
+            DOCTEST_CHECK(aiMap.at(7u) == 1u);
+        }
+
+        DOCTEST_SUBCASE("coreHashString")
+        {
+            coreHashMapStr<coreUint32> aiMap;
+            aiMap["trans"]  = 1u;
+            aiMap["rights"] = 2u;
+
+            DOCTEST_CHECK(aiMap.at("rights") == 2u);
+            DOCTEST_CHECK(aiMap.index("trans") == 0u);
+            DOCTEST_CHECK(!aiMap.count("wrongs"));
+        }
+    }
+
+    DOCTEST_SUBCASE("coreJobManager")
+    {
+        DOCTEST_SUBCASE("Nested")
+        {
+            coreAtomic<coreUint32> iSum = 0u;
+
+            const coreJobFunc nAdd = [](void* pData, const coreUintW iIndex) {s_cast<coreAtomic<coreUint32>*>(pData)->FetchAdd(iIndex);};
+            coreJob aExtra[] = {coreJob(nAdd, &iSum, 1000u), coreJob(nAdd, &iSum, 1000u), coreJob(nAdd, &iSum, 1000u), coreJob(nAdd, &iSum, 1000u)};
+
+            struct coreNested final
+            {
+                coreAtomic<coreUint32>* piSum;
+                coreJob*                pExtra;
+            };
+            coreNested oNested = {&iSum, aExtra};
+
+            // run nested loops on a worker thread, with unrelated jobs queued on top of the remaining outer chunks
+            coreJob oRoot([](void* pData, const coreUintW)
+            {
+                const coreNested* pNested = s_cast<const coreNested*>(pData);
+
+                Core::Manager::Job->ParallelFor(4u, 1u, [&](const coreUintW iFrom, const coreUintW)
+                {
+                    Core::Manager::Job->Run(&pNested->pExtra[iFrom]);
+
+                    Core::Manager::Job->ParallelFor(64u, 8u, [&](const coreUintW iInnerFrom, const coreUintW iInnerTo)
+                    {
+                        pNested->piSum->FetchAdd(iInnerTo - iInnerFrom);
+                    });
+                });
+            },
+            &oNested, 0u);
+
+            Core::Manager::Job->Run(&oRoot);
+            if(Core::Manager::Job->GetNumWorkers()) while(!oRoot.IsFinished()) CORE_LOCK_YIELD   // # do not execute the root job on the current thread
+            Core::Manager::Job->Wait(&oRoot);
+            for(coreUintW i = 0u; i < ARRAY_SIZE(aExtra); ++i) Core::Manager::Job->Wait(&aExtra[i]);
+
+            DOCTEST_CHECK(iSum == 4u * (64u + 1000u));
+        }
+
+        DOCTEST_SUBCASE("ParallelFor")
+        {
+            coreList<coreUint32> aiValue;
+            aiValue.resize(10000u, 0u);
+
+            Core::Manager::Job->ParallelFor(aiValue.size(), 64u, [&](const coreUintW iFrom, const coreUintW iTo)
+            {
+                for(coreUintW i = iFrom; i < iTo; ++i) aiValue[i] += i;
+            });
+
+            coreBool bValid = true;
+            for(coreUintW i = 0u, ie = aiValue.size(); i < ie; ++i) bValid = bValid && (aiValue[i] == i);
+            DOCTEST_CHECK(bValid);
+        }
+
+        DOCTEST_SUBCASE("Parent/Child")
+        {
+            coreAtomic<coreUint32> iSum = 0u;
+
+            coreJob oParent(NULL, NULL, 0u);
+            coreJob oChild1([](void* pData, const coreUintW iIndex) {s_cast<coreAtomic<coreUint32>*>(pData)->FetchAdd(iIndex);}, &iSum, 1u, &oParent);
+            coreJob oChild2([](void* pData, const coreUintW iIndex) {s_cast<coreAtomic<coreUint32>*>(pData)->FetchAdd(iIndex);}, &iSum, 2u, &oParent);
+
+            Core::Manager::Job->Run(&oChild1);
+            Core::Manager::Job->Run(&oChild2);
+            Core::Manager::Job->Run(&oParent);
+            Core::Manager::Job->Wait(&oParent);
+
+            DOCTEST_CHECK(oChild1.IsFinished());
+            DOCTEST_CHECK(oChild2.IsFinished());
+            DOCTEST_CHECK(iSum == 3u);
+        }
+    }
+
     DOCTEST_SUBCASE("coreMath")
     {
         DOCTEST_SUBCASE("DivUp")
@@ -82,6 +260,157 @@ DOCTEST_TEST_CASE("Unit Tests")
             DOCTEST_CHECK(coreMath::DivUp(0, 4) == 0);
         }
     }
+
+    DOCTEST_SUBCASE("coreModelArena")
+    {
+        DOCTEST_SUBCASE("TakeRange/ReturnRange")
+        {
+            coreList<coreModelArena::coreRange> aFree;
+            aFree.push_back({0u, 100u});
+
+            coreUint32 aiOffset[4] = {};
+            DOCTEST_CHECK(coreModelArena::TakeRange(&aFree, 10u, &aiOffset[0]));
+            DOCTEST_CHECK(coreModelArena::TakeRange(&aFree, 20u, &aiOffset[1]));
+            DOCTEST_CHECK(coreModelArena::TakeRange(&aFree, 30u, &aiOffset[2]));
+            DOCTEST_CHECK(!coreModelArena::TakeRange(&aFree, 50u, &aiOffset[3]));
+            DOCTEST_CHECK(aiOffset[2] == 30u);
+
+            // return middle range (not adjacent to any free range)
+            coreModelArena::ReturnRange(&aFree, aiOffset[1], 20u);
+            DOCTEST_CHECK(aFree.size() == 2u);
+
+            // return first range (merge with next free range)
+            coreModelArena::ReturnRange(&aFree, aiOffset[0], 10u);
+            DOCTEST_CHECK(aFree.size()     == 2u);
+            DOCTEST_CHECK(aFree[0].iOffset == 0u);
+            DOCTEST_CHECK(aFree[0].iSize   == 30u);
+
+            // return last range (merge with both neighbours)
+            coreModelArena::ReturnRange(&aFree, aiOffset[2], 30u);
+            DOCTEST_CHECK(aFree.size()   == 1u);
+            DOCTEST_CHECK(aFree[0].iSize == 100u);
+        }
+    }
+
+    DOCTEST_SUBCASE("coreStringTable")
+    {
+        DOCTEST_SUBCASE("Intern")
+        {
+            const coreInternString sFirst  = "trans";
+            const coreInternString sSecond = coreHashString("trans");
+            const coreInternString sThird  = "rights";
+
+            DOCTEST_CHECK(sFirst.GetID() == sSecond.GetID());
+            DOCTEST_CHECK(sFirst.GetID() != sThird .GetID());
+            DOCTEST_CHECK(sFirst.GetString() == sSecond.GetString());
+            DOCTEST_CHECK(sFirst.GetHash()   == coreHashString("trans").GetHash());
+            DOCTEST_CHECK(sThird.GetLength() == 6u);
+            DOCTEST_CHECK(!std::strcmp(coreStringTable::GetString(0u), ""));
+        }
+
+        DOCTEST_SUBCASE("coreHashMapIntern")
+        {
+            coreHashMapIntern<coreUint32> aiMap;
+            aiMap["trans"]  = 1u;
+            aiMap["rights"] = 2u;
+
+            DOCTEST_CHECK(aiMap.at("rights") == 2u);
+            DOCTEST_CHECK(aiMap.count(coreInternString("trans")));
+            DOCTEST_CHECK(aiMap.get_keylist().front() == coreInternString("trans").GetID());
+            DOCTEST_CHECK(!aiMap.count("wrongs"));
+        }
+    }
+
+    DOCTEST_SUBCASE("coreTexture")
+    {
+        DOCTEST_SUBCASE("CreateMipmaps")
+        {
+            // non-square chains (intermediate levels do not shrink by a quarter)
+            const coreUintW aaiSize[][3] = {{1u, 16u, 4u}, {2u, 16u, 4u}, {16u, 2u, 4u}};   // (width, height, levels)
+            for(coreUintW i = 0u; i < ARRAY_SIZE(aaiSize); ++i)
+            {
+                const coreUintW iWidth  = aaiSize[i][0];
+                const coreUintW iHeight = aaiSize[i][1];
+                const coreUintW iLevels = aaiSize[i][2];
+
+                coreList<coreByte> aiInput;
+                aiInput.resize(iWidth * iHeight * 2u);
+                for(coreUintW j = 0u, je = aiInput.size(); j < je; j += 2u)
+                {
+                    aiInput[j]      = 200u;
+                    aiInput[j + 1u] = 100u;
+                }
+
+                coreList<coreByte> aiOutput;
+                aiOutput.resize(coreTexture::MipmapsSize(iWidth, iHeight, 2u, iLevels));
+                coreTexture::CreateMipmaps(iWidth, iHeight, 2u, aiInput.data(), iLevels, aiOutput.data(), CORE_TEXTURE_MIPMAP_BOX);
+
+                coreBool bValid = true;
+                for(coreUintW j = 0u, je = aiOutput.size(); j < je; j += 2u) bValid = bValid && (aiOutput[j] == 200u) && (aiOutput[j + 1u] == 100u);
+                DOCTEST_CHECK(bValid);
+            }
+        }
+    }
+}
+
+
+// ****************************************************************
+/* measure map container operations */
+template <typename M, typename K> static void BenchmarkMap(const coreChar* pcName, const coreList<K>& atKey)
+{
+    const auto nTime = [](const coreUint64 iStart) {return coreDouble(SDL_GetPerformanceCounter() - iStart) / coreDouble(SDL_GetPerformanceFrequency()) * 1000.0;};
+
+    M          oMap;
+    coreUint64 iSum = 0u;
+
+    // insert all keys
+    coreUint64 iStart = SDL_GetPerformanceCounter();
+    for(coreUintW i = 0u, ie = atKey.size(); i < ie; ++i) oMap.emplace(atKey[i], i);
+    const coreDouble dInsert = nTime(iStart);
+
+    // lookup all keys (multiple times)
+    iStart = SDL_GetPerformanceCounter();
+    for(coreUintW j = 0u; j < 10u; ++j) FOR_EACH(it, atKey) iSum += oMap.at(*it);
+    const coreDouble dLookup = nTime(iStart);
+
+    // erase all keys
+    iStart = SDL_GetPerformanceCounter();
+    FOR_EACH(it, atKey) oMap.erase(*it);
+    const coreDouble dErase = nTime(iStart);
+
+    DOCTEST_CHECK(oMap.empty());
+    DOCTEST_CHECK(iSum == 10u * (atKey.size() * (atKey.size() - 1u) / 2u));
+    DOCTEST_MESSAGE(PRINT("%-30s %5zu entries: insert %8.3f ms, lookup %8.3f ms, erase %8.3f ms", pcName, atKey.size(), dInsert, dLookup, dErase));
+}
+
+
+// ****************************************************************
+/* micro benchmarks (run with --no-skip) */
+DOCTEST_TEST_CASE("Benchmarks" * doctest::skip())
+{
+    DOCTEST_SUBCASE("coreMap/coreHashMap")
+    {
+        for(coreUintW iNum = 16u; iNum <= 4096u; iNum *= 16u)
+        {
+            coreList<coreUint32>     aiKey;
+            coreList<coreString>     asName;
+            coreList<coreHashString> asKey;
+
+            // generate scattered integer keys and string keys
+            asName.reserve(iNum);
+            for(coreUintW i = 0u; i < iNum; ++i)
+            {
+                aiKey .push_back(coreUint32(i) * 2654435761u);
+                asName.push_back(PRINT("resource_%zu.png", i));
+            }
+            FOR_EACH(it, asName) asKey.push_back(it->c_str());
+
+            BenchmarkMap<coreMap       <coreUint32, coreUintW>>("coreMap",        aiKey);
+            BenchmarkMap<coreHashMap   <coreUint32, coreUintW>>("coreHashMap",    aiKey);
+            BenchmarkMap<coreMapStr    <coreUintW>>            ("coreMapStr",     asKey);
+            BenchmarkMap<coreHashMapStr<coreUintW>>            ("coreHashMapStr", asKey);
+        }
+    }
 }
 
 
@@ -97,8 +426,11 @@ coreStatus Core::__RunTest()
         // init log file
         STATIC_NEW(Log, coreData::UserFolderShared("log.html"))
 
+        // init job manager
+        STATIC_NEW(Manager::Job)
+
         // automatically shut down everything on exit
-        WARN_IF(std::atexit([]() {STATIC_DELETE(Log) SDL_Quit();})) {}
+        WARN_IF(std::atexit([]() {STATIC_DELETE(Manager::Job) STATIC_DELETE(Log) SDL_Quit();})) {}
     };
 
     // only execute on demand (based on CLion plugin)
@@ -378,9 +378,9 @@ void CoreDebug::MeasureEnd(const coreHashString& sName)
     }
 
     // write formatted values to output label
-    pMeasure->oOutput.SetText(DEFINED(IMGUI_API) ? pcName : PRINT("%s (CPU %.2fms / GPU %.2fms / %u (%u) / %u-%u-%u-%u)",
+    pMeasure->oOutput.SetText(DEFINED(IMGUI_API) ? pcName : PRINT("%s (CPU %.2fms / GPU %.2fms / %u (%u -%u) / %u-%u-%u-%u)",
                               pcName, pMeasure->dCurrentCPU, pMeasure->dCurrentGPU,
-                              pMeasure->aaiCounter[1][CORE_DEBUG_COUNTER_DRAW_CALLS],        pMeasure->aaiCounter[1][CORE_DEBUG_COUNTER_INSTANCES],
+                              pMeasure->aaiCounter[1][CORE_DEBUG_COUNTER_DRAW_CALLS],        pMeasure->aaiCounter[1][CORE_DEBUG_COUNTER_INSTANCES],         pMeasure->aaiCounter[1][CORE_DEBUG_COUNTER_CULLED],
                               pMeasure->aaiCounter[1][CORE_DEBUG_COUNTER_BINDS_FRAMEBUFFER], pMeasure->aaiCounter[1][CORE_DEBUG_COUNTER_BINDS_PROGRAM], pMeasure->aaiCounter[1][CORE_DEBUG_COUNTER_BINDS_TEXTURE], pMeasure->aaiCounter[1][CORE_DEBUG_COUNTER_BINDS_MODEL]));
 }
 
@@ -797,7 +797,7 @@ void CoreDebug::__UpdateOutput()
                         ImGui::TableNextColumn(); ImGui::TextUnformatted((*it)->oOutput.GetText());
                         ImGui::TableNextColumn(); ImGui::TextColored(coreVector4(LERP(COLOR_WHITE, COLOR_RED, STEP(0.0, 0.5, (*it)->dCurrentCPU)), 1.0f), "%.2f", (*it)->dCurrentCPU);
                         ImGui::TableNextColumn(); ImGui::TextColored(coreVector4(LERP(COLOR_WHITE, COLOR_RED, STEP(0.0, 0.5, (*it)->dCurrentGPU)), 1.0f), "%.2f", (*it)->dCurrentGPU);
-                        ImGui::TableNextColumn(); ImGui::Text("%u (%u)",     (*it)->aaiCounter[1][CORE_DEBUG_COUNTER_DRAW_CALLS],        (*it)->aaiCounter[1][CORE_DEBUG_COUNTER_INSTANCES]);
+                        ImGui::TableNextColumn(); ImGui::Text("%u (%u -%u)", (*it)->aaiCounter[1][CORE_DEBUG_COUNTER_DRAW_CALLS],        (*it)->aaiCounter[1][CORE_DEBUG_COUNTER_INSTANCES], (*it)->aaiCounter[1][CORE_DEBUG_COUNTER_CULLED]);
                         ImGui::TableNextColumn(); ImGui::Text("%u-%u-%u-%u", (*it)->aaiCounter[1][CORE_DEBUG_COUNTER_BINDS_FRAMEBUFFER], (*it)->aaiCounter[1][CORE_DEBUG_COUNTER_BINDS_PROGRAM], (*it)->aaiCounter[1][CORE_DEBUG_COUNTER_BINDS_TEXTURE], (*it)->aaiCounter[1][CORE_DEBUG_COUNTER_BINDS_MODEL]);
                     }
 
@@ -820,6 +820,8 @@ void CoreDebug::__UpdateOutput()
                     }
 
                     if(iResourceNum || iFunctionNum) ImGui::TextColoredUnf(m_Loading.GetColor4(), m_Loading.GetText());
+
+                    ImGui::Text("Compression Lock Wait: %.3f ms", coreData::CompressLockWait() * 1000.0);
                 }
 
                 ImGui::EndChild();
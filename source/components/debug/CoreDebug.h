@@ -34,7 +34,8 @@ enum coreDebugCounter : coreUint8
     CORE_DEBUG_COUNTER_BINDS_PROGRAM     = 3u,   // shader-program binds
     CORE_DEBUG_COUNTER_BINDS_TEXTURE     = 4u,   // texture binds
     CORE_DEBUG_COUNTER_BINDS_MODEL       = 5u,   // model binds (vertex array objects)
-    CORE_DEBUG_COUNTERS                  = 6u    // total number of debug counters
+    CORE_DEBUG_COUNTER_CULLED            = 6u,   // instances skipped by frustum culling
+    CORE_DEBUG_COUNTERS                  = 7u    // total number of debug counters
 };
 
 enum coreDebugStat : coreUint8
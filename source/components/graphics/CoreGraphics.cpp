@@ -375,6 +375,29 @@ void CoreGraphics::SetView(coreVector2 vResolution, const coreFloat fFOV, const
 }
 
 
+// ****************************************************************
+/* calculate view frustum planes */
+void CoreGraphics::CalcFrustum(coreVector4* OUTPUT pvPlane)const
+{
+    ASSERT(pvPlane)
+
+    // extract planes from the view-projection matrix
+    const coreMatrix4 M = m_mCamera * m_mPerspective;
+    pvPlane[0] = coreVector4(M._14 + M._11, M._24 + M._21, M._34 + M._31, M._44 + M._41);   // left
+    pvPlane[1] = coreVector4(M._14 - M._11, M._24 - M._21, M._34 - M._31, M._44 - M._41);   // right
+    pvPlane[2] = coreVector4(M._14 + M._12, M._24 + M._22, M._34 + M._32, M._44 + M._42);   // bottom
+    pvPlane[3] = coreVector4(M._14 - M._12, M._24 - M._22, M._34 - M._32, M._44 - M._42);   // top
+    pvPlane[4] = coreVector4(M._14 + M._13, M._24 + M._23, M._34 + M._33, M._44 + M._43);   // near
+    pvPlane[5] = coreVector4(M._14 - M._13, M._24 - M._23, M._34 - M._33, M._44 - M._43);   // far
+
+    // normalize planes (to compare with distances)
+    for(coreUintW i = 0u; i < 6u; ++i)
+    {
+        pvPlane[i] *= RCP(pvPlane[i].xyz().Length());
+    }
+}
+
+
 // ****************************************************************
 /* set and update ambient light */
 void CoreGraphics::SetLight(const coreUintW iIndex, const coreVector4 vPosition, const coreVector4 vDirection, const coreVector4 vValue)
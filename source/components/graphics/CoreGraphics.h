@@ -111,6 +111,7 @@ public:
     inline void OverrideCamera     (const coreMatrix4& mCamera)      {m_mCamera      = mCamera;      ADD_BIT(m_iUniformUpdate, 0u) ADD_BIT(m_iOverrideState, 0u)}
     inline void OverridePerspective(const coreMatrix4& mPerspective) {m_mPerspective = mPerspective; ADD_BIT(m_iUniformUpdate, 0u) ADD_BIT(m_iOverrideState, 1u)}
     inline void OverrideOrtho      (const coreMatrix4& mOrtho)       {m_mOrtho       = mOrtho;       ADD_BIT(m_iUniformUpdate, 1u) ADD_BIT(m_iOverrideState, 1u)}
+    void        CalcFrustum        (coreVector4* OUTPUT pvPlane)const;   // 6 normalized planes (left, right, bottom, top, near, far), pointing inwards
 
     /* control ambient */
     void SetLight(const coreUintW iIndex, const coreVector4 vPosition, const coreVector4 vDirection, const coreVector4 vValue);
@@ -58,8 +58,7 @@ void coreDataBuffer::Create(const GLenum iTarget, const coreUint32 iSize, const
 
     if(HAS_FLAG(m_eStorageType, CORE_DATABUFFER_STORAGE_STATIC))
     {
-        ASSERT(pData)
-
+        // # without data, content can only be written with copy operations
         if(CORE_GL_SUPPORT(ARB_buffer_storage))
         {
             // allocate static immutable buffer memory
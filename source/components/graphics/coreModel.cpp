@@ -11,7 +11,161 @@
 #include "model/MD5.h"
 #include <forsyth_too.h>
 
-coreModel* coreModel::s_pCurrent = NULL;
+coreModel*                coreModel::s_pCurrent      = NULL;
+coreModelArena*           coreModel::s_pCurrentArena = NULL;
+coreList<coreModelArena*> coreModel::s_apArena       = {};
+
+
+// ****************************************************************
+/* constructor */
+coreModelArena::coreModelArena(const coreUint8 iVertexSize)noexcept
+: m_iVertexArray (0u)
+, m_VertexBuffer ()
+, m_IndexBuffer  ()
+, m_aVertexFree  {}
+, m_aIndexFree   {}
+, m_iNumModels   (0u)
+{
+    // create shared data buffers (only written with copy operations)
+    m_VertexBuffer.Create(CORE_MODEL_ARENA_VERTICES, iVertexSize, NULL, CORE_DATABUFFER_STORAGE_STATIC);
+    m_IndexBuffer .Create(GL_ELEMENT_ARRAY_BUFFER, CORE_MODEL_ARENA_INDICES * sizeof(coreUint16), NULL, CORE_DATABUFFER_STORAGE_STATIC);
+
+    // start with everything free
+    m_aVertexFree.push_back({0u, CORE_MODEL_ARENA_VERTICES});
+    m_aIndexFree .push_back({0u, CORE_MODEL_ARENA_INDICES});
+
+    // add debug labels
+    Core::Graphics->LabelOpenGL(GL_BUFFER, m_VertexBuffer.GetIdentifier(), "arena.vertex");
+    Core::Graphics->LabelOpenGL(GL_BUFFER, m_IndexBuffer .GetIdentifier(), "arena.index");
+}
+
+
+// ****************************************************************
+/* destructor */
+coreModelArena::~coreModelArena()
+{
+    ASSERT(!m_iNumModels)
+
+    // delete vertex array object
+    if(m_iVertexArray) coreDelVertexArrays(1u, &m_iVertexArray);
+}
+
+
+// ****************************************************************
+/* allocate model ranges */
+coreBool coreModelArena::Allocate(const coreUint32 iNumVertices, const coreUint32 iNumIndices, coreUint32* OUTPUT piBaseVertex, coreUint32* OUTPUT piFirstIndex)
+{
+    ASSERT(iNumVertices && iNumIndices && piBaseVertex && piFirstIndex)
+
+    // take vertex range
+    if(!coreModelArena::TakeRange(&m_aVertexFree, iNumVertices, piBaseVertex)) return false;
+
+    // take index range
+    if(!coreModelArena::TakeRange(&m_aIndexFree, iNumIndices, piFirstIndex))
+    {
+        coreModelArena::ReturnRange(&m_aVertexFree, (*piBaseVertex), iNumVertices);
+        return false;
+    }
+
+    m_iNumModels += 1u;
+    return true;
+}
+
+
+// ****************************************************************
+/* free model ranges */
+void coreModelArena::Free(const coreUint32 iBaseVertex, const coreUint32 iNumVertices, const coreUint32 iFirstIndex, const coreUint32 iNumIndices)
+{
+    ASSERT(m_iNumModels)
+
+    // return both ranges
+    coreModelArena::ReturnRange(&m_aVertexFree, iBaseVertex, iNumVertices);
+    coreModelArena::ReturnRange(&m_aIndexFree,  iFirstIndex, iNumIndices);
+
+    m_iNumModels -= 1u;
+}
+
+
+// ****************************************************************
+/* enable the arena */
+void coreModelArena::Enable()
+{
+    // bind vertex array object
+    if(m_iVertexArray) glBindVertexArray(m_iVertexArray);
+    else
+    {
+        if(CORE_GL_SUPPORT(ARB_vertex_array_object))
+        {
+            // create vertex array object
+            coreGenVertexArrays(1u, &m_iVertexArray);
+            glBindVertexArray(m_iVertexArray);
+
+            // force binding of index data
+            coreDataBuffer::Unbind(GL_ELEMENT_ARRAY_BUFFER, false);
+
+            // add debug label
+            Core::Graphics->LabelOpenGL(GL_VERTEX_ARRAY, m_iVertexArray, "arena");
+        }
+
+        // set vertex and index data
+        m_VertexBuffer.Activate(0u);
+        m_IndexBuffer .Bind();
+    }
+}
+
+
+// ****************************************************************
+/* take first fitting free range */
+coreBool coreModelArena::TakeRange(coreList<coreRange>* OUTPUT paFree, const coreUint32 iSize, coreUint32* OUTPUT piOffset)
+{
+    FOR_EACH(it, *paFree)
+    {
+        if(it->iSize >= iSize)
+        {
+            // cut from the front of the range
+            (*piOffset)  = it->iOffset;
+            it->iOffset += iSize;
+            it->iSize   -= iSize;
+
+            // remove exhausted range
+            if(!it->iSize) paFree->erase(it);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+// ****************************************************************
+/* return range and merge with adjacent free ranges */
+void coreModelArena::ReturnRange(coreList<coreRange>* OUTPUT paFree, const coreUint32 iOffset, const coreUint32 iSize)
+{
+    // find first range behind the returned one
+    auto it = std::find_if(paFree->begin(), paFree->end(), [&](const coreRange& oRange) {return (oRange.iOffset > iOffset);});
+    ASSERT((it == paFree->end()) || (iOffset + iSize <= it->iOffset))
+
+    // merge with next range
+    if((it != paFree->end()) && (iOffset + iSize == it->iOffset))
+    {
+        it->iOffset  = iOffset;
+        it->iSize   += iSize;
+    }
+    else it = paFree->insert(it, {iOffset, iSize});
+
+    // merge with previous range
+    if(it != paFree->begin())
+    {
+        const auto et = it - 1;
+        ASSERT(et->iOffset + et->iSize <= it->iOffset)
+
+        if(et->iOffset + et->iSize == it->iOffset)
+        {
+            et->iSize += it->iSize;
+            paFree->erase(it);
+        }
+    }
+}
 
 
 // ****************************************************************
@@ -21,6 +175,9 @@ coreModel::coreModel(const coreModelLoad eLoad)noexcept
 , m_iVertexArray        (0u)
 , m_aVertexBuffer       {}
 , m_IndexBuffer         ()
+, m_pArena              (NULL)
+, m_iBaseVertex         (0u)
+, m_iFirstIndex         (0u)
 , m_iNumVertices        (0u)
 , m_iNumIndices         (0u)
 , m_iNumClusters        (0u)
@@ -34,9 +191,16 @@ coreModel::coreModel(const coreModelLoad eLoad)noexcept
 , m_piClusterNumIndices (NULL)
 , m_pvClusterPosition   (NULL)
 , m_pfClusterRadius     (NULL)
+, m_fClusterRadiusMax   (0.0f)
+, m_pBvhNode            (NULL)
+, m_iNumBvhNodes        (0u)
+, m_piBvhIndex          (NULL)
+, m_piBvhCluster        (NULL)
 , m_iPrimitiveType      (GL_TRIANGLES)
 , m_iIndexType          (0u)
 , m_eLoad               (eLoad)
+, m_pPrepared           (NULL)
+, m_iPreparedSize       (0u)
 , m_Sync                ()
 {
 }
@@ -51,18 +215,590 @@ coreModel::~coreModel()
 
 
 // ****************************************************************
-/* load model resource data */
-coreStatus coreModel::Load(coreFile* pFile)
+/* load model resource data */
+coreStatus coreModel::Load(coreFile* pFile)
+{
+    // check for sync object status
+    const coreStatus eCheck = m_Sync.Check(0u);
+    if(eCheck >= CORE_OK) return eCheck;
+
+    WARN_IF(!m_aVertexBuffer.empty() || m_pArena) return CORE_INVALID_CALL;
+
+    // load cooked model directly (nothing to process)
+    if(!m_pPrepared && coreModel::IsCooked(pFile))
+    {
+        coreFileScope oUnloader(pFile);
+        return this->__LoadCooked(pFile->GetData(), pFile->GetSize());
+    }
+
+    // import and process file (if not already prepared)
+    if(!m_pPrepared)
+    {
+        const coreStatus eStatus = this->Prepare(pFile);
+        if(eStatus != CORE_OK) return eStatus;
+    }
+
+    // take over processed model data
+    const coreDataScope<coreByte> pData = std::move(m_pPrepared);
+    ASSERT(pData && !m_pPrepared)
+
+    return this->__LoadCooked(pData, m_iPreparedSize);
+}
+
+
+// ****************************************************************
+/* import and process model resource data (without OpenGL context) */
+coreStatus coreModel::Prepare(coreFile* pFile)
+{
+    coreFileScope oUnloader(pFile);
+
+    WARN_IF(m_pPrepared)  return CORE_INVALID_CALL;
+    if(!pFile)            return CORE_INVALID_INPUT;
+    if(!pFile->GetData()) return CORE_ERROR_FILE;
+
+    // skip cooked model (already processed)
+    if(coreModel::IsCooked(pFile)) return CORE_OK;
+
+    // import model file
+    coreImport oImport;
+    switch(coreModel::Import(pFile, &oImport))
+    {
+    default: UNREACHABLE
+    case CORE_OK: break;
+
+    case CORE_INVALID_INPUT:
+        Core::Log->Warning("Model (%s) could not be identified (valid extensions: md5[z], md3[z])", m_sName.c_str());
+        return CORE_INVALID_DATA;
+
+    case CORE_INVALID_DATA:
+        Core::Log->Warning("Model (%s) could not be loaded", m_sName.c_str());
+        return CORE_INVALID_DATA;
+    }
+
+    // optimize, analyze and pack model data
+    m_pPrepared = coreModel::CreateCooked(&oImport, !HAS_FLAG(m_eLoad, CORE_MODEL_LOAD_NO_CLUSTERS), &m_iPreparedSize);
+
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* load cooked model resource data */
+coreStatus coreModel::__LoadCooked(const coreByte* pData, const coreUint32 iSize)
+{
+    ASSERT(pData)
+
+    // read and check file header
+    coreCookedHeader oHeader;
+    if(iSize >= sizeof(coreCookedHeader)) std::memcpy(&oHeader, pData, sizeof(coreCookedHeader));
+    if((iSize < sizeof(coreCookedHeader)) || (oHeader.iVersion != CORE_MODEL_COOKED_VERSION) || !oHeader.iNumVertices || (oHeader.iNumVertices > 0xFFFFu) || !oHeader.iNumIndices || (oHeader.iNumIndices > iSize / sizeof(coreUint16)) || (oHeader.iNumClusters > CORE_MODEL_CLUSTERS_MAX))
+    {
+        Core::Log->Warning("Model (%s) is not a valid cooked model", m_sName.c_str());
+        return CORE_INVALID_DATA;
+    }
+
+    // check data size of all sections
+    const coreCookedLayout oLayout = coreModel::__CookedLayout(oHeader);
+    if(oLayout.iSize > iSize)
+    {
+        Core::Log->Warning("Model (%s) is truncated", m_sName.c_str());
+        return CORE_INVALID_DATA;
+    }
+
+    // check index and cluster data
+    if(!coreModel::__CheckCooked(pData, oHeader, oLayout))
+    {
+        Core::Log->Warning("Model (%s) contains invalid index data", m_sName.c_str());
+        return CORE_INVALID_DATA;
+    }
+
+    // save properties
+    m_iNumVertices    = oHeader.iNumVertices;
+    m_iNumIndices     = oHeader.iNumIndices;
+    m_vBoundingRange  = oHeader.vBoundingRange;
+    m_fBoundingRadius = oHeader.fBoundingRadius;
+    m_vNaturalCenter  = oHeader.vNaturalCenter;
+    m_vNaturalRange   = oHeader.vNaturalRange;
+    m_vWeightedCenter = oHeader.vWeightedCenter;
+
+    if(!HAS_FLAG(m_eLoad, CORE_MODEL_LOAD_NO_CLUSTERS) && oHeader.iNumClusters)
+    {
+        // save number of clusters
+        m_iNumClusters = oHeader.iNumClusters;
+
+        // allocate cluster memory
+        coreByte* pIndexMemory = ALIGNED_NEW(coreByte,    m_iNumClusters * sizeof(coreUint16*) + m_iNumIndices * sizeof(coreUint16), ALIGNMENT_CACHE);
+        m_pvVertexPosition     = ALIGNED_NEW(coreVector3, m_iNumVertices,                                                            ALIGNMENT_CACHE);
+        m_piClusterNumIndices  = ALIGNED_NEW(coreUint16,  m_iNumClusters,                                                            ALIGNMENT_CACHE);
+        m_pvClusterPosition    = ALIGNED_NEW(coreVector3, m_iNumClusters,                                                            ALIGNMENT_CACHE);
+        m_pfClusterRadius      = ALIGNED_NEW(coreFloat,   m_iNumClusters,                                                            ALIGNMENT_CACHE);
+
+        // copy all cluster data (vertex positions are the beginning of the low quality vertex data)
+        std::memcpy(m_pvVertexPosition,    pData + oLayout.iVertexLow,       m_iNumVertices * sizeof(coreVector3));
+        std::memcpy(m_piClusterNumIndices, pData + oLayout.iClusterNum,      m_iNumClusters * sizeof(coreUint16));
+        std::memcpy(m_pvClusterPosition,   pData + oLayout.iClusterPosition, m_iNumClusters * sizeof(coreVector3));
+        std::memcpy(m_pfClusterRadius,     pData + oLayout.iClusterRadius,   m_iNumClusters * sizeof(coreFloat));
+
+        // prepare index pointers to use only single allocation (also to keep indirections as near as possible)
+        m_ppiClusterIndex    = r_cast<coreUint16**>(pIndexMemory);
+        m_ppiClusterIndex[0] = r_cast<coreUint16*> (pIndexMemory + m_iNumClusters * sizeof(coreUint16*));
+        for(coreUintW i = 1u, ie = m_iNumClusters; i < ie; ++i) m_ppiClusterIndex[i] = m_ppiClusterIndex[i - 1u] + m_piClusterNumIndices[i - 1u];
+        ASSERT(m_ppiClusterIndex[m_iNumClusters - 1u] + m_piClusterNumIndices[m_iNumClusters - 1u] == m_ppiClusterIndex[0] + m_iNumIndices)
+
+        // copy all cluster indices at once
+        std::memcpy(m_ppiClusterIndex[0], pData + oLayout.iClusterIndex, m_iNumIndices * sizeof(coreUint16));
+
+        // get largest cluster radius
+        for(coreUintW i = 0u, ie = m_iNumClusters; i < ie; ++i) m_fClusterRadiusMax = MAX(m_fClusterRadiusMax, m_pfClusterRadius[i]);
+
+        // build bounding volume hierarchy for precise collision detection
+        this->__BuildBvh();
+    }
+
+    if(!HAS_FLAG(m_eLoad, CORE_MODEL_LOAD_NO_BUFFERS) || Core::Debug->IsEnabled())   // # for debug drawing
+    {
+        // select vertex compression (high quality or low quality)
+        const coreBool  bHigh       = (CORE_GL_SUPPORT(ARB_vertex_type_2_10_10_10_rev) && CORE_GL_SUPPORT(ARB_half_float_vertex));
+        const coreByte* pVertexData = pData + (bHigh ? oLayout.iVertexHigh : oLayout.iVertexLow);
+        const coreByte* pIndexData  = pData + oLayout.iIndex;
+
+        // try to store data in a shared model arena
+        if(!HAS_FLAG(m_eLoad, CORE_MODEL_LOAD_ARENA) || !this->__LoadArena(pVertexData, pIndexData, bHigh))
+        {
+            // create vertex buffer (de-interleaved)
+            coreVertexBuffer* pBuffer = this->CreateVertexBuffer(m_iNumVertices, bHigh ? 20u : 24u, pVertexData, CORE_DATABUFFER_STORAGE_STATIC);
+            coreModel::__DefineAttributes(pBuffer, bHigh);
+
+            // create index buffer
+            this->CreateIndexBuffer(m_iNumIndices, sizeof(coreUint16), pIndexData, CORE_DATABUFFER_STORAGE_STATIC);
+
+            if(Core::Debug->IsEnabled() && !m_sName.empty())
+            {
+                // add debug label
+                Core::Graphics->LabelOpenGL(GL_BUFFER, m_aVertexBuffer.front().GetIdentifier(), PRINT("%s.vertex", m_sName.c_str()));
+                Core::Graphics->LabelOpenGL(GL_BUFFER, m_IndexBuffer          .GetIdentifier(), PRINT("%s.index",  m_sName.c_str()));
+            }
+        }
+    }
+
+    Core::Log->Info("Model (%s, %u vertices, %u indices, %u clusters, %.5f x %.5f x %.5f range, %.5f radius) loaded", m_sName.c_str(), m_iNumVertices, m_iNumIndices, m_iNumClusters, m_vBoundingRange.x, m_vBoundingRange.y, m_vBoundingRange.z, m_fBoundingRadius);
+    return m_Sync.Create(CORE_SYNC_CREATE_FLUSHED) ? CORE_BUSY : CORE_OK;
+}
+
+
+// ****************************************************************
+/* store vertex and index data in shared model arenas */
+coreBool coreModel::__LoadArena(const coreByte* pVertexData, const coreByte* pIndexData, const coreBool bHigh)
+{
+    ASSERT(pVertexData && pIndexData && !m_pArena)
+
+    // check for base vertex draws and buffer copies (arenas are only written with copy operations)
+    if(!CORE_GL_SUPPORT(ARB_draw_elements_base_vertex) || !CORE_GL_SUPPORT(ARB_copy_buffer)) return false;
+    if((m_iNumVertices > CORE_MODEL_ARENA_VERTICES) || (m_iNumIndices > CORE_MODEL_ARENA_INDICES)) return false;
+
+    // define de-interleaved vertex streams (byte offsets per vertex, last entry is the vertex size)
+    constexpr coreUint8 aiStreamHigh[] = {0u, 8u,  12u, 16u, 20u};
+    constexpr coreUint8 aiStreamLow [] = {0u, 12u, 16u, 20u, 24u};
+    const coreUint8* piStream = bHigh ? aiStreamHigh : aiStreamLow;
+
+    // find first arena with enough free space
+    FOR_EACH(it, s_apArena)
+    {
+        if((*it)->Allocate(m_iNumVertices, m_iNumIndices, &m_iBaseVertex, &m_iFirstIndex))
+        {
+            m_pArena = (*it);
+            break;
+        }
+    }
+
+    if(!m_pArena)
+    {
+        // create new arena
+        m_pArena = s_apArena.emplace_back(new coreModelArena(piStream[4]));
+        coreModel::__DefineAttributes(m_pArena->GetVertexBuffer(), bHigh);
+
+        WARN_IF(!m_pArena->Allocate(m_iNumVertices, m_iNumIndices, &m_iBaseVertex, &m_iFirstIndex))
+        {
+            s_apArena.erase_first(m_pArena);
+            SAFE_DELETE(m_pArena)
+            return false;
+        }
+    }
+
+    const coreUint32 iVertexSize = m_iNumVertices * piStream[4];
+    const coreUint32 iIndexSize  = m_iNumIndices  * sizeof(coreUint16);
+
+    // gather vertex and index data
+    coreByte* pStaging = new coreByte[iVertexSize + iIndexSize];
+    std::memcpy(pStaging,               pVertexData, iVertexSize);
+    std::memcpy(pStaging + iVertexSize, pIndexData,  iIndexSize);
+
+    // upload into temporary staging buffer
+    coreDataBuffer oStaging;
+    oStaging.Create(GL_COPY_READ_BUFFER, iVertexSize + iIndexSize, pStaging, CORE_DATABUFFER_STORAGE_STREAM);
+    SAFE_DELETE_ARRAY(pStaging)
+
+    // copy all vertex streams into their allocated ranges
+    for(coreUintW i = 0u; i < 4u; ++i)
+    {
+        const coreUint8 iStride = piStream[i + 1u] - piStream[i];
+        oStaging.Copy(piStream[i] * m_iNumVertices, piStream[i] * CORE_MODEL_ARENA_VERTICES + iStride * m_iBaseVertex, iStride * m_iNumVertices, m_pArena->GetVertexBuffer());
+    }
+
+    // copy index data into its allocated range
+    oStaging.Copy(iVertexSize, m_iFirstIndex * sizeof(coreUint16), iIndexSize, m_pArena->GetIndexBuffer());
+
+    // save index type (indices are relative to the base vertex)
+    m_iIndexType = GL_UNSIGNED_SHORT;
+
+    // disable current model object (to fully enable the next model)
+    coreModel::Disable(false);
+
+    return true;
+}
+
+
+// ****************************************************************
+/* remove vertex and index data from shared model arenas */
+void coreModel::__UnloadArena()
+{
+    ASSERT(m_pArena)
+
+    // free allocated ranges
+    m_pArena->Free(m_iBaseVertex, m_iNumVertices, m_iFirstIndex, m_iNumIndices);
+
+    // delete arena when not used anymore
+    if(m_pArena->IsEmpty())
+    {
+        if(s_pCurrentArena == m_pArena) coreModel::Disable(true);
+
+        s_apArena.erase_first(m_pArena);
+        SAFE_DELETE(m_pArena)
+    }
+
+    // reset properties
+    m_pArena      = NULL;
+    m_iBaseVertex = 0u;
+    m_iFirstIndex = 0u;
+}
+
+
+// ****************************************************************
+/* define vertex attributes of cooked models */
+void coreModel::__DefineAttributes(coreVertexBuffer* OUTPUT pBuffer, const coreBool bHigh)
+{
+    if(bHigh)
+    {
+        // high quality compression (de-interleaved)
+        pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_POSITION_NUM, CORE_VERTEX_SPEC_FLOAT_4X16, 0u,  0u);
+        pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TEXCOORD_NUM, CORE_VERTEX_SPEC_UNORM_2X16, 8u,  0u);
+        pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_NORMAL_NUM,   CORE_VERTEX_SPEC_SNORM_210,  12u, 0u);
+        pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TANGENT_NUM,  CORE_VERTEX_SPEC_SNORM_210,  16u, 0u);
+    }
+    else
+    {
+        // low quality compression (de-interleaved)
+        pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_POSITION_NUM, CORE_VERTEX_SPEC_FLOAT_3X32, 0u,  0u);
+        pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TEXCOORD_NUM, CORE_VERTEX_SPEC_UNORM_2X16, 12u, 0u);
+        pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_NORMAL_NUM,   CORE_VERTEX_SPEC_SNORM_4X8,  16u, 0u);
+        pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TANGENT_NUM,  CORE_VERTEX_SPEC_SNORM_4X8,  20u, 0u);
+    }
+}
+
+
+// ****************************************************************
+/* unload model resource data */
+coreStatus coreModel::Unload()
+{
+    // discard prepared model data
+    m_pPrepared = NULL;
+
+    if(!m_iNumVertices) return CORE_INVALID_CALL;
+
+    // disable still active model
+    if(s_pCurrent == this) coreModel::Disable(true);
+
+    // delete all data buffers
+    m_aVertexBuffer.clear();
+    m_IndexBuffer.Delete();
+
+    // free shared arena ranges
+    if(m_pArena) this->__UnloadArena();
+
+    // free cluster memory
+    if(m_iNumClusters)
+    {
+        ALIGNED_DELETE(m_pvVertexPosition)
+        ALIGNED_DELETE(m_ppiClusterIndex)
+        ALIGNED_DELETE(m_piClusterNumIndices)
+        ALIGNED_DELETE(m_pvClusterPosition)
+        ALIGNED_DELETE(m_pfClusterRadius)
+        m_fClusterRadiusMax = 0.0f;
+    }
+
+    // free bounding volume hierarchy
+    if(m_pBvhNode)
+    {
+        ALIGNED_DELETE(m_pBvhNode)
+        ALIGNED_DELETE(m_piBvhIndex)
+        ALIGNED_DELETE(m_piBvhCluster)
+        m_iNumBvhNodes = 0u;
+    }
+
+    // delete vertex array object
+    if(m_iVertexArray) coreDelVertexArrays(1u, &m_iVertexArray);
+    if(!m_sName.empty()) Core::Log->Info("Model (%s) unloaded", m_sName.c_str());
+
+    // delete sync object
+    m_Sync.Delete();
+
+    // reset properties
+    m_iVertexArray    = 0u;
+    m_iNumVertices    = 0u;
+    m_iNumIndices     = 0u;
+    m_iNumClusters    = 0u;
+    m_vBoundingRange  = coreVector3(0.0f,0.0f,0.0f);
+    m_fBoundingRadius = 0.0f;
+    m_vNaturalCenter  = coreVector3(0.0f,0.0f,0.0f);
+    m_vNaturalRange   = coreVector3(0.0f,0.0f,0.0f);
+    m_vWeightedCenter = coreVector3(0.0f,0.0f,0.0f);
+    m_iPrimitiveType  = GL_TRIANGLES;
+    m_iIndexType      = 0u;
+
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* draw the model */
+void coreModel::DrawArrays()const
+{
+    // draw the model (without index buffer)
+    ASSERT((s_pCurrent == this) || !s_pCurrent)
+    glDrawArrays(m_iPrimitiveType, m_iBaseVertex, m_iNumVertices);
+
+    // update debug counters
+    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_DRAW_CALLS, 1u);
+    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_INSTANCES,  1u);
+}
+
+void coreModel::DrawElements()const
+{
+    // draw the model (with index buffer)
+    ASSERT(((s_pCurrent == this) || !s_pCurrent) && this->__HasIndices())
+    if(m_pArena) glDrawRangeElementsBaseVertex(m_iPrimitiveType, 0u, m_iNumVertices - 1u, m_iNumIndices, m_iIndexType, I_TO_P(m_iFirstIndex * sizeof(coreUint16)), m_iBaseVertex);
+            else glDrawRangeElements          (m_iPrimitiveType, 0u, m_iNumVertices - 1u, m_iNumIndices, m_iIndexType, NULL);
+
+    // update debug counters
+    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_DRAW_CALLS, 1u);
+    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_INSTANCES,  1u);
+}
+
+
+// ****************************************************************
+/* draw the model instanced */
+void coreModel::DrawArraysInstanced(const coreUint32 iCount)const
+{
+    // draw the model instanced (without index buffer)
+    ASSERT(((s_pCurrent == this) || !s_pCurrent) && iCount)
+    glDrawArraysInstanced(m_iPrimitiveType, m_iBaseVertex, m_iNumVertices, iCount);
+
+    // update debug counters
+    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_DRAW_CALLS, 1u);
+    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_INSTANCES,  iCount);
+}
+
+void coreModel::DrawElementsInstanced(const coreUint32 iCount)const
+{
+    // draw the model instanced (with index buffer)
+    ASSERT(((s_pCurrent == this) || !s_pCurrent) && this->__HasIndices() && iCount)
+    if(m_pArena) glDrawElementsInstancedBaseVertex(m_iPrimitiveType, m_iNumIndices, m_iIndexType, I_TO_P(m_iFirstIndex * sizeof(coreUint16)), iCount, m_iBaseVertex);
+            else glDrawElementsInstanced          (m_iPrimitiveType, m_iNumIndices, m_iIndexType, NULL, iCount);
+
+    // update debug counters
+    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_DRAW_CALLS, 1u);
+    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_INSTANCES,  iCount);
+}
+
+
+// ****************************************************************
+/* enable the model */
+void coreModel::Enable()
+{
+    ASSERT(!m_aVertexBuffer.empty() || m_pArena)
+
+    // check and save current model object
+    if(s_pCurrent == this) return;
+    s_pCurrent = this;
+
+    if(m_pArena)
+    {
+        // check and save current model arena (models of the same arena share all bindings)
+        if(s_pCurrentArena == m_pArena) return;
+        s_pCurrentArena = m_pArena;
+
+        // bind shared vertex array object
+        m_pArena->Enable();
+    }
+    else
+    {
+        // reset current model arena
+        s_pCurrentArena = NULL;
+
+        // bind vertex array object
+        if(m_iVertexArray) glBindVertexArray(m_iVertexArray);
+        else
+        {
+            if(CORE_GL_SUPPORT(ARB_vertex_array_object))
+            {
+                // create vertex array object
+                coreGenVertexArrays(1u, &m_iVertexArray);
+                glBindVertexArray(m_iVertexArray);
+
+                // force binding of index data
+                coreDataBuffer::Unbind(GL_ELEMENT_ARRAY_BUFFER, false);
+
+                // add debug label
+                Core::Graphics->LabelOpenGL(GL_VERTEX_ARRAY, m_iVertexArray, m_sName.c_str());
+            }
+
+            // set vertex data
+            for(coreUintW i = 0u, ie = m_aVertexBuffer.size(); i < ie; ++i)
+            {
+                m_aVertexBuffer[i].Activate(0u);
+            }
+
+            // set index data
+            if(m_IndexBuffer.IsValid()) m_IndexBuffer.Bind();
+        }
+    }
+
+    // update debug counters
+    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_BINDS_MODEL, 1u);
+}
+
+
+// ****************************************************************
+/* disable the model */
+void coreModel::Disable(const coreBool bFull)
+{
+    // reset current model object and arena
+    s_pCurrent      = NULL;
+    s_pCurrentArena = NULL;
+
+    coreBool bFullUnbind = false;
+    if(bFull)
+    {
+        // unbind vertex array object
+        if(CORE_GL_SUPPORT(ARB_vertex_array_object)) glBindVertexArray(0u);
+        else bFullUnbind = true;
+    }
+
+    // unbind data buffers
+    coreDataBuffer::Unbind(GL_ARRAY_BUFFER,         bFullUnbind);
+    coreDataBuffer::Unbind(GL_ELEMENT_ARRAY_BUFFER, bFullUnbind);
+}
+
+
+// ****************************************************************
+/* create vertex buffer */
+coreVertexBuffer* coreModel::CreateVertexBuffer(const coreUint32 iNumVertices, const coreUint8 iVertexSize, const void* pVertexData, const coreDataBufferStorage eStorageType)
+{
+    ASSERT(!m_iVertexArray && !m_pArena)
+
+    // save properties
+    if(m_aVertexBuffer.empty()) m_iNumVertices = iNumVertices;
+    ASSERT(m_iNumVertices && (m_iNumVertices == iNumVertices))
+
+    // create vertex buffer
+    m_aVertexBuffer.emplace_back().Create(iNumVertices, iVertexSize, pVertexData, eStorageType);
+
+    // disable current model object (to fully enable the next model)
+    coreModel::Disable(false);
+
+    return &m_aVertexBuffer.back();
+}
+
+
+// ****************************************************************
+/* create index buffer */
+coreDataBuffer* coreModel::CreateIndexBuffer(const coreUint32 iNumIndices, const coreUint8 iIndexSize, const void* pIndexData, const coreDataBufferStorage eStorageType)
+{
+    ASSERT(!m_iVertexArray && !m_IndexBuffer.IsValid() && !m_pArena)
+
+    // save properties
+    m_iNumIndices = iNumIndices;
+    ASSERT(m_iNumIndices)
+
+    // detect index type
+    switch(iIndexSize)
+    {
+    default: UNREACHABLE
+    case 4u: m_iIndexType = GL_UNSIGNED_INT;   break;
+    case 2u: m_iIndexType = GL_UNSIGNED_SHORT; break;
+    case 1u: m_iIndexType = GL_UNSIGNED_BYTE;  break;
+    }
+
+    // disable current model object (to unbind current VAO)
+    coreModel::Disable(true);
+
+    // create index buffer
+    m_IndexBuffer.Create(GL_ELEMENT_ARRAY_BUFFER, iNumIndices*iIndexSize, pIndexData, eStorageType);
+
+    return &m_IndexBuffer;
+}
+
+
+// ****************************************************************
+/* find first cluster intersecting a sphere */
+coreUintW coreModel::FindCluster(const coreVector3 vCenter, const coreFloat fRadius, const coreVector3 vScale)const
+{
+    ASSERT(m_iNumClusters <= CORE_MODEL_CLUSTERS_MAX)
+
+    const coreFloat fScaleMax = vScale.Max();
+
+    // test single cluster against the sphere (same as separate sphere-sphere check)
+    const auto nTestFunc = [&](const coreUintW iIndex)
+    {
+        return ((vCenter - vScale * m_pvClusterPosition[iIndex]).LengthSq() <= POW2(fRadius + m_pfClusterRadius[iIndex] * fScaleMax));
+    };
+
+    // test all clusters in order (without hierarchy)
+    if(!m_pBvhNode)
+    {
+        for(coreUintW i = 0u, ie = m_iNumClusters; i < ie; ++i)
+        {
+            if(nTestFunc(i)) return i;
+        }
+        return m_iNumClusters;
+    }
+
+    coreUint64 aiTested[(CORE_MODEL_CLUSTERS_MAX + 63u) / 64u] = {};
+    coreUintW  iFound = m_iNumClusters;
+
+    // only test clusters with triangles near the sphere (every touching cluster has a triangle within twice its radius)
+    this->QuerySphere(vCenter, fRadius + 2.0f * m_fClusterRadiusMax * fScaleMax, vScale, [&](const coreUint16* piIndex)
+    {
+        const coreUintW iCluster = m_piBvhCluster[(piIndex - m_piBvhIndex) / 3u];
+        if((iCluster >= iFound) || HAS_BIT_EX(aiTested, iCluster)) return false;
+        ADD_BIT_EX(aiTested, iCluster)
+
+        // keep lowest touching cluster (to match the order of a full search)
+        if(nTestFunc(iCluster)) iFound = iCluster;
+        return (iFound == 0u);
+    });
+
+    return iFound;
+}
+
+
+// ****************************************************************
+/* import model file (md5[z], md3[z]) */
+coreStatus coreModel::Import(coreFile* pFile, coreImport* OUTPUT pOutput)
 {
-    // check for sync object status
-    const coreStatus eCheck = m_Sync.Check(0u);
-    if(eCheck >= CORE_OK) return eCheck;
-
-    coreFileScope oUnloader(pFile);
+    ASSERT(pFile && pOutput)
 
-    WARN_IF(!m_aVertexBuffer.empty()) return CORE_INVALID_CALL;
-    if(!pFile)                        return CORE_INVALID_INPUT;
-    if(!pFile->GetData())             return CORE_ERROR_FILE;
+    if(!pFile->GetData()) return CORE_ERROR_FILE;
 
     // extract file extension
     const coreChar* pcExtension = coreData::StrToLower(coreData::StrExtension(pFile->GetPath()));
@@ -80,41 +816,51 @@ coreStatus coreModel::Load(coreFile* pFile)
     }
 
     // import model file
-    coreImport oImport;
-         if(!std::memcmp(pcExtension, "md5", 3u)) coreImportMD5(pDecompressed ? pDecompressed.Get() : pFile->GetData(), &oImport);
-    else if(!std::memcmp(pcExtension, "md3", 3u)) coreImportMD3(pDecompressed ? pDecompressed.Get() : pFile->GetData(), &oImport);
-    else
-    {
-        Core::Log->Warning("Model (%s) could not be identified (valid extensions: md5[z], md3[z])", m_sName.c_str());
-        return CORE_INVALID_DATA;
-    }
+         if(!std::memcmp(pcExtension, "md5", 3u)) coreImportMD5(pDecompressed ? pDecompressed.Get() : pFile->GetData(), pOutput);
+    else if(!std::memcmp(pcExtension, "md3", 3u)) coreImportMD3(pDecompressed ? pDecompressed.Get() : pFile->GetData(), pOutput);
+    else return CORE_INVALID_INPUT;
 
     // check for success
-    WARN_IF(oImport.aVertexData.empty())
+    WARN_IF(pOutput->aVertexData.empty() || pOutput->aiIndexData.empty())
     {
-        Core::Log->Warning("Model (%s) could not be loaded", m_sName.c_str());
+        (*pOutput) = {};
         return CORE_INVALID_DATA;
     }
 
-    // save properties
-    m_iNumVertices = oImport.aVertexData.size();
-    m_iNumIndices  = oImport.aiIndexData.size();
-    ASSERT((m_iNumVertices > 0u) && (m_iNumVertices <= 0xFFFFu) && m_iNumIndices)
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* optimize, analyze and pack imported model data (returns new file data) */
+coreByte* coreModel::CreateCooked(coreImport* pImport, const coreBool bClusters, coreUint32* OUTPUT piSize)
+{
+    ASSERT(pImport && piSize)
+
+    const coreUint32 iNumVertices = pImport->aVertexData.size();
+    const coreUint32 iNumIndices  = pImport->aiIndexData.size();
+    ASSERT((iNumVertices > 0u) && (iNumVertices <= 0xFFFFu) && iNumIndices)
+
+    coreCookedHeader oHeader = {};
+    oHeader.iMagic       = CORE_MODEL_COOKED_MAGIC;
+    oHeader.iVersion     = CORE_MODEL_COOKED_VERSION;
+    oHeader.iNumVertices = iNumVertices;
+    oHeader.iNumIndices  = iNumIndices;
 
     // prepare index-map (for deferred remapping)
-    coreUint16* piIndexMap = TEMP_NEW(coreUint16, m_iNumVertices);
-    for(coreUintW i = 0u, ie = m_iNumVertices; i < ie; ++i) piIndexMap[i] = i & 0xFFFFu;
+    coreUint16* piIndexMap = TEMP_NEW(coreUint16, iNumVertices);
+    for(coreUintW i = 0u, ie = iNumVertices; i < ie; ++i) piIndexMap[i] = i & 0xFFFFu;
 
     // apply post-transform vertex cache optimization to index data
-    coreUint16* piOptimizedData = TEMP_NEW(coreUint16, m_iNumIndices);
-    Forsyth::OptimizeFaces(oImport.aiIndexData.data(), m_iNumIndices, m_iNumVertices, piOptimizedData);
+    coreUint16* piOptimizedData = TEMP_NEW(coreUint16, iNumIndices);
+    Forsyth::OptimizeFaces(pImport->aiIndexData.data(), iNumIndices, iNumVertices, piOptimizedData);
 
     // apply pre-transform vertex cache optimization to vertex data
     coreUint16 iCurIndex = 0u;
-    for(coreUintW i = 0u, ie = m_iNumIndices; i < ie; ++i)
+    for(coreUintW i = 0u, ie = iNumIndices; i < ie; ++i)
     {
         const coreUint16 iFirst = piOptimizedData[i];
-        ASSERT(iFirst < m_iNumVertices)
+        ASSERT(iFirst < iNumVertices)
 
         // check first map entry
         if(piIndexMap[iFirst] >= iCurIndex)
@@ -131,12 +877,12 @@ coreStatus coreModel::Load(coreFile* pFile)
             piIndexMap[iSecond] = iOld;
 
             // swap vertices
-            std::swap(oImport.aVertexData[iNew], oImport.aVertexData[iOld]);
+            std::swap(pImport->aVertexData[iNew], pImport->aVertexData[iOld]);
         }
     }
 
     // remap all indices
-    for(coreUintW i = 0u, ie = m_iNumIndices; i < ie; ++i)
+    for(coreUintW i = 0u, ie = iNumIndices; i < ie; ++i)
     {
         piOptimizedData[i] = piIndexMap[piOptimizedData[i]];
     }
@@ -145,7 +891,7 @@ coreStatus coreModel::Load(coreFile* pFile)
     coreVector3 vRangeMin = coreVector3( FLT_MAX, FLT_MAX, FLT_MAX);
     coreVector3 vRangeMax = coreVector3(-FLT_MAX,-FLT_MAX,-FLT_MAX);
     coreDouble  adSum[3]  = {};
-    FOR_EACH(it, oImport.aVertexData)
+    FOR_EACH(it, pImport->aVertexData)
     {
         // check for valid vertex attributes
         ASSERT((it->vTexCoord.x >= 0.0f)    && (it->vTexCoord.x <= 1.0f) &&
@@ -153,44 +899,40 @@ coreStatus coreModel::Load(coreFile* pFile)
                (it->vNormal.IsNormalized()) && (it->vTangent.xyz().IsNormalized()) && (ABS(it->vTangent.w) == 1.0f))
 
         // find maximum distances from the model center
-        vRangeMin.x       = MIN(vRangeMin.x,       it->vPosition.x);
-        vRangeMin.y       = MIN(vRangeMin.y,       it->vPosition.y);
-        vRangeMin.z       = MIN(vRangeMin.z,       it->vPosition.z);
-        vRangeMax.x       = MAX(vRangeMax.x,       it->vPosition.x);
-        vRangeMax.y       = MAX(vRangeMax.y,       it->vPosition.y);
-        vRangeMax.z       = MAX(vRangeMax.z,       it->vPosition.z);
-        m_fBoundingRadius = MAX(m_fBoundingRadius, it->vPosition.LengthSq());
-        adSum[0]         += coreDouble(it->vPosition.x);
-        adSum[1]         += coreDouble(it->vPosition.y);
-        adSum[2]         += coreDouble(it->vPosition.z);
-    }
-    m_vBoundingRange.x = MAX(ABS(vRangeMin.x), ABS(vRangeMax.x));
-    m_vBoundingRange.y = MAX(ABS(vRangeMin.y), ABS(vRangeMax.y));
-    m_vBoundingRange.z = MAX(ABS(vRangeMin.z), ABS(vRangeMax.z));
-    m_fBoundingRadius  = SQRT(m_fBoundingRadius);
-    m_vNaturalCenter   = (vRangeMax + vRangeMin) * 0.5f;
-    m_vNaturalRange    = (vRangeMax - vRangeMin) * 0.5f;
-    m_vWeightedCenter  = coreVector3(coreFloat(adSum[0] / coreDouble(m_iNumVertices)),
-                                     coreFloat(adSum[1] / coreDouble(m_iNumVertices)),
-                                     coreFloat(adSum[2] / coreDouble(m_iNumVertices)));
-
-    if(!HAS_FLAG(m_eLoad, CORE_MODEL_LOAD_NO_CLUSTERS))
-    {
-        // store vertex positions
-        m_pvVertexPosition = ALIGNED_NEW(coreVector3, m_iNumVertices, ALIGNMENT_CACHE);
-        for(coreUintW i = 0u, ie = m_iNumVertices; i < ie; ++i) m_pvVertexPosition[i] = oImport.aVertexData[i].vPosition;
-
+        vRangeMin.x             = MIN(vRangeMin.x,             it->vPosition.x);
+        vRangeMin.y             = MIN(vRangeMin.y,             it->vPosition.y);
+        vRangeMin.z             = MIN(vRangeMin.z,             it->vPosition.z);
+        vRangeMax.x             = MAX(vRangeMax.x,             it->vPosition.x);
+        vRangeMax.y             = MAX(vRangeMax.y,             it->vPosition.y);
+        vRangeMax.z             = MAX(vRangeMax.z,             it->vPosition.z);
+        oHeader.fBoundingRadius = MAX(oHeader.fBoundingRadius, it->vPosition.LengthSq());
+        adSum[0]               += coreDouble(it->vPosition.x);
+        adSum[1]               += coreDouble(it->vPosition.y);
+        adSum[2]               += coreDouble(it->vPosition.z);
+    }
+    oHeader.vBoundingRange.x = MAX(ABS(vRangeMin.x), ABS(vRangeMax.x));
+    oHeader.vBoundingRange.y = MAX(ABS(vRangeMin.y), ABS(vRangeMax.y));
+    oHeader.vBoundingRange.z = MAX(ABS(vRangeMin.z), ABS(vRangeMax.z));
+    oHeader.fBoundingRadius  = SQRT(oHeader.fBoundingRadius);
+    oHeader.vNaturalCenter   = (vRangeMax + vRangeMin) * 0.5f;
+    oHeader.vNaturalRange    = (vRangeMax - vRangeMin) * 0.5f;
+    oHeader.vWeightedCenter  = coreVector3(coreFloat(adSum[0] / coreDouble(iNumVertices)),
+                                           coreFloat(adSum[1] / coreDouble(iNumVertices)),
+                                           coreFloat(adSum[2] / coreDouble(iNumVertices)));
+
+    coreList<coreUint16> aiTempIndex[CORE_MODEL_CLUSTERS_MAX];
+    if(bClusters)
+    {
         // get range factor for target cluster calculations
         const coreVector3 vRangeDiff = coreVector3(1.0f,1.0f,1.0f) / (vRangeMax - vRangeMin).Processed(MAX, CORE_MATH_PRECISION);
 
         // assign triangles to different clusters based on their vertex positions (uniform grid)
-        coreList<coreUint16> aiTempIndex[CORE_MODEL_CLUSTERS_MAX];
-        for(coreUintW i = 0u, ie = m_iNumIndices; i < ie; i += 3u)
+        for(coreUintW i = 0u, ie = iNumIndices; i < ie; i += 3u)
         {
             // calculate triangle (bounding) center
-            const coreVector3 vPos1      = m_pvVertexPosition[piOptimizedData[i]];
-            const coreVector3 vPos2      = m_pvVertexPosition[piOptimizedData[i+1u]];
-            const coreVector3 vPos3      = m_pvVertexPosition[piOptimizedData[i+2u]];
+            const coreVector3 vPos1      = pImport->aVertexData[piOptimizedData[i]]   .vPosition;
+            const coreVector3 vPos2      = pImport->aVertexData[piOptimizedData[i+1u]].vPosition;
+            const coreVector3 vPos3      = pImport->aVertexData[piOptimizedData[i+2u]].vPosition;
             const coreVector3 vCenterPos = (coreVector3(MIN(vPos1.x, vPos2.x, vPos3.x), MIN(vPos1.y, vPos2.y, vPos3.y), MIN(vPos1.z, vPos2.z, vPos3.z)) +
                                             coreVector3(MAX(vPos1.x, vPos2.x, vPos3.x), MAX(vPos1.y, vPos2.y, vPos3.y), MAX(vPos1.z, vPos2.z, vPos3.z))) * 0.5f;
 
@@ -202,7 +944,7 @@ coreStatus coreModel::Load(coreFile* pFile)
 
             // reserve memory only for occupied clusters
             ASSERT(iIndex < CORE_MODEL_CLUSTERS_MAX)
-            aiTempIndex[iIndex].reserve(m_iNumIndices >> 4u);
+            aiTempIndex[iIndex].reserve(iNumIndices >> 4u);
 
             // assign triangle indices to target cluster
             aiTempIndex[iIndex].push_back(piOptimizedData[i]);
@@ -221,329 +963,491 @@ coreStatus coreModel::Load(coreFile* pFile)
         });
 
         // save number of clusters
-        m_iNumClusters = coreData::RangeIndexIf(aiTempIndex, aiTempIndex + CORE_MODEL_CLUSTERS_MAX, [](const coreList<coreUint16>& A) {return A.empty();});
-        ASSERT(m_iNumClusters)
+        oHeader.iNumClusters = coreData::RangeIndexIf(aiTempIndex, aiTempIndex + CORE_MODEL_CLUSTERS_MAX, [](const coreList<coreUint16>& A) {return A.empty();});
+        ASSERT(oHeader.iNumClusters)
+    }
 
-        // allocate cluster memory
-        coreByte* pIndexMemory = ALIGNED_NEW(coreByte,    m_iNumClusters * sizeof(coreUint16*) + m_iNumIndices * sizeof(coreUint16), ALIGNMENT_CACHE);
-        m_piClusterNumIndices  = ALIGNED_NEW(coreUint16,  m_iNumClusters,                                                            ALIGNMENT_CACHE);
-        m_pvClusterPosition    = ALIGNED_NEW(coreVector3, m_iNumClusters,                                                            ALIGNMENT_CACHE);
-        m_pfClusterRadius      = ALIGNED_NEW(coreFloat,   m_iNumClusters,                                                            ALIGNMENT_CACHE);
+    // allocate file memory (with zeroed padding)
+    const coreCookedLayout oLayout = coreModel::__CookedLayout(oHeader);
+    coreByte* pOutput = new coreByte[oLayout.iSize]();
 
-        // prepare index pointers to use only single allocation (also to keep indirections as near as possible)
-        m_ppiClusterIndex    = r_cast<coreUint16**>(pIndexMemory);
-        m_ppiClusterIndex[0] = r_cast<coreUint16*> (pIndexMemory + m_iNumClusters * sizeof(coreUint16*));
-        for(coreUintW i = 1u, ie = m_iNumClusters; i < ie; ++i) m_ppiClusterIndex[i] = m_ppiClusterIndex[0];
+    // write file header
+    std::memcpy(pOutput, &oHeader, sizeof(coreCookedHeader));
 
-        for(coreUintW i = 0u, ie = m_iNumClusters; i < ie; ++i)
-        {
-            // save number of indices
-            m_piClusterNumIndices[i] = aiTempIndex[i].size();
-            ASSERT(m_piClusterNumIndices[i])
-
-            // adjust index pointers and store indices
-            for(coreUintW j = i + 1u, je = m_iNumClusters; j < je; ++j) m_ppiClusterIndex[j] += m_piClusterNumIndices[i];
-            std::memcpy(m_ppiClusterIndex[i], aiTempIndex[i].data(), m_piClusterNumIndices[i] * sizeof(coreUint16));
-
-            // find the cluster center
-            coreVector3 vClusterMin = coreVector3( FLT_MAX, FLT_MAX, FLT_MAX);
-            coreVector3 vClusterMax = coreVector3(-FLT_MAX,-FLT_MAX,-FLT_MAX);
-            for(coreUintW j = 0u, je = m_piClusterNumIndices[i]; j < je; ++j)
-            {
-                const coreVector3 vPosition = m_pvVertexPosition[m_ppiClusterIndex[i][j]];
-
-                vClusterMin.x = MIN(vClusterMin.x, vPosition.x);
-                vClusterMin.y = MIN(vClusterMin.y, vPosition.y);
-                vClusterMin.z = MIN(vClusterMin.z, vPosition.z);
-                vClusterMax.x = MAX(vClusterMax.x, vPosition.x);
-                vClusterMax.y = MAX(vClusterMax.y, vPosition.y);
-                vClusterMax.z = MAX(vClusterMax.z, vPosition.z);
-            }
-            m_pvClusterPosition[i] = (vClusterMax + vClusterMin) * 0.5f;
+    // write optimized index data
+    std::memcpy(pOutput + oLayout.iIndex, piOptimizedData, iNumIndices * sizeof(coreUint16));
 
-            // find maximum distance from the cluster center
-            coreFloat fClusterRadiusSq = 0.0f;
-            for(coreUintW j = 0u, je = m_piClusterNumIndices[i]; j < je; ++j)
-            {
-                fClusterRadiusSq = MAX(fClusterRadiusSq, (m_pvVertexPosition[m_ppiClusterIndex[i][j]] - m_pvClusterPosition[i]).LengthSq());
-            }
-            m_pfClusterRadius[i] = SQRT(fClusterRadiusSq);
-        }
+    coreByte* pHigh = pOutput + oLayout.iVertexHigh;
+    coreByte* pLow  = pOutput + oLayout.iVertexLow;
+    for(coreUintW i = 0u, ie = iNumVertices; i < ie; ++i)
+    {
+        const coreVertex& oVertex = pImport->aVertexData[i];
+
+        // reduce total vertex size (high quality compression, de-interleaved)
+        const coreUint64 iHighPosition = coreVector4(oVertex.vPosition, 0.0f).PackFloat4x16();
+        const coreUint32 iTexCoord     = oVertex.vTexCoord                   .PackUnorm2x16();
+        const coreUint32 iHighNormal   = coreVector4(oVertex.vNormal,   0.0f).PackSnorm210 ();
+        const coreUint32 iHighTangent  = oVertex.vTangent                    .PackSnorm210 ();
+
+        std::memcpy(pHigh                       + i * 8u, &iHighPosition, 8u);
+        std::memcpy(pHigh +  8u * iNumVertices  + i * 4u, &iTexCoord,     4u);
+        std::memcpy(pHigh + 12u * iNumVertices  + i * 4u, &iHighNormal,   4u);
+        std::memcpy(pHigh + 16u * iNumVertices  + i * 4u, &iHighTangent,  4u);
+
+        // reduce total vertex size (low quality compression, de-interleaved)
+        const coreUint32 iLowNormal  = coreVector4(oVertex.vNormal, 0.0f).PackSnorm4x8();
+        const coreUint32 iLowTangent = oVertex.vTangent                  .PackSnorm4x8();
+
+        std::memcpy(pLow                        + i * 12u, &oVertex.vPosition, 12u);
+        std::memcpy(pLow + 12u * iNumVertices   + i *  4u, &iTexCoord,         4u);
+        std::memcpy(pLow + 16u * iNumVertices   + i *  4u, &iLowNormal,        4u);
+        std::memcpy(pLow + 20u * iNumVertices   + i *  4u, &iLowTangent,       4u);
     }
 
-    if(!HAS_FLAG(m_eLoad, CORE_MODEL_LOAD_NO_BUFFERS) || Core::Debug->IsEnabled())   // # for debug drawing
+    coreUintW iClusterOffset = 0u;
+    for(coreUintW i = 0u, ie = oHeader.iNumClusters; i < ie; ++i)
     {
-        if(CORE_GL_SUPPORT(ARB_vertex_type_2_10_10_10_rev) && CORE_GL_SUPPORT(ARB_half_float_vertex))
-        {
-            // reduce total vertex size (high quality compression, de-interleaved)
-            coreByte* pPackedData = TEMP_NEW(coreByte, 20u * m_iNumVertices);
-            for(coreUintW i = 0u, ie = m_iNumVertices; i < ie; ++i)
-            {
-                const coreVertex& oVertex = oImport.aVertexData[i];
+        const coreList<coreUint16>& aiIndex = aiTempIndex[i];
 
-                // convert vertex attributes
-                r_cast<coreUint64*>(pPackedData)                       [i] = coreVector4(oVertex.vPosition, 0.0f).PackFloat4x16();
-                r_cast<coreUint32*>(pPackedData +  8u * m_iNumVertices)[i] = oVertex.vTexCoord                   .PackUnorm2x16();
-                r_cast<coreUint32*>(pPackedData + 12u * m_iNumVertices)[i] = coreVector4(oVertex.vNormal,   0.0f).PackSnorm210 ();
-                r_cast<coreUint32*>(pPackedData + 16u * m_iNumVertices)[i] = oVertex.vTangent                    .PackSnorm210 ();
-            }
-
-            // create vertex buffer
-            coreVertexBuffer* pBuffer = this->CreateVertexBuffer(m_iNumVertices, 20u, pPackedData, CORE_DATABUFFER_STORAGE_STATIC);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_POSITION_NUM, CORE_VERTEX_SPEC_FLOAT_4X16, 0u,  0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TEXCOORD_NUM, CORE_VERTEX_SPEC_UNORM_2X16, 8u,  0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_NORMAL_NUM,   CORE_VERTEX_SPEC_SNORM_210,  12u, 0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TANGENT_NUM,  CORE_VERTEX_SPEC_SNORM_210,  16u, 0u);
-            TEMP_DELETE(pPackedData)
-        }
-        else
+        // find the cluster center
+        coreVector3 vClusterMin = coreVector3( FLT_MAX, FLT_MAX, FLT_MAX);
+        coreVector3 vClusterMax = coreVector3(-FLT_MAX,-FLT_MAX,-FLT_MAX);
+        FOR_EACH(it, aiIndex)
         {
-            // reduce total vertex size (low quality compression, de-interleaved)
-            coreByte* pPackedData = TEMP_NEW(coreByte, 24u * m_iNumVertices);
-            for(coreUintW i = 0u, ie = m_iNumVertices; i < ie; ++i)
-            {
-                const coreVertex& oVertex = oImport.aVertexData[i];
-
-                // convert vertex attributes
-                r_cast<coreVector3*>(pPackedData)                       [i] = oVertex.vPosition;
-                r_cast<coreUint32*> (pPackedData + 12u * m_iNumVertices)[i] = oVertex.vTexCoord                 .PackUnorm2x16();
-                r_cast<coreUint32*> (pPackedData + 16u * m_iNumVertices)[i] = coreVector4(oVertex.vNormal, 0.0f).PackSnorm4x8 ();
-                r_cast<coreUint32*> (pPackedData + 20u * m_iNumVertices)[i] = oVertex.vTangent                  .PackSnorm4x8 ();
-            }
-
-            // create vertex buffer
-            coreVertexBuffer* pBuffer = this->CreateVertexBuffer(m_iNumVertices, 24u, pPackedData, CORE_DATABUFFER_STORAGE_STATIC);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_POSITION_NUM, CORE_VERTEX_SPEC_FLOAT_3X32, 0u,  0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TEXCOORD_NUM, CORE_VERTEX_SPEC_UNORM_2X16, 12u, 0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_NORMAL_NUM,   CORE_VERTEX_SPEC_SNORM_4X8,  16u, 0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TANGENT_NUM,  CORE_VERTEX_SPEC_SNORM_4X8,  20u, 0u);
-            TEMP_DELETE(pPackedData)
+            const coreVector3 vPosition = pImport->aVertexData[*it].vPosition;
+
+            vClusterMin.x = MIN(vClusterMin.x, vPosition.x);
+            vClusterMin.y = MIN(vClusterMin.y, vPosition.y);
+            vClusterMin.z = MIN(vClusterMin.z, vPosition.z);
+            vClusterMax.x = MAX(vClusterMax.x, vPosition.x);
+            vClusterMax.y = MAX(vClusterMax.y, vPosition.y);
+            vClusterMax.z = MAX(vClusterMax.z, vPosition.z);
         }
+        const coreVector3 vClusterPosition = (vClusterMax + vClusterMin) * 0.5f;
 
-        // create index buffer
-        this->CreateIndexBuffer(m_iNumIndices, sizeof(coreUint16), piOptimizedData, CORE_DATABUFFER_STORAGE_STATIC);
-
-        if(Core::Debug->IsEnabled() && !m_sName.empty())
+        // find maximum distance from the cluster center
+        coreFloat fClusterRadiusSq = 0.0f;
+        FOR_EACH(it, aiIndex)
         {
-            // add debug label
-            Core::Graphics->LabelOpenGL(GL_BUFFER, m_aVertexBuffer.front().GetIdentifier(), PRINT("%s.vertex", m_sName.c_str()));
-            Core::Graphics->LabelOpenGL(GL_BUFFER, m_IndexBuffer          .GetIdentifier(), PRINT("%s.index",  m_sName.c_str()));
+            fClusterRadiusSq = MAX(fClusterRadiusSq, (pImport->aVertexData[*it].vPosition - vClusterPosition).LengthSq());
         }
+        const coreFloat  fClusterRadius = SQRT(fClusterRadiusSq);
+        const coreUint16 iClusterNum    = aiIndex.size();
+
+        // write cluster data
+        std::memcpy(pOutput + oLayout.iClusterNum      + i * sizeof(coreUint16),  &iClusterNum,      sizeof(coreUint16));
+        std::memcpy(pOutput + oLayout.iClusterPosition + i * sizeof(coreVector3), &vClusterPosition, sizeof(coreVector3));
+        std::memcpy(pOutput + oLayout.iClusterRadius   + i * sizeof(coreFloat),   &fClusterRadius,   sizeof(coreFloat));
+        std::memcpy(pOutput + oLayout.iClusterIndex    + iClusterOffset,          aiIndex.data(),    iClusterNum * sizeof(coreUint16));
+
+        iClusterOffset += iClusterNum * sizeof(coreUint16);
     }
+    ASSERT(iClusterOffset == (oHeader.iNumClusters ? (iNumIndices * sizeof(coreUint16)) : 0u))
 
     // free index data
     TEMP_DELETE(piIndexMap)
     TEMP_DELETE(piOptimizedData)
 
-    Core::Log->Info("Model (%s, %u vertices, %u indices, %u clusters, %.5f x %.5f x %.5f range, %.5f radius) loaded", m_sName.c_str(), m_iNumVertices, m_iNumIndices, m_iNumClusters, m_vBoundingRange.x, m_vBoundingRange.y, m_vBoundingRange.z, m_fBoundingRadius);
-    return m_Sync.Create(CORE_SYNC_CREATE_FLUSHED) ? CORE_BUSY : CORE_OK;
+    (*piSize) = oLayout.iSize;
+    return pOutput;
 }
 
 
 // ****************************************************************
-/* unload model resource data */
-coreStatus coreModel::Unload()
+/* build bounding volume hierarchy (from cluster index data) */
+void coreModel::__BuildBvh()
 {
-    if(!m_iNumVertices) return CORE_INVALID_CALL;
+    ASSERT(m_pvVertexPosition && m_iNumClusters && !m_pBvhNode)
 
-    // disable still active model
-    if(s_pCurrent == this) coreModel::Disable(true);
+    const coreUint32 iNumTriangles = m_iNumIndices / 3u;
+    if(!iNumTriangles) return;
 
-    // delete all data buffers
-    m_aVertexBuffer.clear();
-    m_IndexBuffer.Delete();
+    // use triangle indices in cluster order (same triangles, to map each one back to its cluster)
+    const coreUint16* aiIndex = m_ppiClusterIndex[0];
 
-    // free cluster memory
-    if(m_iNumClusters)
+    coreList<coreUint8> aiCluster;
+    aiCluster.reserve(iNumTriangles);
+    for(coreUintW i = 0u, ie = m_iNumClusters; i < ie; ++i)
     {
-        ALIGNED_DELETE(m_pvVertexPosition)
-        ALIGNED_DELETE(m_ppiClusterIndex)
-        ALIGNED_DELETE(m_piClusterNumIndices)
-        ALIGNED_DELETE(m_pvClusterPosition)
-        ALIGNED_DELETE(m_pfClusterRadius)
+        ASSERT(!(m_piClusterNumIndices[i] % 3u))
+        aiCluster.insert(aiCluster.end(), m_piClusterNumIndices[i] / 3u, coreUint8(i));
     }
+    ASSERT(aiCluster.size() == iNumTriangles)
 
-    // delete vertex array object
-    if(m_iVertexArray) coreDelVertexArrays(1u, &m_iVertexArray);
-    if(!m_sName.empty()) Core::Log->Info("Model (%s) unloaded", m_sName.c_str());
+    // create build references (with slightly padded bounds, to stay conservative against rounding)
+    const coreVector3 vPadding = coreVector3(1.0f,1.0f,1.0f) * (MAX(m_vBoundingRange.Max(), 1.0f) * 1.0e-5f);
 
-    // delete sync object
-    m_Sync.Delete();
+    coreList<coreBvhRef> aRef;
+    aRef.resize(iNumTriangles);
+    for(coreUintW i = 0u; i < iNumTriangles; ++i)
+    {
+        const coreVector3& A = m_pvVertexPosition[aiIndex[i*3u + 0u]];
+        const coreVector3& B = m_pvVertexPosition[aiIndex[i*3u + 1u]];
+        const coreVector3& C = m_pvVertexPosition[aiIndex[i*3u + 2u]];
+
+        coreBvhRef& oRef = aRef[i];
+        oRef.vMin      = coreVector3(MIN(A.x, B.x, C.x), MIN(A.y, B.y, C.y), MIN(A.z, B.z, C.z)) - vPadding;
+        oRef.vMax      = coreVector3(MAX(A.x, B.x, C.x), MAX(A.y, B.y, C.y), MAX(A.z, B.z, C.z)) + vPadding;
+        oRef.vCenter   = (oRef.vMin + oRef.vMax) * 0.5f;
+        oRef.iTriangle = i;
+    }
 
-    // reset properties
-    m_iVertexArray    = 0u;
-    m_iNumVertices    = 0u;
-    m_iNumIndices     = 0u;
-    m_iNumClusters    = 0u;
-    m_vBoundingRange  = coreVector3(0.0f,0.0f,0.0f);
-    m_fBoundingRadius = 0.0f;
-    m_vNaturalCenter  = coreVector3(0.0f,0.0f,0.0f);
-    m_vNaturalRange   = coreVector3(0.0f,0.0f,0.0f);
-    m_vWeightedCenter = coreVector3(0.0f,0.0f,0.0f);
-    m_iPrimitiveType  = GL_TRIANGLES;
-    m_iIndexType      = 0u;
+    // build all nodes recursively
+    coreList<coreBvhNode> aNode;
+    aNode.reserve(iNumTriangles / 2u + 1u);
+    coreModel::__BuildBvhNode(&aNode, aRef.data(), 0u, iNumTriangles, 0u);
 
-    return CORE_OK;
+    // move nodes into aligned memory
+    m_iNumBvhNodes = aNode.size();
+    m_pBvhNode     = ALIGNED_NEW(coreBvhNode, m_iNumBvhNodes, ALIGNMENT_CACHE);
+    std::memcpy(m_pBvhNode, aNode.data(), m_iNumBvhNodes * sizeof(coreBvhNode));
+
+    // store triangle indices and clusters in leaf order
+    m_piBvhIndex   = ALIGNED_NEW(coreUint16, iNumTriangles * 3u, ALIGNMENT_CACHE);
+    m_piBvhCluster = ALIGNED_NEW(coreUint8,  iNumTriangles,      ALIGNMENT_CACHE);
+    for(coreUintW i = 0u; i < iNumTriangles; ++i)
+    {
+        std::memcpy(m_piBvhIndex + i * 3u, aiIndex + aRef[i].iTriangle * 3u, 3u * sizeof(coreUint16));
+        m_piBvhCluster[i] = aiCluster[aRef[i].iTriangle];
+    }
 }
 
 
 // ****************************************************************
-/* draw the model */
-void coreModel::DrawArrays()const
+/* build single bounding volume hierarchy node (returns node index) */
+coreUint32 coreModel::__BuildBvhNode(coreList<coreBvhNode>* OUTPUT paNode, coreBvhRef* OUTPUT pRef, const coreUint32 iFirst, const coreUint32 iCount, const coreUint32 iDepth)
 {
-    // draw the model (without index buffer)
-    ASSERT((s_pCurrent == this) || !s_pCurrent)
-    glDrawArrays(m_iPrimitiveType, 0, m_iNumVertices);
+    ASSERT(paNode && pRef && iCount)
 
-    // update debug counters
-    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_DRAW_CALLS, 1u);
-    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_INSTANCES,  1u);
-}
+    // reserve node (written at the end, because recursion may re-allocate)
+    const coreUint32 iIndex = paNode->size();
+    paNode->emplace_back();
 
-void coreModel::DrawElements()const
-{
-    // draw the model (with index buffer)
-    ASSERT(((s_pCurrent == this) || !s_pCurrent) && m_IndexBuffer.IsValid())
-    glDrawRangeElements(m_iPrimitiveType, 0u, m_iNumVertices - 1u, m_iNumIndices, m_iIndexType, NULL);
+    // split range into up to four children (always the largest one)
+    coreUint32 aiFirst[4] = {iFirst};
+    coreUint32 aiCount[4] = {iCount};
+    coreUintW  iNum       = 1u;
+    while(iNum < 4u)
+    {
+        coreUintW iLargest = 0u;
+        for(coreUintW i = 1u; i < iNum; ++i)
+        {
+            if(aiCount[i] > aiCount[iLargest]) iLargest = i;
+        }
+        if(aiCount[iLargest] <= CORE_MODEL_BVH_LEAF) break;
 
-    // update debug counters
-    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_DRAW_CALLS, 1u);
-    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_INSTANCES,  1u);
-}
+        const coreUint32 iSplit = coreModel::__SplitBvh(pRef + aiFirst[iLargest], aiCount[iLargest], iDepth >= CORE_MODEL_BVH_SAH);
+        ASSERT(iSplit && (iSplit < aiCount[iLargest]))
 
+        aiFirst[iNum]     = aiFirst[iLargest] + iSplit;
+        aiCount[iNum]     = aiCount[iLargest] - iSplit;
+        aiCount[iLargest] = iSplit;
+        ++iNum;
+    }
 
-// ****************************************************************
-/* draw the model instanced */
-void coreModel::DrawArraysInstanced(const coreUint32 iCount)const
-{
-    // draw the model instanced (without index buffer)
-    ASSERT(((s_pCurrent == this) || !s_pCurrent) && iCount)
-    glDrawArraysInstanced(m_iPrimitiveType, 0, m_iNumVertices, iCount);
+    coreBvhNode oNode = {};
+    for(coreUintW i = 0u; i < iNum; ++i)
+    {
+        // calculate child bounds
+        coreVector3 vMin = pRef[aiFirst[i]].vMin;
+        coreVector3 vMax = pRef[aiFirst[i]].vMax;
+        for(coreUintW j = aiFirst[i] + 1u, je = aiFirst[i] + aiCount[i]; j < je; ++j)
+        {
+            vMin = coreVector3(MIN(vMin.x, pRef[j].vMin.x), MIN(vMin.y, pRef[j].vMin.y), MIN(vMin.z, pRef[j].vMin.z));
+            vMax = coreVector3(MAX(vMax.x, pRef[j].vMax.x), MAX(vMax.y, pRef[j].vMax.y), MAX(vMax.z, pRef[j].vMax.z));
+        }
+        for(coreUintW k = 0u; k < 3u; ++k)
+        {
+            oNode.afMin[k][i] = vMin.arr(k);
+            oNode.afMax[k][i] = vMax.arr(k);
+        }
 
-    // update debug counters
-    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_DRAW_CALLS, 1u);
-    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_INSTANCES,  iCount);
-}
+        // create leaf or continue recursively
+        if(aiCount[i] <= CORE_MODEL_BVH_LEAF)
+        {
+            oNode.aiChild[i] = aiFirst[i];
+            oNode.aiCount[i] = aiCount[i];
+        }
+        else
+        {
+            oNode.aiChild[i] = coreModel::__BuildBvhNode(paNode, pRef, aiFirst[i], aiCount[i], iDepth + 1u);
+        }
 
-void coreModel::DrawElementsInstanced(const coreUint32 iCount)const
-{
-    // draw the model instanced (with index buffer)
-    ASSERT(((s_pCurrent == this) || !s_pCurrent) && m_IndexBuffer.IsValid() && iCount)
-    glDrawElementsInstanced(m_iPrimitiveType, m_iNumIndices, m_iIndexType, NULL, iCount);
+        ADD_BIT(oNode.iValid, i)
+    }
 
-    // update debug counters
-    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_DRAW_CALLS, 1u);
-    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_INSTANCES,  iCount);
+    (*paNode)[iIndex] = oNode;
+    return iIndex;
 }
 
 
 // ****************************************************************
-/* enable the model */
-void coreModel::Enable()
+/* split build references into two sets (returns size of the first set) */
+coreUint32 coreModel::__SplitBvh(coreBvhRef* OUTPUT pRef, const coreUint32 iCount, const coreBool bMedian)
 {
-    ASSERT(!m_aVertexBuffer.empty())
+    ASSERT(pRef && (iCount >= 2u))
 
-    // check and save current model object
-    if(s_pCurrent == this) return;
-    s_pCurrent = this;
+    // find bounds of all centers
+    coreVector3 vMin = pRef[0].vCenter;
+    coreVector3 vMax = pRef[0].vCenter;
+    for(coreUintW i = 1u; i < iCount; ++i)
+    {
+        vMin = coreVector3(MIN(vMin.x, pRef[i].vCenter.x), MIN(vMin.y, pRef[i].vCenter.y), MIN(vMin.z, pRef[i].vCenter.z));
+        vMax = coreVector3(MAX(vMax.x, pRef[i].vCenter.x), MAX(vMax.y, pRef[i].vCenter.y), MAX(vMax.z, pRef[i].vCenter.z));
+    }
 
-    // bind vertex array object
-    if(m_iVertexArray) glBindVertexArray(m_iVertexArray);
-    else
+    // split along the longest axis
+    const coreUintW iAxis  = (vMax - vMin).MaxDimension();
+    const coreFloat fStart = vMin.arr(iAxis);
+    const coreFloat fWidth = vMax.arr(iAxis) - fStart;
+
+    if(!bMedian && (fWidth > 0.0f))
     {
-        if(CORE_GL_SUPPORT(ARB_vertex_array_object))
-        {
-            // create vertex array object
-            coreGenVertexArrays(1u, &m_iVertexArray);
-            glBindVertexArray(m_iVertexArray);
+        constexpr coreUintW iBins = 8u;
 
-            // force binding of index data
-            coreDataBuffer::Unbind(GL_ELEMENT_ARRAY_BUFFER, false);
+        const auto nBinFunc  = [&](const coreBvhRef& oRef) {return MIN(coreUintW(F_TO_UI((oRef.vCenter.arr(iAxis) - fStart) / fWidth * I_TO_F(iBins))), iBins - 1u);};
+        const auto nAreaFunc = [](const coreVector3 vLow, const coreVector3 vHigh) {const coreVector3 D = vHigh - vLow; return D.x * D.y + D.y * D.z + D.z * D.x;};
+        const auto nMergeFunc = [](coreVector3* OUTPUT pvLow, coreVector3* OUTPUT pvHigh, const coreVector3 vLow, const coreVector3 vHigh)
+        {
+            (*pvLow)  = coreVector3(MIN(pvLow ->x, vLow .x), MIN(pvLow ->y, vLow .y), MIN(pvLow ->z, vLow .z));
+            (*pvHigh) = coreVector3(MAX(pvHigh->x, vHigh.x), MAX(pvHigh->y, vHigh.y), MAX(pvHigh->z, vHigh.z));
+        };
+
+        // sort all references into bins
+        coreUint32  aiBinCount[iBins] = {};
+        coreVector3 avBinMin  [iBins];
+        coreVector3 avBinMax  [iBins];
+        for(coreUintW i = 0u; i < iBins; ++i)
+        {
+            avBinMin[i] = coreVector3( FLT_MAX, FLT_MAX, FLT_MAX);
+            avBinMax[i] = coreVector3(-FLT_MAX,-FLT_MAX,-FLT_MAX);
+        }
+        for(coreUintW i = 0u; i < iCount; ++i)
+        {
+            const coreUintW iBin = nBinFunc(pRef[i]);
+            aiBinCount[iBin] += 1u;
+            nMergeFunc(&avBinMin[iBin], &avBinMax[iBin], pRef[i].vMin, pRef[i].vMax);
+        }
 
-            // add debug label
-            Core::Graphics->LabelOpenGL(GL_VERTEX_ARRAY, m_iVertexArray, m_sName.c_str());
+        // accumulate costs of all right sides
+        coreFloat   afRightCost[iBins] = {};
+        coreVector3 vRightMin   = coreVector3( FLT_MAX, FLT_MAX, FLT_MAX);
+        coreVector3 vRightMax   = coreVector3(-FLT_MAX,-FLT_MAX,-FLT_MAX);
+        coreUint32  iRightCount = 0u;
+        for(coreUintW i = iBins - 1u; i; --i)
+        {
+            iRightCount += aiBinCount[i];
+            nMergeFunc(&vRightMin, &vRightMax, avBinMin[i], avBinMax[i]);
+            if(iRightCount) afRightCost[i] = nAreaFunc(vRightMin, vRightMax) * I_TO_F(iRightCount);
         }
 
-        // set vertex data
-        for(coreUintW i = 0u, ie = m_aVertexBuffer.size(); i < ie; ++i)
+        // find split with the lowest surface area heuristic
+        coreVector3 vLeftMin   = coreVector3( FLT_MAX, FLT_MAX, FLT_MAX);
+        coreVector3 vLeftMax   = coreVector3(-FLT_MAX,-FLT_MAX,-FLT_MAX);
+        coreUint32  iLeftCount = 0u;
+        coreFloat   fBestCost  = FLT_MAX;
+        coreUintW   iBestBin   = 0u;
+        for(coreUintW i = 0u; i < iBins - 1u; ++i)
         {
-            m_aVertexBuffer[i].Activate(0u);
+            iLeftCount += aiBinCount[i];
+            nMergeFunc(&vLeftMin, &vLeftMax, avBinMin[i], avBinMax[i]);
+            if(!iLeftCount || (iLeftCount == iCount)) continue;
+
+            const coreFloat fCost = nAreaFunc(vLeftMin, vLeftMax) * I_TO_F(iLeftCount) + afRightCost[i + 1u];
+            if(fCost < fBestCost)
+            {
+                fBestCost = fCost;
+                iBestBin  = i + 1u;
+            }
         }
 
-        // set index data
-        if(m_IndexBuffer.IsValid()) m_IndexBuffer.Bind();
+        if(iBestBin)
+        {
+            // partition references by bin
+            const coreBvhRef* pSplit = std::partition(pRef, pRef + iCount, [&](const coreBvhRef& oRef) {return (nBinFunc(oRef) < iBestBin);});
+            return (pSplit - pRef);
+        }
     }
 
-    // update debug counters
-    Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_BINDS_MODEL, 1u);
+    // fall back to median split
+    const coreUint32 iHalf = iCount / 2u;
+    std::nth_element(pRef, pRef + iHalf, pRef + iCount, [&](const coreBvhRef& A, const coreBvhRef& B) {return (A.vCenter.arr(iAxis) < B.vCenter.arr(iAxis));});
+    return iHalf;
 }
 
 
 // ****************************************************************
-/* disable the model */
-void coreModel::Disable(const coreBool bFull)
+/* test query against all children of a node (returns mask of touched children) */
+coreUint32 coreModel::__TestBvhNode(const coreBvhNode& oNode, const coreBvhQuery& oQuery)
 {
-    // reset current model object
-    s_pCurrent = NULL;
+    // scale all child bounds (negative scale swaps lower and upper bounds)
+    coreLane avMin[3], avMax[3];
+    for(coreUintW i = 0u; i < 3u; ++i)
+    {
+        const coreLane S = coreLaneSet(oQuery.vScale.arr(i));
+        const coreLane A = coreLaneMul(coreLaneLoad(oNode.afMin[i]), S);
+        const coreLane B = coreLaneMul(coreLaneLoad(oNode.afMax[i]), S);
 
-    coreBool bFullUnbind = false;
-    if(bFull)
+        avMin[i] = coreLaneMin(A, B);
+        avMax[i] = coreLaneMax(A, B);
+    }
+
+    coreUint32 iMask;
+    switch(oQuery.iShape)
     {
-        // unbind vertex array object
-        if(CORE_GL_SUPPORT(ARB_vertex_array_object)) glBindVertexArray(0u);
-        else bFullUnbind = true;
+    default: UNREACHABLE
+
+    case 0u:
+        {
+            // intersect ray with all slabs
+            coreLane vNear = coreLaneSet(0.0f);
+            coreLane vFar  = coreLaneSet(FLT_MAX);
+            for(coreUintW i = 0u; i < 3u; ++i)
+            {
+                const coreLane P  = coreLaneSet(oQuery.vPosition.arr(i));
+                const coreLane D  = coreLaneSet(oQuery.vInvDir  .arr(i));
+                const coreLane T1 = coreLaneMul(coreLaneSub(avMin[i], P), D);
+                const coreLane T2 = coreLaneMul(coreLaneSub(avMax[i], P), D);
+
+                vNear = coreLaneMax(vNear, coreLaneMin(T1, T2));
+                vFar  = coreLaneMin(vFar,  coreLaneMax(T1, T2));
+            }
+
+            iMask = coreLaneLessEqual(vNear, vFar);
+        }
+        break;
+
+    case 1u:
+        {
+            // calculate squared distance between sphere center and all boxes
+            coreLane vDistSq = coreLaneSet(0.0f);
+            for(coreUintW i = 0u; i < 3u; ++i)
+            {
+                const coreLane C = coreLaneSet(oQuery.vPosition.arr(i));
+                const coreLane D = coreLaneMax(coreLaneMax(coreLaneSub(avMin[i], C), coreLaneSub(C, avMax[i])), coreLaneSet(0.0f));
+
+                vDistSq = coreLaneAdd(vDistSq, coreLaneMul(D, D));
+            }
+
+            iMask = coreLaneLessEqual(vDistSq, coreLaneSet(POW2(oQuery.fRadius)));
+        }
+        break;
+
+    case 2u:
+        {
+            const coreLane H = coreLaneSet(0.5f);
+
+            // test node axes
+            coreLane avDiff[3], avHalf[3];
+            iMask = 0xFu;
+            for(coreUintW i = 0u; i < 3u; ++i)
+            {
+                avDiff[i] = coreLaneSub(coreLaneMul(coreLaneAdd(avMin[i], avMax[i]), H), coreLaneSet(oQuery.vPosition.arr(i)));
+                avHalf[i] = coreLaneMul(coreLaneSub(avMax[i], avMin[i]), H);
+
+                iMask &= coreLaneLessEqual(coreLaneAbs(avDiff[i]), coreLaneAdd(avHalf[i], coreLaneSet(oQuery.vProject.arr(i))));
+            }
+
+            // test box axes
+            for(coreUintW i = 0u; i < 3u; ++i)
+            {
+                const coreVector3& A = oQuery.avAxis[i];
+
+                const coreLane vDist  = coreLaneAbs(coreLaneAdd(coreLaneAdd(coreLaneMul(avDiff[0], coreLaneSet(A.x)), coreLaneMul(avDiff[1], coreLaneSet(A.y))), coreLaneMul(avDiff[2], coreLaneSet(A.z))));
+                const coreLane vReach = coreLaneAdd(coreLaneSet(oQuery.vExtent.arr(i)), coreLaneAdd(coreLaneAdd(coreLaneMul(avHalf[0], coreLaneSet(ABS(A.x))), coreLaneMul(avHalf[1], coreLaneSet(ABS(A.y)))), coreLaneMul(avHalf[2], coreLaneSet(ABS(A.z)))));
+
+                iMask &= coreLaneLessEqual(vDist, vReach);
+            }
+        }
+        break;
     }
 
-    // unbind data buffers
-    coreDataBuffer::Unbind(GL_ARRAY_BUFFER,         bFullUnbind);
-    coreDataBuffer::Unbind(GL_ELEMENT_ARRAY_BUFFER, bFullUnbind);
+    return (iMask & oNode.iValid);
 }
 
 
 // ****************************************************************
-/* create vertex buffer */
-coreVertexBuffer* coreModel::CreateVertexBuffer(const coreUint32 iNumVertices, const coreUint8 iVertexSize, const void* pVertexData, const coreDataBufferStorage eStorageType)
+/* check for cooked model */
+coreBool coreModel::IsCooked(coreFile* pFile)
 {
-    ASSERT(!m_iVertexArray)
+    if(!pFile || (pFile->GetSize() < sizeof(coreCookedHeader))) return false;
 
-    // save properties
-    if(m_aVertexBuffer.empty()) m_iNumVertices = iNumVertices;
-    ASSERT(m_iNumVertices && (m_iNumVertices == iNumVertices))
+    // compare magic number
+    coreUint32 iMagic;
+    std::memcpy(&iMagic, pFile->GetData(), sizeof(coreUint32));
+    return (iMagic == CORE_MODEL_COOKED_MAGIC);
+}
 
-    // create vertex buffer
-    m_aVertexBuffer.emplace_back().Create(iNumVertices, iVertexSize, pVertexData, eStorageType);
 
-    // disable current model object (to fully enable the next model)
-    coreModel::Disable(false);
+// ****************************************************************
+/* calculate byte offsets of all cooked data */
+coreModel::coreCookedLayout coreModel::__CookedLayout(const coreCookedHeader& oHeader)
+{
+    coreCookedLayout oLayout;
+    coreUint32       iCursor = sizeof(coreCookedHeader);
 
-    return &m_aVertexBuffer.back();
+    // keep every section 4-byte aligned (relative to the file start)
+    const auto nSectionFunc = [&](const coreUint32 iSize)
+    {
+        const coreUint32 iOffset = iCursor;
+        iCursor = (iCursor + iSize + 3u) & ~3u;
+        return iOffset;
+    };
+
+    const coreUint32 iIndexSize   = oHeader.iNumIndices  * sizeof(coreUint16);
+    const coreUint32 iClusterSize = oHeader.iNumClusters ? iIndexSize : 0u;
+
+    oLayout.iVertexHigh      = nSectionFunc(oHeader.iNumVertices * 20u);
+    oLayout.iVertexLow       = nSectionFunc(oHeader.iNumVertices * 24u);
+    oLayout.iIndex           = nSectionFunc(iIndexSize);
+    oLayout.iClusterNum      = nSectionFunc(oHeader.iNumClusters * sizeof(coreUint16));
+    oLayout.iClusterPosition = nSectionFunc(oHeader.iNumClusters * sizeof(coreVector3));
+    oLayout.iClusterRadius   = nSectionFunc(oHeader.iNumClusters * sizeof(coreFloat));
+    oLayout.iClusterIndex    = nSectionFunc(iClusterSize);
+    oLayout.iSize            = iCursor;
+
+    return oLayout;
 }
 
 
 // ****************************************************************
-/* create index buffer */
-coreDataBuffer* coreModel::CreateIndexBuffer(const coreUint32 iNumIndices, const coreUint8 iIndexSize, const void* pIndexData, const coreDataBufferStorage eStorageType)
+/* check consistency of all cooked data (before anything is uploaded) */
+coreBool coreModel::__CheckCooked(const coreByte* pData, const coreCookedHeader& oHeader, const coreCookedLayout& oLayout)
 {
-    ASSERT(!m_iVertexArray && !m_IndexBuffer.IsValid())
+    ASSERT(pData && (oLayout.iSize >= sizeof(coreCookedHeader)))
 
-    // save properties
-    m_iNumIndices = iNumIndices;
-    ASSERT(m_iNumIndices)
+    // check for complete triangles
+    if(oHeader.iNumIndices % 3u) return false;
 
-    // detect index type
-    switch(iIndexSize)
+    // check all indices against the number of vertices (may not be aligned)
+    const auto nIndexFunc = [&](const coreUint32 iOffset)
     {
-    default: UNREACHABLE
-    case 4u: m_iIndexType = GL_UNSIGNED_INT;   break;
-    case 2u: m_iIndexType = GL_UNSIGNED_SHORT; break;
-    case 1u: m_iIndexType = GL_UNSIGNED_BYTE;  break;
-    }
+        for(coreUintW i = 0u, ie = oHeader.iNumIndices; i < ie; ++i)
+        {
+            coreUint16 iIndex;
+            std::memcpy(&iIndex, pData + iOffset + i * sizeof(coreUint16), sizeof(coreUint16));
+            if(iIndex >= oHeader.iNumVertices) return false;
+        }
+        return true;
+    };
 
-    // disable current model object (to unbind current VAO)
-    coreModel::Disable(true);
+    if(!nIndexFunc(oLayout.iIndex)) return false;
 
-    // create index buffer
-    m_IndexBuffer.Create(GL_ELEMENT_ARRAY_BUFFER, iNumIndices*iIndexSize, pIndexData, eStorageType);
+    if(oHeader.iNumClusters)
+    {
+        // check cluster ranges against the number of indices
+        coreUint32 iTotal = 0u;
+        for(coreUintW i = 0u, ie = oHeader.iNumClusters; i < ie; ++i)
+        {
+            coreUint16 iNum;
+            std::memcpy(&iNum, pData + oLayout.iClusterNum + i * sizeof(coreUint16), sizeof(coreUint16));
+            iTotal += iNum;
+        }
+        if(iTotal != oHeader.iNumIndices) return false;
 
-    return &m_IndexBuffer;
+        // check cluster indices
+        if(!nIndexFunc(oLayout.iClusterIndex)) return false;
+    }
+
+    return true;
 }
\ No newline at end of file
@@ -15,7 +15,6 @@
 // TODO 4: Nullify is in main-thread because of VAOs, check for other dependencies and try to fix this
 // TODO 5: <old comment style>
 // TODO 3: separate compression checks between ARB_vertex_type_2_10_10_10_rev and ARB_half_float_vertex
-// TODO 3: share one vertex and index buffer among multiple models (may require staging buffer) (buffer references)
 
 
 // ****************************************************************
@@ -23,15 +22,75 @@
 #define CORE_MODEL_CLUSTERS_AXIS (5u)                               // number of clusters per axis
 #define CORE_MODEL_CLUSTERS_MAX  (POW3(CORE_MODEL_CLUSTERS_AXIS))   // maximum number of clusters per model
 
+#define CORE_MODEL_COOKED_MAGIC   (UINT_LITERAL("CMF0"))            // magic number of cooked models
+#define CORE_MODEL_COOKED_VERSION (0x00000001u)                     // current file version of cooked models
+
+#define CORE_MODEL_BVH_LEAF  (4u)                                   // maximum number of triangles per bounding volume hierarchy leaf
+#define CORE_MODEL_BVH_STACK (128u)                                 // maximum number of pending nodes during traversal
+#define CORE_MODEL_BVH_SAH   (16u)                                  // maximum hierarchy depth with surface area heuristic (median splits afterwards, to bound the traversal stack)
+
+#define CORE_MODEL_ARENA_VERTICES (0x40000u)                        // vertex capacity of each model arena
+#define CORE_MODEL_ARENA_INDICES  (0x100000u)                       // index capacity of each model arena (16-bit, relative to the base vertex)
+
 enum coreModelLoad : coreUint8
 {
     CORE_MODEL_LOAD_DEFAULT     = 0x00u,   // use default configuration
     CORE_MODEL_LOAD_NO_BUFFERS  = 0x01u,   // disable vertex and index buffer creation
-    CORE_MODEL_LOAD_NO_CLUSTERS = 0x02u    // disable cluster creation
+    CORE_MODEL_LOAD_NO_CLUSTERS = 0x02u,   // disable cluster creation
+    CORE_MODEL_LOAD_ARENA       = 0x04u    // store vertex and index data in shared model arenas (if supported)
 };
 ENABLE_BITWISE(coreModelLoad)
 
 
+// ****************************************************************
+/* model arena class */
+class coreModelArena final
+{
+public:
+    /* free range structure */
+    struct coreRange final
+    {
+        coreUint32 iOffset;   // first free element
+        coreUint32 iSize;     // number of free elements
+    };
+
+
+private:
+    GLuint m_iVertexArray;                 // shared vertex array object
+
+    coreVertexBuffer m_VertexBuffer;       // shared vertex buffer (de-interleaved over the full capacity)
+    coreDataBuffer   m_IndexBuffer;        // shared index buffer
+
+    coreList<coreRange> m_aVertexFree;     // free vertex ranges (sorted by offset)
+    coreList<coreRange> m_aIndexFree;      // free index ranges (sorted by offset)
+
+    coreUint32 m_iNumModels;               // number of models currently stored
+
+
+public:
+    explicit coreModelArena(const coreUint8 iVertexSize)noexcept;
+    ~coreModelArena();
+
+    DISABLE_COPY(coreModelArena)
+
+    /* allocate and free model ranges */
+    coreBool Allocate(const coreUint32 iNumVertices, const coreUint32 iNumIndices, coreUint32* OUTPUT piBaseVertex, coreUint32* OUTPUT piFirstIndex);
+    void     Free    (const coreUint32 iBaseVertex,  const coreUint32 iNumVertices, const coreUint32 iFirstIndex, const coreUint32 iNumIndices);
+
+    /* enable the arena */
+    void Enable();
+
+    /* get object properties */
+    inline coreVertexBuffer* GetVertexBuffer() {return &m_VertexBuffer;}
+    inline coreDataBuffer*   GetIndexBuffer () {return &m_IndexBuffer;}
+    inline coreBool          IsEmpty        ()const {return !m_iNumModels;}
+
+    /* handle free ranges (first-fit, sorted by offset) */
+    static coreBool TakeRange  (coreList<coreRange>* OUTPUT paFree, const coreUint32 iSize, coreUint32* OUTPUT piOffset);
+    static void     ReturnRange(coreList<coreRange>* OUTPUT paFree, const coreUint32 iOffset, const coreUint32 iSize);
+};
+
+
 // ****************************************************************
 /* model class */
 class coreModel final : public coreResource
@@ -54,12 +113,78 @@ public:
     };
 
 
+private:
+    /* cooked model header structure */
+    struct coreCookedHeader final
+    {
+        coreUint32  iMagic;            // magic number (CMF0)
+        coreUint32  iVersion;          // file version
+        coreUint32  iNumVertices;      // number of vertices
+        coreUint32  iNumIndices;       // number of indices
+        coreUint32  iNumClusters;      // number of clusters (0 = not stored)
+        coreVector3 vBoundingRange;    // maximum per-axis distance from the model center
+        coreFloat   fBoundingRadius;   // maximum direct distance from the model center
+        coreVector3 vNaturalCenter;    // position of the smallest axis-aligned bounding-box
+        coreVector3 vNaturalRange;     // size of the smallest axis-aligned bounding-box
+        coreVector3 vWeightedCenter;   // offset to the average vertex position
+    };
+
+    /* cooked model layout structure (byte offsets) */
+    struct coreCookedLayout final
+    {
+        coreUint32 iVertexHigh;        // packed vertex data (high quality compression, 20 bytes per vertex)
+        coreUint32 iVertexLow;         // packed vertex data (low quality compression, 24 bytes per vertex, starts with plain positions)
+        coreUint32 iIndex;             // optimized index data
+        coreUint32 iClusterNum;        // number of indices per cluster
+        coreUint32 iClusterPosition;   // relative cluster center
+        coreUint32 iClusterRadius;     // maximum direct distance from the cluster center
+        coreUint32 iClusterIndex;      // indices of all clusters
+        coreUint32 iSize;              // total file size
+    };
+
+    /* bounding volume hierarchy node structure (4-wide, bounds of all children as SoA for SIMD tests) */
+    struct coreBvhNode final
+    {
+        alignas(ALIGNMENT_SIMD) coreFloat afMin[3][4];   // lower bounds of all children (per axis)
+        alignas(ALIGNMENT_SIMD) coreFloat afMax[3][4];   // upper bounds of all children (per axis)
+        coreUint32 aiChild[4];                           // child node index (inner node) or first triangle (leaf)
+        coreUint8  aiCount[4];                           // number of triangles (0 = inner node)
+        coreUint8  iValid;                               // mask of used children
+    };
+
+    /* bounding volume hierarchy build reference structure */
+    struct coreBvhRef final
+    {
+        coreVector3 vMin;          // lower bound of the triangle
+        coreVector3 vMax;          // upper bound of the triangle
+        coreVector3 vCenter;       // center of the bounds (for splitting)
+        coreUint32  iTriangle;     // original triangle index
+    };
+
+    /* bounding volume hierarchy query structure (prepared for all node tests) */
+    struct coreBvhQuery final
+    {
+        coreUint8   iShape;        // query shape (0 = ray, 1 = sphere, 2 = box)
+        coreVector3 vScale;        // scale applied to all node bounds
+        coreVector3 vPosition;     // ray origin, sphere center or box center
+        coreVector3 vInvDir;       // inverse ray direction
+        coreFloat   fRadius;       // sphere radius
+        coreVector3 avAxis[3];     // box axes
+        coreVector3 vExtent;       // box half-extents (along box axes)
+        coreVector3 vProject;      // box half-extents (projected on node axes)
+    };
+
+
 private:
     GLuint m_iVertexArray;                        // vertex array object
 
     coreList<coreVertexBuffer> m_aVertexBuffer;   // vertex buffers
     coreDataBuffer             m_IndexBuffer;     // index buffer
 
+    coreModelArena* m_pArena;                     // shared model arena (instead of own buffers)
+    coreUint32      m_iBaseVertex;                // first vertex within the arena
+    coreUint32      m_iFirstIndex;                // first index within the arena
+
     coreUint32 m_iNumVertices;                    // number of vertices
     coreUint32 m_iNumIndices;                     // number of indices
     coreUint8  m_iNumClusters;                    // number of clusters
@@ -77,15 +202,25 @@ private:
     coreUint16*  m_piClusterNumIndices;           // number of indices per cluster
     coreVector3* m_pvClusterPosition;             // relative cluster center
     coreFloat*   m_pfClusterRadius;               // maximum direct distance from the cluster center
+    coreFloat    m_fClusterRadiusMax;             // largest cluster radius (to find all clusters with hierarchy queries)
+
+    coreBvhNode* m_pBvhNode;                      // bounding volume hierarchy for precise collision detection (root first)
+    coreUint32   m_iNumBvhNodes;                  // number of hierarchy nodes
+    coreUint16*  m_piBvhIndex;                    // triangle indices in hierarchy leaf order
+    coreUint8*   m_piBvhCluster;                  // cluster of each triangle in hierarchy leaf order
 
     GLenum m_iPrimitiveType;                      // primitive type for draw calls (e.g. GL_TRIANGLES)
     GLenum m_iIndexType;                          // index type for draw calls (e.g. GL_UNSIGNED_SHORT)
 
-    coreModelLoad m_eLoad;                        // resource load configuration
+    coreModelLoad           m_eLoad;              // resource load configuration
+    coreDataScope<coreByte> m_pPrepared;          // processed model data (from resource preparation, in cooked layout)
+    coreUint32              m_iPreparedSize;      // size of the processed model data
 
     coreSync m_Sync;                              // sync object for asynchronous model loading
 
-    static coreModel* s_pCurrent;                 // currently active model object
+    static coreModel*                s_pCurrent;        // currently active model object
+    static coreModelArena*           s_pCurrentArena;   // currently active model arena
+    static coreList<coreModelArena*> s_apArena;         // all existing model arenas
 
 
 public:
@@ -98,16 +233,19 @@ public:
     coreStatus Load(coreFile* pFile)final;
     coreStatus Unload()final;
 
+    /* import and process model resource data (without OpenGL context) */
+    coreStatus Prepare(coreFile* pFile)final;
+
     /* get resource type */
     inline coreResourceType GetResourceType()const final {return CORE_RESOURCE_TYPE_GRAPHICS;}
 
     /* draw the model */
-    inline void Draw        ()const {if(m_IndexBuffer.IsValid()) this->DrawElements(); else this->DrawArrays();}
+    inline void Draw        ()const {if(this->__HasIndices()) this->DrawElements(); else this->DrawArrays();}
     void        DrawArrays  ()const;
     void        DrawElements()const;
 
     /* draw the model instanced */
-    inline void DrawInstanced        (const coreUint32 iCount)const {if(m_IndexBuffer.IsValid()) this->DrawElementsInstanced(iCount); else this->DrawArraysInstanced(iCount);}
+    inline void DrawInstanced        (const coreUint32 iCount)const {if(this->__HasIndices()) this->DrawElementsInstanced(iCount); else this->DrawArraysInstanced(iCount);}
     void        DrawArraysInstanced  (const coreUint32 iCount)const;
     void        DrawElementsInstanced(const coreUint32 iCount)const;
 
@@ -118,9 +256,9 @@ public:
     /* generate custom model resource data */
     coreVertexBuffer*        CreateVertexBuffer (const coreUint32 iNumVertices, const coreUint8 iVertexSize, const void* pVertexData, const coreDataBufferStorage eStorageType);
     coreDataBuffer*          CreateIndexBuffer  (const coreUint32 iNumIndices,  const coreUint8 iIndexSize,  const void* pIndexData,  const coreDataBufferStorage eStorageType);
-    inline coreVertexBuffer* GetVertexBuffer    (const coreUintW iIndex) {return &m_aVertexBuffer[iIndex];}
-    inline coreDataBuffer*   GetIndexBuffer     ()                       {return &m_IndexBuffer;}
-    inline coreUintW         GetNumVertexBuffers()const                  {return m_aVertexBuffer.size();}
+    inline coreVertexBuffer* GetVertexBuffer    (const coreUintW iIndex) {ASSERT(!m_pArena || !iIndex) return m_pArena ? m_pArena->GetVertexBuffer() : &m_aVertexBuffer[iIndex];}
+    inline coreDataBuffer*   GetIndexBuffer     ()                       {return m_pArena ? m_pArena->GetIndexBuffer() : &m_IndexBuffer;}
+    inline coreUintW         GetNumVertexBuffers()const                  {return m_pArena ? 1u : m_aVertexBuffer.size();}
 
     /* set object properties */
     inline void SetBoundingRange (const coreVector3 vBoundingRange)  {ASSERT( m_vBoundingRange.IsNull()) m_vBoundingRange  = vBoundingRange;}
@@ -129,6 +267,9 @@ public:
 
     /* get object properties */
     inline const GLuint&      GetVertexArray      ()const                       {return m_iVertexArray;}
+    inline coreModelArena*    GetArena            ()const                       {return m_pArena;}
+    inline const coreUint32&  GetBaseVertex       ()const                       {return m_iBaseVertex;}
+    inline const coreUint32&  GetFirstIndex       ()const                       {return m_iFirstIndex;}
     inline const coreUint32&  GetNumVertices      ()const                       {return m_iNumVertices;}
     inline const coreUint32&  GetNumIndices       ()const                       {return m_iNumIndices;}
     inline const coreUint8&   GetNumClusters      ()const                       {return m_iNumClusters;}
@@ -145,11 +286,160 @@ public:
     inline const GLenum&      GetPrimitiveType    ()const                       {return m_iPrimitiveType;}
     inline const GLenum&      GetIndexType        ()const                       {return m_iIndexType;}
 
+    /* query triangles with the bounding volume hierarchy (in scaled model space, return true to stop) */
+    template <typename F> coreBool QueryRay   (const coreVector3 vRayPos, const coreVector3 vRayDir,                              const coreVector3 vScale, F&& nCallback)const;   // [](const coreUint16* piIndex) -> coreBool
+    template <typename F> coreBool QuerySphere(const coreVector3 vCenter, const coreFloat   fRadius,                              const coreVector3 vScale, F&& nCallback)const;   // [](const coreUint16* piIndex) -> coreBool
+    template <typename F> coreBool QueryBox   (const coreVector3 vCenter, const coreVector3 vExtent, const coreVector4 vRotation, const coreVector3 vScale, F&& nCallback)const;   // [](const coreUint16* piIndex) -> coreBool
+    inline coreBool                HasBvh     ()const {return (m_pBvhNode != NULL);}
+
+    /* find first cluster intersecting a sphere (in scaled model space, cluster radii are scaled by the largest scale component, returns number of clusters on miss) */
+    coreUintW FindCluster(const coreVector3 vCenter, const coreFloat fRadius, const coreVector3 vScale)const;
+
     /* get currently active model object */
     static inline coreModel* GetCurrent() {return s_pCurrent;}
+
+    /* handle cooked models (processed and packed, without parsing) */
+    static coreStatus Import      (coreFile* pFile, coreImport* OUTPUT pOutput);
+    static coreByte*  CreateCooked(coreImport* pImport, const coreBool bClusters, coreUint32* OUTPUT piSize);
+    static coreBool   IsCooked    (coreFile* pFile);
+
+
+private:
+    /* load cooked model resource data */
+    coreStatus __LoadCooked(const coreByte* pData, const coreUint32 iSize);
+
+    /* store and remove vertex and index data in shared model arenas */
+    coreBool __LoadArena(const coreByte* pVertexData, const coreByte* pIndexData, const coreBool bHigh);
+    void     __UnloadArena();
+
+    /* define vertex attributes of cooked models */
+    static void __DefineAttributes(coreVertexBuffer* OUTPUT pBuffer, const coreBool bHigh);
+
+    /* check for index data */
+    inline coreBool __HasIndices()const {return (m_pArena || m_IndexBuffer.IsValid());}
+
+    /* build bounding volume hierarchy (from cluster index data) */
+    void              __BuildBvh    ();
+    static coreUint32 __BuildBvhNode(coreList<coreBvhNode>* OUTPUT paNode, coreBvhRef* OUTPUT pRef, const coreUint32 iFirst, const coreUint32 iCount, const coreUint32 iDepth);
+    static coreUint32 __SplitBvh    (coreBvhRef* OUTPUT pRef, const coreUint32 iCount, const coreBool bMedian);
+
+    /* traverse bounding volume hierarchy */
+    template <typename F> coreBool __TraverseBvh(const coreBvhQuery& oQuery, F&& nCallback)const;
+    static coreUint32              __TestBvhNode(const coreBvhNode&  oNode, const coreBvhQuery& oQuery);
+
+    /* calculate byte offsets of all cooked data */
+    static coreCookedLayout __CookedLayout(const coreCookedHeader& oHeader);
+
+    /* check consistency of all cooked data (before anything is uploaded) */
+    static coreBool __CheckCooked(const coreByte* pData, const coreCookedHeader& oHeader, const coreCookedLayout& oLayout);
 };
 
 
+// ****************************************************************
+/* query triangles along a ray */
+template <typename F> coreBool coreModel::QueryRay(const coreVector3 vRayPos, const coreVector3 vRayDir, const coreVector3 vScale, F&& nCallback)const
+{
+    ASSERT(vRayDir.IsNormalized())
+
+    // avoid infinite values on axis-parallel rays
+    const auto nInvertFunc = [](const coreFloat fValue) {return 1.0f / ((ABS(fValue) < 1.0e-20f) ? ((fValue < 0.0f) ? -1.0e-20f : 1.0e-20f) : fValue);};
+
+    coreBvhQuery oQuery = {};
+    oQuery.iShape    = 0u;
+    oQuery.vScale    = vScale;
+    oQuery.vPosition = vRayPos;
+    oQuery.vInvDir   = coreVector3(nInvertFunc(vRayDir.x), nInvertFunc(vRayDir.y), nInvertFunc(vRayDir.z));
+
+    return this->__TraverseBvh(oQuery, std::forward<F>(nCallback));
+}
+
+
+// ****************************************************************
+/* query triangles near a sphere */
+template <typename F> coreBool coreModel::QuerySphere(const coreVector3 vCenter, const coreFloat fRadius, const coreVector3 vScale, F&& nCallback)const
+{
+    coreBvhQuery oQuery = {};
+    oQuery.iShape    = 1u;
+    oQuery.vScale    = vScale;
+    oQuery.vPosition = vCenter;
+    oQuery.fRadius   = fRadius;
+
+    return this->__TraverseBvh(oQuery, std::forward<F>(nCallback));
+}
+
+
+// ****************************************************************
+/* query triangles near an oriented box */
+template <typename F> coreBool coreModel::QueryBox(const coreVector3 vCenter, const coreVector3 vExtent, const coreVector4 vRotation, const coreVector3 vScale, F&& nCallback)const
+{
+    ASSERT(vRotation.IsNormalized())
+
+    coreBvhQuery oQuery = {};
+    oQuery.iShape    = 2u;
+    oQuery.vScale    = vScale;
+    oQuery.vPosition = vCenter;
+    oQuery.avAxis[0] = vRotation.QuatApply(coreVector3(1.0f,0.0f,0.0f));
+    oQuery.avAxis[1] = vRotation.QuatApply(coreVector3(0.0f,1.0f,0.0f));
+    oQuery.avAxis[2] = vRotation.QuatApply(coreVector3(0.0f,0.0f,1.0f));
+    oQuery.vExtent   = vExtent;
+
+    // project box onto all node axes
+    for(coreUintW i = 0u; i < 3u; ++i)
+    {
+        oQuery.vProject.arr(i) = ABS(oQuery.avAxis[0].arr(i)) * vExtent.x +
+                                 ABS(oQuery.avAxis[1].arr(i)) * vExtent.y +
+                                 ABS(oQuery.avAxis[2].arr(i)) * vExtent.z;
+    }
+
+    return this->__TraverseBvh(oQuery, std::forward<F>(nCallback));
+}
+
+
+// ****************************************************************
+/* traverse bounding volume hierarchy */
+template <typename F> coreBool coreModel::__TraverseBvh(const coreBvhQuery& oQuery, F&& nCallback)const
+{
+    ASSERT(m_pBvhNode && m_piBvhIndex)
+
+    coreUint32 aiStack[CORE_MODEL_BVH_STACK];
+    coreUintW  iStack = 0u;
+
+    // start with the root node
+    aiStack[iStack++] = 0u;
+
+    while(iStack)
+    {
+        const coreBvhNode& oNode = m_pBvhNode[aiStack[--iStack]];
+
+        // test all children at once
+        const coreUint32 iMask = coreModel::__TestBvhNode(oNode, oQuery);
+        if(!iMask) continue;
+
+        for(coreUintW i = 0u; i < 4u; ++i)
+        {
+            if(!HAS_BIT(iMask, i)) continue;
+
+            if(oNode.aiCount[i])
+            {
+                // forward all triangles of the leaf
+                for(coreUintW j = oNode.aiChild[i], je = j + oNode.aiCount[i]; j < je; ++j)
+                {
+                    if(nCallback(m_piBvhIndex + j * 3u)) return true;
+                }
+            }
+            else
+            {
+                // continue with the inner node
+                ASSERT(iStack < CORE_MODEL_BVH_STACK)
+                aiStack[iStack++] = oNode.aiChild[i];
+            }
+        }
+    }
+
+    return false;
+}
+
+
 // ****************************************************************
 /* model resource access type */
 using coreModelPtr = coreResourcePtr<coreModel>;
@@ -25,6 +25,7 @@ coreTexture::coreTexture(const coreTextureLoad eLoad)noexcept
 , m_eMode       (CORE_TEXTURE_MODE_DEFAULT)
 , m_Spec        (coreTextureSpec(0u, 0u, 0u, 0u, 0u))
 , m_eLoad       (eLoad)
+, m_pPrepared   (NULL)
 , m_Sync        ()
 {
 }
@@ -47,8 +48,54 @@ coreStatus coreTexture::Load(coreFile* pFile)
     if(eCheck >= CORE_OK) return eCheck;
 
     WARN_IF(m_iIdentifier) return CORE_INVALID_CALL;
-    if(!pFile)             return CORE_INVALID_INPUT;
-    if(!pFile->GetSize())  return CORE_ERROR_FILE;   // do not load file data
+
+    // load cooked texture directly (nothing to decode)
+    if(coreTexture::IsCooked(pFile)) return this->__LoadCooked(pFile);
+
+    // decode file (if not already prepared)
+    if(!m_pPrepared)
+    {
+        const coreStatus eStatus = this->Prepare(pFile);
+        if(eStatus != CORE_OK) return eStatus;
+    }
+
+    // take over decoded pixel data
+    coreSurfaceScope pData = std::move(m_pPrepared);
+    ASSERT(pData && !SDL_MUSTLOCK(pData))
+
+    // calculate data size
+    const coreUint8  iComponents = SDL_BYTESPERPIXEL(pData->format);
+    const coreUint32 iDataSize   = pData->pitch * pData->h;
+    ASSERT(iComponents && iDataSize)
+
+    // check load configuration
+    const coreTextureMode eMode = ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NO_COMPRESS) && coreMath::IsPot(pData->w) && coreMath::IsPot(pData->h)) ? (HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_COMPRESS_HIGH) ? CORE_TEXTURE_MODE_COMPRESS_HIGH : HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_COMPRESS_FAST) ? CORE_TEXTURE_MODE_COMPRESS_FAST : CORE_TEXTURE_MODE_COMPRESS) : CORE_TEXTURE_MODE_DEFAULT) |
+                                  ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NO_FILTER)) ? CORE_TEXTURE_MODE_FILTER  : CORE_TEXTURE_MODE_DEFAULT) |
+                                  ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NEAREST))   ? CORE_TEXTURE_MODE_DEFAULT : CORE_TEXTURE_MODE_NEAREST) |
+                                  ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_REPEAT))    ? CORE_TEXTURE_MODE_DEFAULT : CORE_TEXTURE_MODE_REPEAT);
+
+    // create texture
+    this->Create(pData->w, pData->h, CORE_TEXTURE_SPEC_COMPONENTS(iComponents), eMode);
+    this->Modify(0u, 0u, pData->w, pData->h, iDataSize, s_cast<coreByte*>(pData->pixels));
+
+    // add debug label
+    Core::Graphics->LabelOpenGL(GL_TEXTURE, m_iIdentifier, m_sName.c_str());
+
+    Core::Log->Info("Texture (%s, %.0f x %.0f, %u components, %u levels, %s) loaded", m_sName.c_str(), m_vResolution.x, m_vResolution.y, iComponents, m_iLevels, m_iCompressed ? "compressed" : "standard");
+    return m_Sync.Create(CORE_SYNC_CREATE_FLUSHED) ? CORE_BUSY : CORE_OK;
+}
+
+
+// ****************************************************************
+/* decode texture resource data (without OpenGL context) */
+coreStatus coreTexture::Prepare(coreFile* pFile)
+{
+    WARN_IF(m_pPrepared)  return CORE_INVALID_CALL;
+    if(!pFile)            return CORE_INVALID_INPUT;
+    if(!pFile->GetSize()) return CORE_ERROR_FILE;   // do not load file data
+
+    // skip cooked texture (already GPU-ready)
+    if(coreTexture::IsCooked(pFile)) return CORE_OK;
 
     // decompress file to plain pixel data
     coreSurfaceScope pData = IMG_LoadTyped_IO(pFile->CreateReadStream(), true, coreData::StrExtension(pFile->GetPath()));
@@ -79,25 +126,122 @@ coreStatus coreTexture::Load(coreFile* pFile)
 
     ASSERT(!SDL_MUSTLOCK(pData))
 
-    // calculate data size
-    const coreUint8  iComponents = SDL_BYTESPERPIXEL(pData->format);
-    const coreUint32 iDataSize   = pData->pitch * pData->h;
-    ASSERT(iComponents && iDataSize)
+    // keep pixel data for loading
+    m_pPrepared = std::move(pData);
 
-    // check load configuration
-    const coreTextureMode eMode = ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NO_COMPRESS) && coreMath::IsPot(pData->w) && coreMath::IsPot(pData->h)) ? (HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_COMPRESS_HIGH) ? CORE_TEXTURE_MODE_COMPRESS_HIGH : CORE_TEXTURE_MODE_COMPRESS) : CORE_TEXTURE_MODE_DEFAULT) |
-                                  ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NO_FILTER)) ? CORE_TEXTURE_MODE_FILTER  : CORE_TEXTURE_MODE_DEFAULT) |
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* load cooked texture resource data */
+coreStatus coreTexture::__LoadCooked(coreFile* pFile)
+{
+    ASSERT(pFile)
+
+    const coreByte*  pData = pFile->GetData();
+    const coreUint32 iSize = pFile->GetSize();
+
+    // read and check file header
+    coreCookedHeader oHeader;
+    std::memcpy(&oHeader, pData, sizeof(coreCookedHeader));
+    if((oHeader.iVersion != CORE_TEXTURE_COOKED_VERSION) || !oHeader.iWidth || !oHeader.iHeight || !oHeader.iComponents || (oHeader.iComponents > 4u) || !oHeader.iLevels || (oHeader.iLevels > 16u) || (oHeader.iFormat > CORE_TEXTURE_COOK_BC7))
+    {
+        Core::Log->Warning("Texture (%s) is not a valid cooked texture", m_sName.c_str());
+        return CORE_INVALID_DATA;
+    }
+    if((oHeader.iFormat != CORE_TEXTURE_COOK_RAW) && (!coreMath::IsPot(oHeader.iWidth) || !coreMath::IsPot(oHeader.iHeight) || (oHeader.iWidth < 4u) || (oHeader.iHeight < 4u) || ((oHeader.iWidth >> (oHeader.iLevels - 1u)) < 4u) || ((oHeader.iHeight >> (oHeader.iLevels - 1u)) < 4u)))
+    {
+        Core::Log->Warning("Texture (%s) has invalid compressed levels", m_sName.c_str());
+        return CORE_INVALID_DATA;
+    }
+
+    // check data size of all levels
+    coreUint32 iDataSize = 0u;
+    for(coreUintW i = 0u; i < oHeader.iLevels; ++i) iDataSize += coreTexture::__CookedLevelSize(oHeader, i);
+    if(sizeof(coreCookedHeader) + iDataSize > iSize)
+    {
+        Core::Log->Warning("Texture (%s) is truncated", m_sName.c_str());
+        return CORE_INVALID_DATA;
+    }
+
+    // select stored texture format
+    coreTextureSpec oSpec;
+    coreBool        bSupport;
+    switch(oHeader.iFormat)
+    {
+    default: UNREACHABLE
+    case CORE_TEXTURE_COOK_RAW: oSpec = CORE_TEXTURE_SPEC_COMPONENTS(oHeader.iComponents);                                                                                                                                                                       bSupport = (oHeader.iComponents != 2u) || CORE_GL_SUPPORT(ARB_texture_rg);                                    break;
+    case CORE_TEXTURE_COOK_DXT: oSpec = (oHeader.iComponents == 4u) ? CORE_TEXTURE_SPEC_COMPRESSED_DXT5 : (oHeader.iComponents == 3u) ? CORE_TEXTURE_SPEC_COMPRESSED_DXT1 : (oHeader.iComponents == 2u) ? CORE_TEXTURE_SPEC_COMPRESSED_RGTC2 : CORE_TEXTURE_SPEC_COMPRESSED_RGTC1; bSupport = (oHeader.iComponents >= 3u) ? CORE_GL_SUPPORT(EXT_texture_compression_s3tc) : CORE_GL_SUPPORT(ARB_texture_compression_rgtc); break;
+    case CORE_TEXTURE_COOK_BC7: oSpec = (oHeader.iComponents == 4u) ? CORE_TEXTURE_SPEC_COMPRESSED_BPTC4 : CORE_TEXTURE_SPEC_COMPRESSED_BPTC3;                                                                                                                     bSupport = CORE_GL_SUPPORT(ARB_texture_compression_bptc);                                                     break;
+    }
+
+    // cannot be converted on the fly
+    if(!bSupport)
+    {
+        Core::Log->Warning("Texture (%s) uses an unsupported format", m_sName.c_str());
+        return CORE_ERROR_SUPPORT;
+    }
+
+    // check load configuration (compression is already defined by the file)
+    const coreTextureMode eMode = ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NO_FILTER)) ? CORE_TEXTURE_MODE_FILTER  : CORE_TEXTURE_MODE_DEFAULT) |
                                   ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NEAREST))   ? CORE_TEXTURE_MODE_DEFAULT : CORE_TEXTURE_MODE_NEAREST) |
                                   ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_REPEAT))    ? CORE_TEXTURE_MODE_DEFAULT : CORE_TEXTURE_MODE_REPEAT);
 
     // create texture
-    this->Create(pData->w, pData->h, CORE_TEXTURE_SPEC_COMPONENTS(iComponents), eMode);
-    this->Modify(0u, 0u, pData->w, pData->h, iDataSize, s_cast<coreByte*>(pData->pixels));
+    this->Create(oHeader.iWidth, oHeader.iHeight, oSpec, eMode);
+
+    const coreByte*  pLevels = pData + sizeof(coreCookedHeader);
+    const coreUint32 iUpload = MIN(oHeader.iLevels, m_iLevels);
+
+    // stream all levels with a single pixel buffer object (offsets instead of pointers)
+    const coreBool bPixelBuffer = CORE_GL_SUPPORT(ARB_pixel_buffer_object);
+
+    coreDataBuffer oBuffer;
+    if(bPixelBuffer) oBuffer.Create(GL_PIXEL_UNPACK_BUFFER, iDataSize, pLevels, CORE_DATABUFFER_STORAGE_STREAM);
+
+    // bind texture (simple)
+    glBindTexture(GL_TEXTURE_2D, m_iIdentifier);
+    s_apBound[s_iActiveUnit] = NULL;
+
+    // allow tightly packed rows (small levels)
+    if(!m_iCompressed) glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    // upload all required levels
+    for(coreUintW i = 0u, iOffset = 0u; i < iUpload; ++i)
+    {
+        const coreUint32  iCurWidth  = MAX(oHeader.iWidth  >> i, 1u);
+        const coreUint32  iCurHeight = MAX(oHeader.iHeight >> i, 1u);
+        const coreUint32  iCurSize   = coreTexture::__CookedLevelSize(oHeader, i);
+        const void*       pCurData   = bPixelBuffer ? I_TO_P(iOffset) : (pLevels + iOffset);
+
+        if(m_iCompressed)
+        {
+            glCompressedTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, iCurWidth, iCurHeight, m_Spec.iFormat, iCurSize, pCurData);
+        }
+        else if(!i || CORE_GL_SUPPORT(ARB_texture_storage))
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, iCurWidth, iCurHeight, m_Spec.iFormat, m_Spec.iType, pCurData);
+        }
+        else
+        {
+            // create lower standard level (only first level is allocated)
+            glTexImage2D(GL_TEXTURE_2D, i, CORE_GL_SUPPORT(CORE_es2_restriction) ? m_Spec.iFormat : m_Spec.iInternal, iCurWidth, iCurHeight, 0, m_Spec.iFormat, m_Spec.iType, pCurData);
+        }
+
+        iOffset += iCurSize;
+    }
+
+    // reset row unpack alignment
+    if(!m_iCompressed) glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    // generate missing levels (e.g. from non-power-of-two image)
+    if(!m_iCompressed && (iUpload < m_iLevels) && CORE_GL_SUPPORT(EXT_framebuffer_object)) glGenerateMipmap(GL_TEXTURE_2D);
 
     // add debug label
     Core::Graphics->LabelOpenGL(GL_TEXTURE, m_iIdentifier, m_sName.c_str());
 
-    Core::Log->Info("Texture (%s, %.0f x %.0f, %u components, %u levels, %s) loaded", m_sName.c_str(), m_vResolution.x, m_vResolution.y, iComponents, m_iLevels, m_iCompressed ? "compressed" : "standard");
+    Core::Log->Info("Texture (%s, %.0f x %.0f, %u components, %u levels, %s) loaded", m_sName.c_str(), m_vResolution.x, m_vResolution.y, oHeader.iComponents, m_iLevels, m_iCompressed ? "cooked compressed" : "cooked standard");
     return m_Sync.Create(CORE_SYNC_CREATE_FLUSHED) ? CORE_BUSY : CORE_OK;
 }
 
@@ -106,6 +250,9 @@ coreStatus coreTexture::Load(coreFile* pFile)
 /* unload texture resource data */
 coreStatus coreTexture::Unload()
 {
+    // discard prepared pixel data
+    m_pPrepared = NULL;
+
     if(!m_iIdentifier) return CORE_INVALID_CALL;
 
     // disable still active texture bindings
@@ -164,7 +311,15 @@ void coreTexture::Create(const coreUint32 iWidth, const coreUint32 iHeight, cons
     const GLenum iWrapMode = HAS_FLAG(eMode, CORE_TEXTURE_MODE_REPEAT) ? GL_REPEAT : GL_CLAMP_TO_EDGE;
 
     // set compression
-    if(bCompress)
+    if(!oSpec.iBytes)
+    {
+        ASSERT(coreMath::IsPot(iWidth) && coreMath::IsPot(iHeight) && (iWidth >= 4u) && (iHeight >= 4u))
+
+        // use already compressed texture format (e.g. from cooked texture)
+        m_iCompressed = (m_Spec.iInternal == GL_COMPRESSED_RGBA_BPTC_UNORM) ? 2u : 1u;
+        if((bMipMap || bMipMapOld) && !CORE_GL_SUPPORT(CORE_es2_restriction)) m_iLevels = F_TO_UI(LOG2(m_vResolution.Min())) - 1u;
+    }
+    else if(bCompress)
     {
         WARN_IF(!coreMath::IsPot(iWidth) || !coreMath::IsPot(iHeight) || (iWidth < 4u) || (iHeight < 4u)) {}
         else
@@ -191,6 +346,9 @@ void coreTexture::Create(const coreUint32 iWidth, const coreUint32 iHeight, cons
                 case GL_RGB8:  if(CORE_GL_SUPPORT(EXT_texture_compression_s3tc)) {m_Spec = CORE_TEXTURE_SPEC_COMPRESSED_DXT1;  m_iCompressed = 1u;} break;
                 case GL_RGBA8: if(CORE_GL_SUPPORT(EXT_texture_compression_s3tc)) {m_Spec = CORE_TEXTURE_SPEC_COMPRESSED_DXT5;  m_iCompressed = 1u;} break;
                 }
+
+                // use simple endpoint search (trade quality for speed)
+                if(m_iCompressed && HAS_FLAG(eMode, CORE_TEXTURE_MODE_COMPRESS_FAST)) m_iCompressed = 3u;
             }
             if(m_iCompressed) {if((bMipMap || bMipMapOld) && !CORE_GL_SUPPORT(CORE_es2_restriction)) m_iLevels = F_TO_UI(LOG2(m_vResolution.Min())) - 1u;}
         }
@@ -272,13 +430,24 @@ void coreTexture::Modify(const coreUint32 iOffsetX, const coreUint32 iOffsetY, c
         const coreUint32 iPackedSize = iDataSize / ((m_iCompressed == 2u) ? bc7enc_ratio(iComponents) : stb_dxt_ratio(iComponents));
         ASSERT(iComponents == m_Spec.iComponents)
 
+        // count required texture levels (down to single blocks)
+        coreUintW iMipLevels = 0u;
+        if(bMipMap) while((iMipLevels + 1u < m_iLevels) && ((iWidth >> iMipLevels) > 4u) && ((iHeight >> iMipLevels) > 4u)) ++iMipLevels;
+
+        // select mipmap generation
+        coreTextureMipmap eMipmap = HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_MIP_LANCZOS) ? CORE_TEXTURE_MIPMAP_LANCZOS : (HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_MIP_KAISER) ? CORE_TEXTURE_MIPMAP_KAISER : CORE_TEXTURE_MIPMAP_BOX);
+        if(HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_MIP_SRGB))   ADD_FLAG(eMipmap, CORE_TEXTURE_MIPMAP_SRGB)
+        if(HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NORMAL_MAP)) ADD_FLAG(eMipmap, CORE_TEXTURE_MIPMAP_NORMAL)
+        if(HAS_FLAG(m_eMode, CORE_TEXTURE_MODE_REPEAT))     ADD_FLAG(eMipmap, CORE_TEXTURE_MIPMAP_REPEAT)
+
         // allocate required image memory
-        coreByte* pPackedData  = TEMP_NEW(coreByte, iPackedSize);
-        coreByte* apMipData[2] = {NULL, NULL};
-        if(bMipMap)
+        coreByte* pPackedData = TEMP_NEW(coreByte, iPackedSize);
+        coreByte* pMipData    = NULL;
+        if(iMipLevels)
         {
-            apMipData[0] = TEMP_NEW(coreByte, iDataSize >> 2u);
-            apMipData[1] = TEMP_NEW(coreByte, iDataSize >> 4u);
+            // create all lower levels at once
+            pMipData = TEMP_NEW(coreByte, coreTexture::MipmapsSize(iWidth, iHeight, iComponents, iMipLevels));
+            coreTexture::CreateMipmaps(iWidth, iHeight, iComponents, pData, iMipLevels, pMipData, eMipmap);
         }
 
         // process all available texture levels
@@ -290,7 +459,7 @@ void coreTexture::Modify(const coreUint32 iOffsetX, const coreUint32 iOffsetY, c
 
             // create compressed image
             if(m_iCompressed == 2u) coreTexture::CreateCompressedBC7(iCurWidth, iCurHeight, iComponents, pData, pPackedData);
-                               else coreTexture::CreateCompressedDXT(iCurWidth, iCurHeight, iComponents, pData, pPackedData);
+                               else coreTexture::CreateCompressedDXT(iCurWidth, iCurHeight, iComponents, pData, pPackedData, (m_iCompressed == 3u));
 
             // upload image to texture
             coreDataBuffer oBuffer;
@@ -298,17 +467,15 @@ void coreTexture::Modify(const coreUint32 iOffsetX, const coreUint32 iOffsetY, c
             glCompressedTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, iCurWidth, iCurHeight, m_Spec.iFormat, iCurSize, bPixelBuffer ? NULL : pPackedData);
 
             // check for still valid resolution
-            if((iCurWidth <= 4u) || (iCurHeight <= 4u) || !bMipMap) break;
+            if(i >= iMipLevels) break;
 
-            // create next level-of-detail image
-            coreTexture::CreateNextLevel(iCurWidth, iCurHeight, iComponents, pData, apMipData[i % 2u]);
-            pData = apMipData[i % 2u];
+            // switch to next level-of-detail image
+            pData = i ? (pData + iCurWidth * iCurHeight * iComponents) : pMipData;
         }
 
         // free required image memory
         TEMP_DELETE(pPackedData)
-        TEMP_DELETE(apMipData[0])
-        TEMP_DELETE(apMipData[1])
+        TEMP_DELETE(pMipData)
     }
     else
     {
@@ -649,87 +816,123 @@ void coreTexture::CreateNextLevel(const coreUintW iInWidth, const coreUintW iInH
 
 
 // ****************************************************************
-/* create compressed image */
-void coreTexture::CreateCompressedDXT(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput)
+/* create mipmap chain (all levels in one go, intermediate results stay in high precision) */
+void coreTexture::CreateMipmaps(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, const coreUintW iLevels, coreByte* OUTPUT pOutput, const coreTextureMipmap eMipmap)
 {
-    ASSERT(coreMath::IsPot(iInWidth)  && (iInWidth  >= 4u) &&
-           coreMath::IsPot(iInHeight) && (iInHeight >= 4u) &&
-           (iComponents <= 4u) && pInput && pOutput)
+    ASSERT(coreMath::IsPot(iInWidth) && coreMath::IsPot(iInHeight) && iComponents && (iComponents <= 4u) && pInput && iLevels && pOutput)
 
-    // assume pointer alignment
-    pInput  = ASSUME_ALIGNED(pInput,  ALIGNMENT_NEW);
-    pOutput = ASSUME_ALIGNED(pOutput, ALIGNMENT_NEW);
+    // encode linear color to sRGB (with enough precision in dark areas)
+    static const auto s_aiEncode = []()
+    {
+        std::array<coreByte, 4096u> aiTable;
+        for(coreUintW i = 0u; i < 4096u; ++i)
+        {
+            const coreFloat fLinear = I_TO_F(i) / 4095.0f;
+            const coreFloat fSrgb   = (fLinear <= 0.0031308f) ? (fLinear * 12.92f) : (1.055f * POW(fLinear, 1.0f / 2.4f) - 0.055f);
+            aiTable[i] = F_TO_UI(fSrgb * 255.0f + 0.5f);
+        }
+        return aiTable;
+    }();
 
-    // save memory offsets
-    const coreUintW iInOffsetX =  4u * iComponents;
-    const coreUintW iInOffsetY =  3u * iComponents * iInWidth;
-    const coreUintW iOutOffset = 16u * iComponents / stb_dxt_ratio(iComponents);   // size per block
+    const coreBool  bNormal = HAS_FLAG(eMipmap, CORE_TEXTURE_MIPMAP_NORMAL) && (iComponents >= 2u);
+    const coreUintW iColor  = (HAS_FLAG(eMipmap, CORE_TEXTURE_MIPMAP_SRGB) && !bNormal && (iComponents >= 3u)) ? 3u : 0u;   // number of components in sRGB
+
+    // allocate intermediate levels (alternating, each sized for the largest level it holds)
+    const coreUintW aiLevelSize[2] = {MAX(iInWidth >> 1u, 1u) * MAX(iInHeight >> 1u, 1u) * iComponents,
+                                      MAX(iInWidth >> 2u, 1u) * MAX(iInHeight >> 2u, 1u) * iComponents};   // # not a quarter of the first level with 1xN and 2xN chains
+    coreFloat* apLevel[2] = {TEMP_NEW(coreFloat, aiLevelSize[0]), (iLevels > 1u) ? TEMP_NEW(coreFloat, aiLevelSize[1]) : NULL};
 
-    // loop through all input texels
-    for(coreUintW y = 0u; y < LOOP_NONZERO(iInHeight); y += 4u)
+    coreUintW iWidth  = iInWidth;
+    coreUintW iHeight = iInHeight;
+
+    for(coreUintW i = 0u; i < iLevels; ++i)
     {
-        for(coreUintW x = 0u; x < LOOP_NONZERO(iInWidth); x += 4u)
+        coreFloat* pLevel = apLevel[i % 2u];
+
+        // filter from original image or from previous intermediate level
+        coreTexture::__FilterLevel(iWidth, iHeight, iComponents, i ? NULL : pInput, i ? apLevel[(i - 1u) % 2u] : NULL, pLevel, eMipmap);
+
+        iWidth  = MAX(iWidth  >> 1u, 1u);
+        iHeight = MAX(iHeight >> 1u, 1u);
+
+        const coreUintW iTexels = iWidth * iHeight;
+        ASSERT(iTexels * iComponents <= aiLevelSize[i % 2u])
+
+        if(bNormal)
         {
-            alignas(ALIGNMENT_CACHE) coreByte aBlock[64];
+            // renormalize vectors (in place, also for the next level)
+            for(coreUintW j = 0u; j < iTexels; ++j)
+            {
+                coreFloat* pTexel = pLevel + j * iComponents;
 
-            // copy data into 4x4 RGBA block
-            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i)       * 4u, pInput + (i)               * iComponents, 4u);
-            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i +  4u) * 4u, pInput + (i + 1u*iInWidth) * iComponents, 4u);
-            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i +  8u) * 4u, pInput + (i + 2u*iInWidth) * iComponents, 4u);
-            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i + 12u) * 4u, pInput + (i + 3u*iInWidth) * iComponents, iComponents);
+                const coreFloat fX = pTexel[0] * 2.0f - 1.0f;
+                const coreFloat fY = pTexel[1] * 2.0f - 1.0f;
+                const coreFloat fZ = (iComponents >= 3u) ? (pTexel[2] * 2.0f - 1.0f) : 0.0f;
 
-            // compress block (R -> RGTC1/BC4, RG -> RGTC2/BC5, RGB -> DXT1/BC1, RGBA -> DXT5/BC3)
-            stb_compress_dxt_block(pOutput, aBlock, iComponents, STB_DXT_HIGHQUAL);
+                const coreFloat fLenSq = fX*fX + fY*fY + fZ*fZ;
+                if(fLenSq < CORE_MATH_PRECISION) continue;
 
-            // increment pointers
-            pInput  += iInOffsetX;
-            pOutput += iOutOffset;
+                // always unit length with 3 components, at most unit length with 2 components (Z reconstructed)
+                const coreFloat fScale = ((iComponents >= 3u) || (fLenSq > 1.0f)) ? RSQRT(fLenSq) : 1.0f;
+
+                pTexel[0] = fX * fScale * 0.5f + 0.5f;
+                pTexel[1] = fY * fScale * 0.5f + 0.5f;
+                if(iComponents >= 3u) pTexel[2] = fZ * fScale * 0.5f + 0.5f;
+            }
         }
 
-        // skip already processed texture lines
-        pInput += iInOffsetY;
-    }
-}
+        // convert to final format
+        for(coreUintW j = 0u; j < iTexels; ++j)
+        {
+            const coreFloat* pTexel = pLevel + j * iComponents;
 
-void coreTexture::CreateCompressedBC7(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput)
-{
-    ASSERT(coreMath::IsPot(iInWidth)  && (iInWidth  >= 4u) &&
-           coreMath::IsPot(iInHeight) && (iInHeight >= 4u) &&
-           (iComponents >= 3u) && (iComponents <= 4u) && pInput && pOutput)
+            for(coreUintW k = 0u; k < iComponents; ++k)
+            {
+                const coreFloat fValue = CLAMP01(pTexel[k]);
+                (*pOutput++) = (k < iColor) ? s_aiEncode[F_TO_UI(fValue * 4095.0f + 0.5f)] : F_TO_UI(fValue * 255.0f + 0.5f);
+            }
+        }
+    }
 
-    // assume pointer alignment
-    pInput  = ASSUME_ALIGNED(pInput,  ALIGNMENT_NEW);
-    pOutput = ASSUME_ALIGNED(pOutput, ALIGNMENT_NEW);
+    // free intermediate levels
+    TEMP_DELETE(apLevel[0])
+    TEMP_DELETE(apLevel[1])
+}
 
-    // save memory offsets
-    const coreUintW iInOffsetX =  4u * iComponents;
-    const coreUintW iInOffsetY =  3u * iComponents * iInWidth;
-    const coreUintW iOutOffset = 16u * iComponents / bc7enc_ratio(iComponents);   // size per block
 
-    // loop through all input texels
-    for(coreUintW y = 0u; y < LOOP_NONZERO(iInHeight); y += 4u)
+// ****************************************************************
+/* get total size of a mipmap chain (without the original image) */
+coreUintW coreTexture::MipmapsSize(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreUintW iLevels)
+{
+    coreUintW iSize = 0u;
+    for(coreUintW i = 1u; i <= iLevels; ++i)
     {
-        for(coreUintW x = 0u; x < LOOP_NONZERO(iInWidth); x += 4u)
-        {
-            alignas(ALIGNMENT_CACHE) coreByte aBlock[64];
+        iSize += MAX(iInWidth >> i, 1u) * MAX(iInHeight >> i, 1u) * iComponents;
+    }
+    return iSize;
+}
 
-            // copy data into 4x4 RGBA block
-            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i)       * 4u, pInput + (i)               * iComponents, 4u);
-            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i +  4u) * 4u, pInput + (i + 1u*iInWidth) * iComponents, 4u);
-            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i +  8u) * 4u, pInput + (i + 2u*iInWidth) * iComponents, 4u);
-            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i + 12u) * 4u, pInput + (i + 3u*iInWidth) * iComponents, iComponents);
 
-            // compress block (RGB -> BPTC/BC7, RGBA -> BPTC/BC7)
-            bc7enc_compress_block(pOutput, aBlock, iComponents, 0);
+// ****************************************************************
+/* create compressed image */
+void coreTexture::CreateCompressedDXT(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput, const coreBool bFast)
+{
+    ASSERT(coreMath::IsPot(iInWidth)  && (iInWidth  >= 4u) &&
+           coreMath::IsPot(iInHeight) && (iInHeight >= 4u) &&
+           (iComponents <= 4u) && pInput && pOutput)
 
-            // increment pointers
-            pInput  += iInOffsetX;
-            pOutput += iOutOffset;
-        }
+    // compress blocks (R -> RGTC1/BC4, RG -> RGTC2/BC5, RGB -> DXT1/BC1, RGBA -> DXT5/BC3)
+    coreTexture::__CompressBlocks(iInWidth, iInHeight, iComponents, pInput, pOutput, bFast ? __CORE_TEXTURE_BLOCK_DXT_FAST : __CORE_TEXTURE_BLOCK_DXT);
+}
 
-        // skip already processed texture lines
-        pInput += iInOffsetY;
-    }
+void coreTexture::CreateCompressedBC7(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput)
+{
+    ASSERT(coreMath::IsPot(iInWidth)  && (iInWidth  >= 4u) &&
+           coreMath::IsPot(iInHeight) && (iInHeight >= 4u) &&
+           (iComponents >= 3u) && (iComponents <= 4u) && pInput && pOutput)
+
+    // compress blocks (RGB -> BPTC/BC7, RGBA -> BPTC/BC7)
+    coreTexture::__CompressBlocks(iInWidth, iInHeight, iComponents, pInput, pOutput, __CORE_TEXTURE_BLOCK_BC7);
 }
 
 
@@ -766,6 +969,89 @@ SDL_Surface* coreTexture::CreateReduction(const coreUintW iComponents, const SDL
 }
 
 
+// ****************************************************************
+/* create cooked texture (returns new file data) */
+coreByte* coreTexture::CreateCooked(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, const coreTextureCook eCook, const coreTextureMipmap eMipmap, coreUint32* OUTPUT piSize)
+{
+    ASSERT(iInWidth && iInHeight && iComponents && (iComponents <= 4u) && pInput && piSize)
+
+    const coreBool bPot = coreMath::IsPot(iInWidth) && coreMath::IsPot(iInHeight);
+
+    // select stored format (block compression needs power-of-two images with full blocks)
+    coreTextureCook eFormat = (eCook == CORE_TEXTURE_COOK_DXT_FAST) ? CORE_TEXTURE_COOK_DXT : eCook;
+    if((eFormat == CORE_TEXTURE_COOK_BC7) && (iComponents < 3u))         eFormat = CORE_TEXTURE_COOK_DXT;
+    if(!bPot || (iInWidth < 4u) || (iInHeight < 4u))                     eFormat = CORE_TEXTURE_COOK_RAW;
+
+    // count stored levels (down to single texels or single blocks)
+    coreUintW iLevels = 1u;
+    if(bPot)
+    {
+        if(eFormat == CORE_TEXTURE_COOK_RAW) while(((iInWidth >> iLevels) >= 1u) || ((iInHeight >> iLevels) >= 1u)) ++iLevels;
+                                        else while(((iInWidth >> iLevels) >= 4u) && ((iInHeight >> iLevels) >= 4u)) ++iLevels;
+    }
+
+    const coreCookedHeader oHeader = {CORE_TEXTURE_COOKED_MAGIC, CORE_TEXTURE_COOKED_VERSION, coreUint32(iInWidth), coreUint32(iInHeight), eFormat, coreUint8(iComponents), coreUint8(iLevels), 0u};
+
+    // calculate file size
+    coreUint32 iSize = sizeof(coreCookedHeader);
+    for(coreUintW i = 0u; i < iLevels; ++i) iSize += coreTexture::__CookedLevelSize(oHeader, i);
+
+    // create all lower levels at once
+    coreByte* pMipData = NULL;
+    if(iLevels > 1u)
+    {
+        pMipData = TEMP_NEW(coreByte, coreTexture::MipmapsSize(iInWidth, iInHeight, iComponents, iLevels - 1u));
+        coreTexture::CreateMipmaps(iInWidth, iInHeight, iComponents, pInput, iLevels - 1u, pMipData, eMipmap);
+    }
+
+    // write file header
+    coreByte* pOutput = new coreByte[iSize];
+    std::memcpy(pOutput, &oHeader, sizeof(coreCookedHeader));
+
+    coreByte*       pCursor = pOutput + sizeof(coreCookedHeader);
+    const coreByte* pData   = pInput;
+
+    for(coreUintW i = 0u; i < iLevels; ++i)
+    {
+        const coreUintW iCurWidth  = MAX(iInWidth  >> i, 1u);
+        const coreUintW iCurHeight = MAX(iInHeight >> i, 1u);
+
+        // write level data
+        switch(eFormat)
+        {
+        default: UNREACHABLE
+        case CORE_TEXTURE_COOK_RAW: std::memcpy(pCursor, pData, iCurWidth * iCurHeight * iComponents);                                                                break;
+        case CORE_TEXTURE_COOK_DXT: coreTexture::CreateCompressedDXT(iCurWidth, iCurHeight, iComponents, pData, pCursor, (eCook == CORE_TEXTURE_COOK_DXT_FAST)); break;
+        case CORE_TEXTURE_COOK_BC7: coreTexture::CreateCompressedBC7(iCurWidth, iCurHeight, iComponents, pData, pCursor);                                          break;
+        }
+
+        // switch to next level-of-detail image
+        pCursor += coreTexture::__CookedLevelSize(oHeader, i);
+        pData    = i ? (pData + iCurWidth * iCurHeight * iComponents) : pMipData;
+    }
+    ASSERT(pCursor == pOutput + iSize)
+
+    // free required image memory
+    TEMP_DELETE(pMipData)
+
+    (*piSize) = iSize;
+    return pOutput;
+}
+
+
+// ****************************************************************
+/* check for cooked texture */
+coreBool coreTexture::IsCooked(coreFile* pFile)
+{
+    if(!pFile || (pFile->GetSize() < sizeof(coreCookedHeader))) return false;
+
+    // compare magic number
+    coreUint32 iMagic;
+    std::memcpy(&iMagic, pFile->GetData(), sizeof(coreUint32));
+    return (iMagic == CORE_TEXTURE_COOKED_MAGIC);
+}
+
+
 // ****************************************************************
 /* bind texture to texture unit */
 void coreTexture::__BindTexture(const coreUintW iUnit, coreTexture* pTexture)
@@ -805,6 +1091,24 @@ void coreTexture::__BindTexture(const coreUintW iUnit, coreTexture* pTexture)
 }
 
 
+// ****************************************************************
+/* calculate size of a stored level */
+coreUint32 coreTexture::__CookedLevelSize(const coreCookedHeader& oHeader, const coreUintW iLevel)
+{
+    const coreUint32 iCurWidth  = MAX(oHeader.iWidth  >> iLevel, 1u);
+    const coreUint32 iCurHeight = MAX(oHeader.iHeight >> iLevel, 1u);
+    const coreUint32 iCurSize   = iCurWidth * iCurHeight * oHeader.iComponents;
+
+    switch(oHeader.iFormat)
+    {
+    default: UNREACHABLE
+    case CORE_TEXTURE_COOK_RAW: return iCurSize;
+    case CORE_TEXTURE_COOK_DXT: return iCurSize / stb_dxt_ratio(oHeader.iComponents);
+    case CORE_TEXTURE_COOK_BC7: return iCurSize / bc7enc_ratio (oHeader.iComponents);
+    }
+}
+
+
 // ****************************************************************
 /* constructor */
 coreTextureVolume::coreTextureVolume()noexcept
@@ -1067,4 +1371,457 @@ void coreTextureCube::Delete()
     m_vResolution = coreVector2(0.0f,0.0f);
     m_eMode       = CORE_TEXTURE_MODE_DEFAULT;
     m_Spec        = coreTextureSpec(0u, 0u, 0u, 0u, 0u);
+}
+
+
+// ****************************************************************
+/* compress image blocks in parallel */
+void coreTexture::__CompressBlocks(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput, const coreUint8 iType)
+{
+    // prepare compression job
+    coreBlockJob oJob;
+    oJob.iWidth      = iInWidth;
+    oJob.iComponents = iComponents;
+    oJob.pInput      = ASSUME_ALIGNED(pInput,  ALIGNMENT_NEW);
+    oJob.pOutput     = ASSUME_ALIGNED(pOutput, ALIGNMENT_NEW);
+    oJob.iType       = iType;
+
+    // distribute rows of blocks over all threads (only for larger images)
+    Core::Manager::Job->ParallelFor(iInHeight / 4u, CORE_TEXTURE_BLOCK_ROWS, [&](const coreUintW iFrom, const coreUintW iTo)
+    {
+        coreTexture::__CompressRows(oJob, iFrom, iTo);
+    });
+}
+
+
+// ****************************************************************
+/* compress a range of block rows */
+void coreTexture::__CompressRows(const coreBlockJob& oJob, const coreUintW iFrom, const coreUintW iTo)
+{
+    const coreUintW iWidth      = oJob.iWidth;
+    const coreUintW iComponents = oJob.iComponents;
+
+    // save memory offsets
+    const coreUintW iInOffsetX  = 4u * iComponents;
+    const coreUintW iInOffsetY  = 4u * iComponents * iWidth;   // per row of blocks
+    const coreUintW iOutOffsetX = 16u * iComponents / ((oJob.iType == __CORE_TEXTURE_BLOCK_BC7) ? bc7enc_ratio(iComponents) : stb_dxt_ratio(iComponents));   // size per block
+    const coreUintW iOutOffsetY = iOutOffsetX * (iWidth / 4u);
+
+    for(coreUintW y = iFrom; y < iTo; ++y)
+    {
+        const coreByte* pInput  = oJob.pInput  + y * iInOffsetY;
+        coreByte*       pOutput = oJob.pOutput + y * iOutOffsetY;
+
+        // loop through all blocks in the row
+        for(coreUintW x = 0u, xe = LOOP_NONZERO(iWidth / 4u); x < xe; ++x)
+        {
+            alignas(ALIGNMENT_CACHE) coreByte aBlock[64];
+
+            // copy data into 4x4 RGBA block
+            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i)       * 4u, pInput + (i)             * iComponents, 4u);
+            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i +  4u) * 4u, pInput + (i + 1u*iWidth) * iComponents, 4u);
+            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i +  8u) * 4u, pInput + (i + 2u*iWidth) * iComponents, 4u);
+            for(coreUintW i = 0u; i < 4u; ++i) std::memcpy(aBlock + (i + 12u) * 4u, pInput + (i + 3u*iWidth) * iComponents, iComponents);
+
+            // compress block
+            switch(oJob.iType)
+            {
+            default: UNREACHABLE
+            case __CORE_TEXTURE_BLOCK_DXT: stb_compress_dxt_block(pOutput, aBlock, iComponents, STB_DXT_HIGHQUAL); break;
+            case __CORE_TEXTURE_BLOCK_BC7: bc7enc_compress_block (pOutput, aBlock, iComponents, 0);                break;
+
+            case __CORE_TEXTURE_BLOCK_DXT_FAST:
+                switch(iComponents)
+                {
+                case 4u: stb__CompressAlphaBlock(pOutput, aBlock, STB_DXT_NORMAL); coreTexture::__CompressColorFast(pOutput + 8u, aBlock); break;
+                case 3u: coreTexture::__CompressColorFast(pOutput, aBlock); break;
+                default: stb_compress_dxt_block(pOutput, aBlock, iComponents, STB_DXT_NORMAL); break;   // alpha blocks are already fast
+                }
+                break;
+            }
+
+            // increment pointers
+            pInput  += iInOffsetX;
+            pOutput += iOutOffsetX;
+        }
+    }
+}
+
+
+// ****************************************************************
+/* compress color block with bounding box endpoints (DXT1/BC1, without refinement) */
+void coreTexture::__CompressColorFast(coreByte* OUTPUT pOutput, const coreByte* pBlock)
+{
+    ASSERT(pOutput && pBlock)
+
+    coreUint32 iMin, iMax;
+
+#if defined(_CORE_SSE_)
+
+    // load all 16 texels
+    const __m128i A = _mm_load_si128(r_cast<const __m128i*>(pBlock) + 0u);
+    const __m128i B = _mm_load_si128(r_cast<const __m128i*>(pBlock) + 1u);
+    const __m128i C = _mm_load_si128(r_cast<const __m128i*>(pBlock) + 2u);
+    const __m128i D = _mm_load_si128(r_cast<const __m128i*>(pBlock) + 3u);
+
+    // find min and max value per channel
+    __m128i vMin = _mm_min_epu8(_mm_min_epu8(A, B), _mm_min_epu8(C, D));
+    __m128i vMax = _mm_max_epu8(_mm_max_epu8(A, B), _mm_max_epu8(C, D));
+    vMin = _mm_min_epu8(vMin, _mm_shuffle_epi32(vMin, _MM_SHUFFLE(1u, 0u, 3u, 2u)));
+    vMax = _mm_max_epu8(vMax, _mm_shuffle_epi32(vMax, _MM_SHUFFLE(1u, 0u, 3u, 2u)));
+    vMin = _mm_min_epu8(vMin, _mm_shuffle_epi32(vMin, _MM_SHUFFLE(2u, 3u, 0u, 1u)));
+    vMax = _mm_max_epu8(vMax, _mm_shuffle_epi32(vMax, _MM_SHUFFLE(2u, 3u, 0u, 1u)));
+
+    iMin = _mm_cvtsi128_si32(vMin);
+    iMax = _mm_cvtsi128_si32(vMax);
+
+#elif defined(_CORE_NEON_)
+
+    // load all 16 texels (split into channels)
+    const uint8x16x4_t vBlock = vld4q_u8(pBlock);
+
+    // find min and max value per channel
+    iMin = vminvq_u8(vBlock.val[0]) | (vminvq_u8(vBlock.val[1]) << 8u) | (vminvq_u8(vBlock.val[2]) << 16u);
+    iMax = vmaxvq_u8(vBlock.val[0]) | (vmaxvq_u8(vBlock.val[1]) << 8u) | (vmaxvq_u8(vBlock.val[2]) << 16u);
+
+#else
+
+    // find min and max value per channel
+    coreByte aiMin[4] = {0xFFu, 0xFFu, 0xFFu, 0xFFu};
+    coreByte aiMax[4] = {0x00u, 0x00u, 0x00u, 0x00u};
+    for(coreUintW i = 0u; i < 64u; ++i)
+    {
+        aiMin[i % 4u] = MIN(aiMin[i % 4u], pBlock[i]);
+        aiMax[i % 4u] = MAX(aiMax[i % 4u], pBlock[i]);
+    }
+
+    std::memcpy(&iMin, aiMin, sizeof(coreUint32));
+    std::memcpy(&iMax, aiMax, sizeof(coreUint32));
+
+#endif
+
+    coreInt32 aiLow[3], aiHigh[3];
+    for(coreUintW i = 0u; i < 3u; ++i)
+    {
+        const coreInt32 iLow  = (iMin >> (i * 8u)) & 0xFFu;
+        const coreInt32 iHigh = (iMax >> (i * 8u)) & 0xFFu;
+
+        // inset bounding box (reduce influence of outliers)
+        const coreInt32 iInset = (iHigh - iLow) >> 4u;
+        aiLow [i] = iLow  + iInset;
+        aiHigh[i] = iHigh - iInset;
+    }
+
+    // quantize endpoints
+    coreUint16 iMax16 = stb__As16Bit(aiHigh[0], aiHigh[1], aiHigh[2]);
+    coreUint16 iMin16 = stb__As16Bit(aiLow [0], aiLow [1], aiLow [2]);
+    coreUint32 iMask  = 0u;
+
+    if(iMax16 != iMin16)
+    {
+        alignas(ALIGNMENT_SIMD) coreByte aColor[16];
+        stb__EvalColors(aColor, iMax16, iMin16);
+
+        // project texels and palette onto the endpoint axis
+        const coreInt32 iDirR = aColor[0] - aColor[4];
+        const coreInt32 iDirG = aColor[1] - aColor[5];
+        const coreInt32 iDirB = aColor[2] - aColor[6];
+
+        coreInt32 aiStop[4];
+        for(coreUintW i = 0u; i < 4u; ++i) aiStop[i] = aColor[i*4u] * iDirR + aColor[i*4u + 1u] * iDirG + aColor[i*4u + 2u] * iDirB;
+
+        // calculate crossover points (same as stb__MatchColorsBlock)
+        const coreInt32 iC0Point   = aiStop[1] + aiStop[3];
+        const coreInt32 iHalfPoint = aiStop[3] + aiStop[2];
+        const coreInt32 iC3Point   = aiStop[2] + aiStop[0];
+
+#if defined(_CORE_SSE_)
+
+        const __m128i vDir    = _mm_setr_epi16(iDirR, iDirG, iDirB, 0, iDirR, iDirG, iDirB, 0);
+        const __m128i vWeight = _mm_setr_epi16(1, 0, 4, 0, 16, 0, 64, 0);
+        const __m128i vC0     = _mm_set1_epi32(iC0Point);
+        const __m128i vHalf   = _mm_set1_epi32(iHalfPoint);
+        const __m128i vC3     = _mm_set1_epi32(iC3Point);
+        const __m128i vZero   = _mm_setzero_si128();
+        const __m128i vOne    = _mm_set1_epi32(1);
+        const __m128i vTwo    = _mm_set1_epi32(2);
+        const __m128i vThree  = _mm_set1_epi32(3);
+
+        const __m128i avTexel[] = {A, B, C, D};
+        for(coreUintW i = 0u; i < 4u; ++i)
+        {
+            // calculate dot products of four texels
+            const __m128i vLow  = _mm_madd_epi16(_mm_unpacklo_epi8(avTexel[i], vZero), vDir);
+            const __m128i vHigh = _mm_madd_epi16(_mm_unpackhi_epi8(avTexel[i], vZero), vDir);
+            const __m128i vDot  = _mm_slli_epi32(_mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vLow), _mm_castsi128_ps(vHigh), _MM_SHUFFLE(2u, 0u, 2u, 0u))),
+                                                               _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vLow), _mm_castsi128_ps(vHigh), _MM_SHUFFLE(3u, 1u, 3u, 1u)))), 1);
+
+            // select nearest palette index
+            const __m128i bC0   = _mm_cmplt_epi32(vDot, vC0);
+            const __m128i bHalf = _mm_cmplt_epi32(vDot, vHalf);
+            const __m128i bC3   = _mm_cmplt_epi32(vDot, vC3);
+            const __m128i vLower = _mm_or_si128(_mm_and_si128(bC0, vOne), _mm_andnot_si128(bC0, vThree));
+            const __m128i vUpper = _mm_and_si128(bC3, vTwo);
+            const __m128i vIndex = _mm_or_si128(_mm_and_si128(bHalf, vLower), _mm_andnot_si128(bHalf, vUpper));
+
+            // pack indices into 8 bits
+            __m128i vPacked = _mm_madd_epi16(vIndex, vWeight);
+            vPacked = _mm_add_epi32(vPacked, _mm_shuffle_epi32(vPacked, _MM_SHUFFLE(1u, 0u, 3u, 2u)));
+            vPacked = _mm_add_epi32(vPacked, _mm_shuffle_epi32(vPacked, _MM_SHUFFLE(2u, 3u, 0u, 1u)));
+
+            iMask |= coreUint32(_mm_cvtsi128_si32(vPacked)) << (i * 8u);
+        }
+
+#elif defined(_CORE_NEON_)
+
+        const int32x4_t  vC0    = vdupq_n_s32(iC0Point);
+        const int32x4_t  vHalf  = vdupq_n_s32(iHalfPoint);
+        const int32x4_t  vC3    = vdupq_n_s32(iC3Point);
+        const uint32x4_t vOne   = vdupq_n_u32(1u);
+        const uint32x4_t vTwo   = vdupq_n_u32(2u);
+        const uint32x4_t vThree = vdupq_n_u32(3u);
+        const int32x4_t  vShift = {0, 2, 4, 6};
+
+        for(coreUintW i = 0u; i < 2u; ++i)
+        {
+            // widen channels of eight texels
+            const int16x8_t vR = vreinterpretq_s16_u16(vmovl_u8(i ? vget_high_u8(vBlock.val[0]) : vget_low_u8(vBlock.val[0])));
+            const int16x8_t vG = vreinterpretq_s16_u16(vmovl_u8(i ? vget_high_u8(vBlock.val[1]) : vget_low_u8(vBlock.val[1])));
+            const int16x8_t vB = vreinterpretq_s16_u16(vmovl_u8(i ? vget_high_u8(vBlock.val[2]) : vget_low_u8(vBlock.val[2])));
+
+            for(coreUintW j = 0u; j < 2u; ++j)
+            {
+                // calculate dot products of four texels
+                int32x4_t vDot = vmull_n_s16(j ? vget_high_s16(vR) : vget_low_s16(vR), iDirR);
+                vDot = vmlal_n_s16(vDot, j ? vget_high_s16(vG) : vget_low_s16(vG), iDirG);
+                vDot = vmlal_n_s16(vDot, j ? vget_high_s16(vB) : vget_low_s16(vB), iDirB);
+                vDot = vshlq_n_s32(vDot, 1);
+
+                // select nearest palette index
+                const uint32x4_t vIndex = vbslq_u32(vcltq_s32(vDot, vHalf), vbslq_u32(vcltq_s32(vDot, vC0), vOne, vThree),
+                                                                            vandq_u32(vcltq_s32(vDot, vC3), vTwo));
+
+                // pack indices into 8 bits
+                iMask |= vaddvq_u32(vshlq_u32(vIndex, vShift)) << ((i * 2u + j) * 8u);
+            }
+        }
+
+#else
+
+        iMask = stb__MatchColorsBlock(c_cast<coreByte*>(pBlock), aColor);
+
+#endif
+    }
+
+    // sort endpoints (always use four-color mode)
+    if(iMax16 < iMin16)
+    {
+        std::swap(iMax16, iMin16);
+        iMask ^= 0x55555555u;
+    }
+
+    // write color block
+    std::memcpy(pOutput + 0u, &iMax16, sizeof(coreUint16));
+    std::memcpy(pOutput + 2u, &iMin16, sizeof(coreUint16));
+    std::memcpy(pOutput + 4u, &iMask,  sizeof(coreUint32));
+}
+
+
+// ****************************************************************
+/* filter single mipmap level (separable, vertical first) */
+void coreTexture::__FilterLevel(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pBytes, const coreFloat* pFloats, coreFloat* OUTPUT pOutput, const coreTextureMipmap eMipmap)
+{
+    ASSERT((pBytes || pFloats) && pOutput)
+
+    // decode color values to linear space
+    static const auto s_afDecode = []()
+    {
+        std::array<coreFloat, 512u> afTable;
+        for(coreUintW i = 0u; i < 256u; ++i)
+        {
+            const coreFloat fValue = I_TO_F(i) / 255.0f;
+            afTable[i]        = fValue;
+            afTable[i + 256u] = (fValue <= 0.04045f) ? (fValue / 12.92f) : POW((fValue + 0.055f) / 1.055f, 2.4f);
+        }
+        return afTable;
+    }();
+
+    constexpr coreUintW iMaxTaps = 12u;
+
+    // select filter kernel (radius in target texels)
+    coreUintW iTaps;
+    coreFloat fRadius;
+    switch(eMipmap & CORE_TEXTURE_MIPMAP_FILTER)
+    {
+    default: UNREACHABLE
+    case CORE_TEXTURE_MIPMAP_BOX:     iTaps =  2u; fRadius = 0.5f; break;
+    case CORE_TEXTURE_MIPMAP_KAISER:  iTaps =  8u; fRadius = 2.0f; break;
+    case CORE_TEXTURE_MIPMAP_LANCZOS: iTaps = 12u; fRadius = 3.0f; break;
+    }
+
+    const coreUintW iHalf = iTaps / 2u;
+
+    // calculate filter weights (for exact 2:1 reduction, same for every target texel)
+    alignas(ALIGNMENT_SIMD) coreFloat afWeight[iMaxTaps];
+    {
+        const auto nSinc   = [](const coreFloat x) {return (ABS(x) < CORE_MATH_PRECISION) ? 1.0f : (SIN(PI * x) / (PI * x));};
+        const auto nBessel = [](const coreFloat x) {coreFloat fSum = 1.0f, fTerm = 1.0f; for(coreUintW k = 1u; k < 16u; ++k) {fTerm *= (0.5f * x) / I_TO_F(k); fSum += fTerm * fTerm;} return fSum;};
+
+        coreFloat fTotal = 0.0f;
+        for(coreUintW k = 0u; k < iTaps; ++k)
+        {
+            const coreFloat fOffset = (I_TO_F(k) - I_TO_F(iHalf) + 0.5f) * 0.5f;   // distance to target texel center
+
+            switch(eMipmap & CORE_TEXTURE_MIPMAP_FILTER)
+            {
+            default: UNREACHABLE
+            case CORE_TEXTURE_MIPMAP_BOX:     afWeight[k] = 1.0f;                                                                                             break;
+            case CORE_TEXTURE_MIPMAP_KAISER:  afWeight[k] = nSinc(fOffset) * nBessel(4.0f * SQRT(MAX(1.0f - POW2(fOffset / fRadius), 0.0f))) / nBessel(4.0f); break;
+            case CORE_TEXTURE_MIPMAP_LANCZOS: afWeight[k] = nSinc(fOffset) * nSinc(fOffset / fRadius);                                                         break;
+            }
+
+            fTotal += afWeight[k];
+        }
+
+        // normalize filter weights
+        for(coreUintW k = 0u; k < iTaps; ++k) afWeight[k] /= fTotal;
+    }
+
+    // handle borders (clamp or wrap around)
+    const coreBool bRepeat = HAS_FLAG(eMipmap, CORE_TEXTURE_MIPMAP_REPEAT);
+    const auto nBorder = [&](const coreIntW iIndex, const coreUintW iSize) -> coreUintW
+    {
+        return bRepeat ? (iIndex & (iSize - 1u)) : CLAMP(iIndex, 0, coreIntW(iSize) - 1);
+    };
+
+    const coreUintW iOutWidth  = MAX(iInWidth  >> 1u, 1u);
+    const coreUintW iOutHeight = MAX(iInHeight >> 1u, 1u);
+    const coreUintW iRowSize   = iInWidth * iComponents;
+
+    // allocate padded row (with border texels on both sides) and cache for decoded rows
+    const coreUintW iCacheRows = pBytes ? (iTaps + 2u) : 0u;
+    coreFloat* pRow   = TEMP_NEW(coreFloat, (iInWidth + iTaps) * iComponents);
+    coreFloat* pCache = iCacheRows ? TEMP_NEW(coreFloat, iCacheRows * iRowSize) : NULL;
+
+    coreIntW aiCacheKey[iMaxTaps + 2u];
+    std::fill_n(aiCacheKey, iMaxTaps + 2u, -1);
+
+    // select decoding table per component
+    const coreFloat* apDecode[4];
+    for(coreUintW c = 0u; c < 4u; ++c)
+    {
+        apDecode[c] = s_afDecode.data() + ((HAS_FLAG(eMipmap, CORE_TEXTURE_MIPMAP_SRGB) && !HAS_FLAG(eMipmap, CORE_TEXTURE_MIPMAP_NORMAL) && (iComponents >= 3u) && (c < 3u)) ? 256u : 0u);
+    }
+
+    for(coreUintW y = 0u; y < iOutHeight; ++y)
+    {
+        const coreFloat* apSource[iMaxTaps];
+
+        // fetch all required source rows
+        for(coreUintW k = 0u; k < iTaps; ++k)
+        {
+            const coreIntW  iRaw   = coreIntW(2u * y + k) - coreIntW(iHalf) + 1;
+            const coreUintW iIndex = nBorder(iRaw, iInHeight);
+
+            if(pBytes)
+            {
+                // decode row only once (rows are shared between target rows)
+                const coreUintW iSlot   = (iRaw + coreIntW(iCacheRows * iInHeight)) % iCacheRows;   // unique within window
+                coreFloat*      pCached = pCache + iSlot * iRowSize;
+
+                if(aiCacheKey[iSlot] != coreIntW(iIndex))
+                {
+                    aiCacheKey[iSlot] = iIndex;
+
+                    const coreByte* pLine = pBytes + iIndex * iRowSize;
+                    for(coreUintW i = 0u; i < iRowSize; ++i) pCached[i] = apDecode[i % iComponents][pLine[i]];
+                }
+
+                apSource[k] = pCached;
+            }
+            else
+            {
+                apSource[k] = pFloats + iIndex * iRowSize;
+            }
+        }
+
+        // filter vertically
+        coreFloat* pTarget = pRow + (iHalf - 1u) * iComponents;
+        coreUintW  i       = 0u;
+
+#if defined(_CORE_SSE_)
+
+        for(; i + 4u <= iRowSize; i += 4u)
+        {
+            __m128 vSum = _mm_mul_ps(_mm_loadu_ps(apSource[0] + i), _mm_set1_ps(afWeight[0]));
+            for(coreUintW k = 1u; k < iTaps; ++k) vSum = _mm_add_ps(vSum, _mm_mul_ps(_mm_loadu_ps(apSource[k] + i), _mm_set1_ps(afWeight[k])));
+            _mm_storeu_ps(pTarget + i, vSum);
+        }
+
+#elif defined(_CORE_NEON_)
+
+        for(; i + 4u <= iRowSize; i += 4u)
+        {
+            float32x4_t vSum = vmulq_n_f32(vld1q_f32(apSource[0] + i), afWeight[0]);
+            for(coreUintW k = 1u; k < iTaps; ++k) vSum = vmlaq_n_f32(vSum, vld1q_f32(apSource[k] + i), afWeight[k]);
+            vst1q_f32(pTarget + i, vSum);
+        }
+
+#endif
+
+        for(; i < iRowSize; ++i)
+        {
+            coreFloat fSum = 0.0f;
+            for(coreUintW k = 0u; k < iTaps; ++k) fSum += apSource[k][i] * afWeight[k];
+            pTarget[i] = fSum;
+        }
+
+        // fill border texels
+        for(coreUintW x = 0u; x < iHalf - 1u; ++x) std::memcpy(pRow + x * iComponents, pTarget + nBorder(coreIntW(x) - coreIntW(iHalf) + 1, iInWidth) * iComponents, sizeof(coreFloat) * iComponents);
+        for(coreUintW x = 0u; x < iHalf;      ++x) std::memcpy(pTarget + (iInWidth + x) * iComponents, pTarget + nBorder(coreIntW(iInWidth + x), iInWidth) * iComponents, sizeof(coreFloat) * iComponents);
+
+        // filter horizontally
+        coreFloat* pLine = pOutput + y * iOutWidth * iComponents;
+
+#if defined(_CORE_SSE_) || defined(_CORE_NEON_)
+
+        if(iComponents == 4u)
+        {
+            // process whole texels at once
+            for(coreUintW x = 0u; x < iOutWidth; ++x)
+            {
+                const coreFloat* pBase = pRow + x * 8u;
+
+    #if defined(_CORE_SSE_)
+                __m128 vSum = _mm_mul_ps(_mm_loadu_ps(pBase), _mm_set1_ps(afWeight[0]));
+                for(coreUintW k = 1u; k < iTaps; ++k) vSum = _mm_add_ps(vSum, _mm_mul_ps(_mm_loadu_ps(pBase + k * 4u), _mm_set1_ps(afWeight[k])));
+                _mm_storeu_ps(pLine + x * 4u, vSum);
+    #else
+                float32x4_t vSum = vmulq_n_f32(vld1q_f32(pBase), afWeight[0]);
+                for(coreUintW k = 1u; k < iTaps; ++k) vSum = vmlaq_n_f32(vSum, vld1q_f32(pBase + k * 4u), afWeight[k]);
+                vst1q_f32(pLine + x * 4u, vSum);
+    #endif
+            }
+        }
+        else
+
+#endif
+        {
+            for(coreUintW x = 0u; x < iOutWidth; ++x)
+            {
+                const coreFloat* pBase = pRow + x * 2u * iComponents;
+
+                for(coreUintW c = 0u; c < iComponents; ++c)
+                {
+                    coreFloat fSum = 0.0f;
+                    for(coreUintW k = 0u; k < iTaps; ++k) fSum += pBase[k * iComponents + c] * afWeight[k];
+                    pLine[x * iComponents + c] = fSum;
+                }
+            }
+        }
+    }
+
+    // free temporary memory
+    TEMP_DELETE(pRow)
+    TEMP_DELETE(pCache)
 }
\ No newline at end of file
@@ -13,15 +13,13 @@
 // TODO 3: implement sampler objects
 // TODO 3: implement light unbind (like in model and program)
 // TODO 3: load, check proper use of PBO, maybe implement static buffer(s!) -> PBO seems to work, but not with automatic mipmap generation (stalls there)
-// TODO 3: improve mipmap filtering quality (replace box filter with better filter (e.g. gaussian, lanczos), check for border (repeat or clamp depending on sampling), consider overflow) (what about stb_image_resize.h ? in a (real) test the library took 3-20 times as long)
-// TODO 3: implement specialized mipmap generation for normal maps
+// TODO 3: use CPU mipmap generation (with filter selection) also for uncompressed textures (instead of glGenerateMipmap)
 // TODO 3: implement normal map compression (e.g. use DXT5 for normal maps (g and a channel (max precision) for x and y -> reconstruct z in shader))
 // TODO 5: check out AMD compressonator, BPTC (BC6 (HDR), BC7 (HQ)), ASTC (4x4, 6x6, 8x8) or even ETC1 (RGB) and ETC2 (RGB, RGBA)
 // TODO 5: <old comment style>
 // TODO 3: fill remaining mip-maps on compressed textures
 // TODO 3: distribute texture-loading across multiple iterations (maybe only decompression<>processing)
 // TODO 3: allow updating of all cube-map faces at once (native for direct-state, fallback for old function)
-// TODO 3: upload mipmaps with a single PBO (offset?)
 // TODO 5: move specs into indexed table, or encode into uint like SDL_PixelFormat (also for vertex specs)
 
 
@@ -73,6 +71,14 @@
 #define CORE_TEXTURE_UNITS        (CORE_TEXTURE_UNITS_2D + CORE_TEXTURE_UNITS_SHADOW)   // total number of texture units
 #define CORE_TEXTURE_SHADOW       (CORE_TEXTURE_UNITS_2D)                               // first shadow texture unit
 #define CORE_TEXTURE_LOD_BIAS     (-0.2f)                                               // make all textures a little bit sharper (if possible)
+#define CORE_TEXTURE_BLOCK_ROWS   (16u)                                                 // number of block rows per compression job
+
+#define CORE_TEXTURE_COOKED_MAGIC   (UINT_LITERAL("CTX0"))   // magic number of cooked textures
+#define CORE_TEXTURE_COOKED_VERSION (0x00000001u)            // current file version of cooked textures
+
+#define __CORE_TEXTURE_BLOCK_DXT      (0u)
+#define __CORE_TEXTURE_BLOCK_DXT_FAST (1u)
+#define __CORE_TEXTURE_BLOCK_BC7      (2u)
 
 enum coreTextureMode : coreUint8
 {
@@ -82,11 +88,12 @@ enum coreTextureMode : coreUint8
     CORE_TEXTURE_MODE_FILTER        = 0x04u,   // perform anisotropic filtering and mipmapping
     CORE_TEXTURE_MODE_NEAREST       = 0x08u,   // perform nearest texture sampling (instead of linear)
     CORE_TEXTURE_MODE_REPEAT        = 0x10u,   // perform repeating texture sampling (for coordinates outside 0.0 and 1.0)
-    CORE_TEXTURE_MODE_TARGET        = 0x20u    // use texture as render target
+    CORE_TEXTURE_MODE_TARGET        = 0x20u,   // use texture as render target
+    CORE_TEXTURE_MODE_COMPRESS_FAST = 0x41u    // perform fastest color texture compression (DXT with simple endpoint search, 1-4 channels)
 };
 ENABLE_BITWISE(coreTextureMode)
 
-enum coreTextureLoad : coreUint8
+enum coreTextureLoad : coreUint16
 {
     CORE_TEXTURE_LOAD_DEFAULT       = 0x00u,   // use default configuration
     CORE_TEXTURE_LOAD_NO_COMPRESS   = 0x01u,   // disable color texture compression
@@ -95,10 +102,35 @@ enum coreTextureLoad : coreUint8
     CORE_TEXTURE_LOAD_REPEAT        = 0x08u,   // enable repeating texture sampling (for coordinates outside 0.0 and 1.0)
     CORE_TEXTURE_LOAD_COMPRESS_HIGH = 0x10u,   // enable high quality texture compression
     CORE_TEXTURE_LOAD_R             = 0x20u,   // convert to R texture (if supported)
-    CORE_TEXTURE_LOAD_RG            = 0x40u    // convert to RG texture (if supported)
+    CORE_TEXTURE_LOAD_RG            = 0x40u,   // convert to RG texture (if supported)
+    CORE_TEXTURE_LOAD_COMPRESS_FAST = 0x80u,   // enable fastest texture compression (lower quality)
+    CORE_TEXTURE_LOAD_MIP_KAISER    = 0x0100u, // generate mipmaps with Kaiser filter (instead of box filter, only on CPU)
+    CORE_TEXTURE_LOAD_MIP_LANCZOS   = 0x0200u, // generate mipmaps with Lanczos filter (instead of box filter, only on CPU)
+    CORE_TEXTURE_LOAD_MIP_SRGB      = 0x0400u, // generate mipmaps in linear color space (for sRGB encoded color data)
+    CORE_TEXTURE_LOAD_NORMAL_MAP    = 0x0800u  // generate mipmaps with renormalized vectors (for normal maps)
 };
 ENABLE_BITWISE(coreTextureLoad)
 
+enum coreTextureMipmap : coreUint8
+{
+    CORE_TEXTURE_MIPMAP_BOX     = 0x00u,   // average 2x2 texels (fastest)
+    CORE_TEXTURE_MIPMAP_KAISER  = 0x01u,   // use Kaiser-windowed sinc filter (8 taps, sharper with little ringing)
+    CORE_TEXTURE_MIPMAP_LANCZOS = 0x02u,   // use Lanczos filter (12 taps, sharpest with some ringing)
+    CORE_TEXTURE_MIPMAP_FILTER  = 0x03u,   // (mask for filter selection)
+    CORE_TEXTURE_MIPMAP_SRGB    = 0x04u,   // filter color channels in linear space (only with 3-4 components)
+    CORE_TEXTURE_MIPMAP_REPEAT  = 0x08u,   // wrap around borders (instead of clamping)
+    CORE_TEXTURE_MIPMAP_NORMAL  = 0x10u    // renormalize vectors (with 2-4 components, overrides sRGB)
+};
+ENABLE_BITWISE(coreTextureMipmap)
+
+enum coreTextureCook : coreUint8
+{
+    CORE_TEXTURE_COOK_RAW      = 0u,   // store uncompressed pixel data (always used for non-power-of-two images)
+    CORE_TEXTURE_COOK_DXT      = 1u,   // store fast color texture compression   (DXT or RGTC, 1-4 channels)
+    CORE_TEXTURE_COOK_BC7      = 2u,   // store high quality texture compression (BC7, 3-4 channels)
+    CORE_TEXTURE_COOK_DXT_FAST = 3u    // store fastest color texture compression (saved as DXT)
+};
+
 
 // ****************************************************************
 /* texture specification structure */
@@ -119,17 +151,43 @@ struct coreTextureSpec final
 /* texture class */
 class coreTexture final : public coreResource
 {
+private:
+    /* cooked texture header structure */
+    struct coreCookedHeader final
+    {
+        coreUint32 iMagic;        // magic number (CTX0)
+        coreUint32 iVersion;      // file version
+        coreUint32 iWidth;        // width of the base level
+        coreUint32 iHeight;       // height of the base level
+        coreUint8  iFormat;       // stored data format (coreTextureCook)
+        coreUint8  iComponents;   // number of components
+        coreUint8  iLevels;       // number of stored levels
+        coreUint8  iPadding;      // (unused)
+    };
+
+    /* parallel block compression job structure */
+    struct coreBlockJob final
+    {
+        coreUintW       iWidth;        // image width
+        coreUintW       iComponents;   // number of components
+        const coreByte* pInput;        // uncompressed image
+        coreByte*       pOutput;       // compressed image
+        coreUint8       iType;         // block compression type
+    };
+
+
 private:
     GLuint m_iIdentifier;                                // texture identifier
 
     coreVector2 m_vResolution;                           // resolution of the base level
     coreUint8   m_iLevels;                               // number of texture levels
-    coreUint8   m_iCompressed;                           // compression status (0 = no compression | 1 = fast | 2 = high quality)
+    coreUint8   m_iCompressed;                           // compression status (0 = no compression | 1 = fast | 2 = high quality | 3 = fastest)
 
     coreTextureMode m_eMode;                             // texture mode (sampling)
     coreTextureSpec m_Spec;                              // texture specification (format)
 
-    coreTextureLoad m_eLoad;                             // resource load configuration
+    coreTextureLoad  m_eLoad;                            // resource load configuration
+    coreSurfaceScope m_pPrepared;                        // decoded pixel data (from resource preparation)
 
     coreSync m_Sync;                                     // sync object for asynchronous texture loading
 
@@ -147,6 +205,9 @@ public:
     coreStatus Load(coreFile* pFile)final;
     coreStatus Unload()final;
 
+    /* decode texture resource data (without OpenGL context) */
+    coreStatus Prepare(coreFile* pFile)final;
+
     /* get resource type */
     inline coreResourceType GetResourceType()const final {return CORE_RESOURCE_TYPE_GRAPHICS;}
 
@@ -185,14 +246,34 @@ public:
 
     /* process and convert image data */
     static void         CreateNextLevel    (const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput);
-    static void         CreateCompressedDXT(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput);
+    static void         CreateMipmaps      (const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, const coreUintW iLevels, coreByte* OUTPUT pOutput, const coreTextureMipmap eMipmap);   // (all levels stored consecutively)
+    static coreUintW    MipmapsSize        (const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreUintW iLevels);
+    static void         CreateCompressedDXT(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput, const coreBool bFast = false);
     static void         CreateCompressedBC7(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput);
     static SDL_Surface* CreateReduction    (const coreUintW iComponents, const SDL_Surface* pInput, SDL_Surface* OUTPUT pOutput = NULL);
 
+    /* handle cooked textures (GPU-ready with all levels) */
+    static coreByte* CreateCooked(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, const coreTextureCook eCook, const coreTextureMipmap eMipmap, coreUint32* OUTPUT piSize);
+    static coreBool  IsCooked    (coreFile* pFile);
+
 
 private:
+    /* load cooked texture resource data */
+    coreStatus __LoadCooked(coreFile* pFile);
+
     /* bind texture to texture unit */
     static void __BindTexture(const coreUintW iUnit, coreTexture* pTexture);
+
+    /* calculate size of a stored level */
+    static coreUint32 __CookedLevelSize(const coreCookedHeader& oHeader, const coreUintW iLevel);
+
+    /* compress image blocks in parallel */
+    static void __CompressBlocks(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput, const coreUint8 iType);
+    static void __CompressRows(const coreBlockJob& oJob, const coreUintW iFrom, const coreUintW iTo);
+    static void __CompressColorFast(coreByte* OUTPUT pOutput, const coreByte* pBlock);
+
+    /* filter single mipmap level */
+    static void __FilterLevel(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pBytes, const coreFloat* pFloats, coreFloat* OUTPUT pOutput, const coreTextureMipmap eMipmap);
 };
 
 
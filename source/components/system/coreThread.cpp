@@ -8,6 +8,8 @@
 ///////////////////////////////////////////////////////////
 #include "Core.h"
 
+static THREAD_LOCAL coreJobWorker* s_pCurWorker = NULL;   // job worker of the current thread (NULL = no worker)
+
 
 // ****************************************************************
 /* constructor */
@@ -180,8 +182,8 @@ coreStatus coreThread::__Main()
     Core::Log->Info("Thread (%s, %04lX) started", m_sName.c_str(), SDL_GetCurrentThreadID());
     coreStatus eReturn = this->__InitThread();
 
-    // cache time coefficient (# also to handle engine reset)
-    const coreDouble dFrequency = Core::System->GetPerfFrequency();
+    // cache time coefficient (# also to handle engine reset, and threads started without system component)
+    const coreDouble dFrequency = STATIC_ISVALID(Core::System) ? Core::System->GetPerfFrequency() : coreDouble(SDL_GetPerformanceFrequency());
     ASSERT(dFrequency)
 
     // begin main-loop
@@ -240,4 +242,489 @@ coreInt32 SDLCALL coreThreadMain(void* pData)
 
     // execute the thread
     return pThread->__Main();
+}
+
+
+// ****************************************************************
+/* constructor */
+coreJob::coreJob(const coreJobFunc pFunction, void* pData, const coreUintW iIndex, coreJob* pParent)noexcept
+: m_pFunction   (pFunction)
+, m_pData       (pData)
+, m_iIndex      (iIndex)
+, m_pParent     (pParent)
+, m_iUnfinished (1u)
+{
+    // register as child (parent must not be finished yet)
+    if(m_pParent)
+    {
+        ASSERT(!m_pParent->IsFinished())
+        m_pParent->m_iUnfinished.fetch_add(1u, std::memory_order::relaxed);
+    }
+}
+
+
+// ****************************************************************
+/* execute the job */
+void coreJob::__Execute()
+{
+    // call function
+    if(m_pFunction) m_pFunction(m_pData, m_iIndex);
+
+    // finish own part
+    this->__Finish();
+}
+
+
+// ****************************************************************
+/* finish part of the job */
+void coreJob::__Finish()
+{
+    // cache parent (job may be deleted immediately after finishing)
+    coreJob* pParent = m_pParent;
+
+    // propagate completion to the parent
+    if((m_iUnfinished.fetch_sub(1u, std::memory_order::acq_rel) == 1u) && pParent) pParent->__Finish();
+}
+
+
+// ****************************************************************
+/* constructor */
+coreJobQueue::coreJobQueue()noexcept
+: m_apJob   {}
+, m_iTop    (0)
+, m_iBottom (0)
+{
+}
+
+
+// ****************************************************************
+/* add job on the owning thread */
+coreBool coreJobQueue::Push(coreJob* pJob)
+{
+    const coreInt64 iBottom = m_iBottom.load(std::memory_order::relaxed);
+    const coreInt64 iTop    = m_iTop   .load(std::memory_order::acquire);
+
+    // check for free space
+    if(iBottom - iTop >= coreInt64(CORE_JOB_QUEUE_SIZE)) return false;
+
+    // write job and publish it to other threads
+    m_apJob[iBottom & (CORE_JOB_QUEUE_SIZE - 1u)].store(pJob, std::memory_order::relaxed);
+    m_iBottom.store(iBottom + 1, std::memory_order::release);
+
+    return true;
+}
+
+
+// ****************************************************************
+/* remove newest job on the owning thread */
+coreJob* coreJobQueue::Pop()
+{
+    // reserve newest job
+    const coreInt64 iBottom = m_iBottom.load(std::memory_order::relaxed) - 1;
+    m_iBottom.store(iBottom, std::memory_order::seq_cst);
+    coreInt64 iTop = m_iTop.load(std::memory_order::seq_cst);
+
+    // check for empty queue
+    if(iTop > iBottom)
+    {
+        m_iBottom.store(iBottom + 1, std::memory_order::relaxed);
+        return NULL;
+    }
+
+    coreJob* pJob = m_apJob[iBottom & (CORE_JOB_QUEUE_SIZE - 1u)].load(std::memory_order::relaxed);
+
+    if(iTop == iBottom)
+    {
+        // race against stealing threads for the last job
+        if(!m_iTop.compare_exchange_strong(iTop, iTop + 1, std::memory_order::seq_cst, std::memory_order::relaxed)) pJob = NULL;
+        m_iBottom.store(iBottom + 1, std::memory_order::relaxed);
+    }
+
+    return pJob;
+}
+
+
+// ****************************************************************
+/* remove oldest job on other threads */
+coreJob* coreJobQueue::Steal()
+{
+    coreInt64       iTop    = m_iTop   .load(std::memory_order::seq_cst);
+    const coreInt64 iBottom = m_iBottom.load(std::memory_order::seq_cst);
+
+    // check for empty queue
+    if(iTop >= iBottom) return NULL;
+
+    // race against the owning thread and other stealing threads
+    coreJob* pJob = m_apJob[iTop & (CORE_JOB_QUEUE_SIZE - 1u)].load(std::memory_order::relaxed);
+    if(!m_iTop.compare_exchange_strong(iTop, iTop + 1, std::memory_order::seq_cst, std::memory_order::relaxed)) return NULL;
+
+    return pJob;
+}
+
+
+// ****************************************************************
+/* constructor */
+coreJobWorker::coreJobWorker(const coreUintW iIndex)noexcept
+: coreThread (PRINT("job_worker_%02zu", iIndex))
+, m_Queue    ()
+, m_iIndex   (iIndex)
+, m_iIdle    (0u)
+{
+}
+
+
+// ****************************************************************
+/* destructor */
+coreJobWorker::~coreJobWorker()
+{
+    // kill the thread
+    this->KillThread();
+}
+
+
+// ****************************************************************
+/* init job worker thread */
+coreStatus coreJobWorker::__InitThread()
+{
+    // associate worker with the current thread
+    s_pCurWorker = this;
+
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* run job worker thread */
+coreStatus coreJobWorker::__RunThread()
+{
+    coreJobManager* pManager = Core::Manager::Job;
+
+    // find and execute next job
+    coreJob* pJob = pManager->__FindJob(this);
+    if(pJob)
+    {
+        pJob->__Execute();
+        m_iIdle = 0u;
+        return CORE_OK;
+    }
+
+    // keep spinning for a while
+    if(++m_iIdle < CORE_JOB_SPIN_COUNT) return CORE_OK;
+    m_iIdle = 0u;
+
+    // announce sleep and search again (to not miss any job queued in the meantime)
+    pManager->m_iNumSleeping.fetch_add(1u, std::memory_order::seq_cst);
+    pJob = pManager->__FindJob(this);
+
+    // go to sleep until new jobs are queued (no timeout required, as the announcement prevents lost wake-ups)
+    if(!pJob && !pManager->m_bShutdown.load(std::memory_order::relaxed)) SDL_WaitSemaphore(pManager->m_pSemaphore);
+    pManager->m_iNumSleeping.fetch_sub(1u, std::memory_order::relaxed);
+
+    // execute job found before sleeping
+    if(pJob) pJob->__Execute();
+
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* exit job worker thread */
+void coreJobWorker::__ExitThread()
+{
+    // check for remaining jobs
+    ASSERT(!m_Queue.Steal())
+
+    // remove worker association
+    s_pCurWorker = NULL;
+}
+
+
+// ****************************************************************
+/* constructor */
+coreJobManager::coreJobManager()noexcept
+: m_apWorker     {}
+, m_apShared     {}
+, m_iSharedHead  (0u)
+, m_iSharedTail  (0u)
+, m_SharedLock   ()
+, m_pSemaphore   (SDL_CreateSemaphore(0u))
+, m_iNumSleeping (0u)
+, m_bShutdown    (false)
+{
+    WARN_IF(!m_pSemaphore) Core::Log->Warning("Job semaphore could not be created (SDL: %s)", SDL_GetError());
+
+#if !defined(_CORE_SINGLE_)
+
+    if(m_pSemaphore)
+    {
+        // create one worker thread per additional processor core (the current thread helps while waiting)
+        const coreUintW iNumWorkers = coreUintW(MAX(coreData::SystemCpuCores(), 1u) - 1u);
+        m_apWorker.reserve(iNumWorkers);
+
+        for(coreUintW i = 0u; i < iNumWorkers; ++i)
+        {
+            m_apWorker.push_back(new coreJobWorker(i));
+        }
+
+        // start all worker threads (after the list is complete, as they steal from each other)
+        FOR_EACH(it, m_apWorker) (*it)->StartThread();
+    }
+
+#endif
+
+    Core::Log->Info(CORE_LOG_BOLD("Job Manager created") " (%zu worker threads)", m_apWorker.size());
+}
+
+
+// ****************************************************************
+/* destructor */
+coreJobManager::~coreJobManager()
+{
+    ASSERT(m_iSharedHead == m_iSharedTail)
+
+    // prevent further sleeping and wake up all worker threads (each one sleeps at most once more)
+    m_bShutdown.store(true, std::memory_order::relaxed);
+    FOR_EACH(it, m_apWorker) SDL_SignalSemaphore(m_pSemaphore);
+
+    // shut down all worker threads
+    FOR_EACH(it, m_apWorker) (*it)->KillThread();
+    FOR_EACH(it, m_apWorker) SAFE_DELETE(*it)
+
+    // delete wake-up signal
+    if(m_pSemaphore) SDL_DestroySemaphore(m_pSemaphore);
+
+    // clear memory
+    m_apWorker.clear();
+
+    Core::Log->Info(CORE_LOG_BOLD("Job Manager destroyed"));
+}
+
+
+// ****************************************************************
+/* queue job for execution */
+void coreJobManager::Run(coreJob* pJob)
+{
+    ASSERT(pJob && !pJob->IsFinished())
+
+    // add job to the queue of the current worker thread or to the shared queue
+    const coreBool bQueued = s_pCurWorker ? s_pCurWorker->m_Queue.Push(pJob) : this->__PushShared(pJob);
+
+    if(!bQueued)
+    {
+        // execute directly (if the queue is full)
+        pJob->__Execute();
+        return;
+    }
+
+    // wake up a sleeping worker thread
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    if(m_iNumSleeping.load(std::memory_order::relaxed)) SDL_SignalSemaphore(m_pSemaphore);
+}
+
+
+// ****************************************************************
+/* wait for job completion */
+void coreJobManager::Wait(const coreJob* pJob)
+{
+    ASSERT(pJob)
+
+    while(!pJob->IsFinished())
+    {
+        // execute child jobs in the meantime (unrelated jobs could stall the current thread for too long)
+        coreJob* pChild = this->__FindChild(pJob);
+        if(pChild) pChild->__Execute();
+              else CORE_LOCK_YIELD
+    }
+}
+
+
+// ****************************************************************
+/* add job to the shared queue */
+coreBool coreJobManager::__PushShared(coreJob* pJob)
+{
+    const coreLocker oLocker(&m_SharedLock);
+
+    const coreUint32 iHead = m_iSharedHead.load(std::memory_order::relaxed);
+    const coreUint32 iTail = m_iSharedTail.load(std::memory_order::relaxed);
+
+    // check for free space
+    if(iTail - iHead >= CORE_JOB_QUEUE_SIZE) return false;
+
+    // write job
+    m_apShared[iTail & (CORE_JOB_QUEUE_SIZE - 1u)] = pJob;
+    m_iSharedTail.store(iTail + 1u, std::memory_order::relaxed);
+
+    return true;
+}
+
+
+// ****************************************************************
+/* remove oldest job from the shared queue */
+coreJob* coreJobManager::__PopShared()
+{
+    // check for empty queue (without locking)
+    if(m_iSharedHead.load(std::memory_order::relaxed) == m_iSharedTail.load(std::memory_order::relaxed)) return NULL;
+
+    const coreLocker oLocker(&m_SharedLock);
+
+    const coreUint32 iHead = m_iSharedHead.load(std::memory_order::relaxed);
+    const coreUint32 iTail = m_iSharedTail.load(std::memory_order::relaxed);
+
+    // check again (may have been removed in the meantime)
+    if(iHead == iTail) return NULL;
+
+    // read job
+    coreJob* pJob = m_apShared[iHead & (CORE_JOB_QUEUE_SIZE - 1u)];
+    m_iSharedHead.store(iHead + 1u, std::memory_order::relaxed);
+
+    return pJob;
+}
+
+
+// ****************************************************************
+/* remove oldest child job from the shared queue */
+coreJob* coreJobManager::__PopShared(const coreJob* pRoot)
+{
+    ASSERT(pRoot)
+
+    // check for empty queue (without locking)
+    if(m_iSharedHead.load(std::memory_order::relaxed) == m_iSharedTail.load(std::memory_order::relaxed)) return NULL;
+
+    const coreLocker oLocker(&m_SharedLock);
+
+    const coreUint32 iHead = m_iSharedHead.load(std::memory_order::relaxed);
+    const coreUint32 iTail = m_iSharedTail.load(std::memory_order::relaxed);
+
+    for(coreUint32 i = iHead; i != iTail; ++i)
+    {
+        // search for the oldest job belonging to the root job (queued jobs and their parents are still valid)
+        coreJob* pJob = m_apShared[i & (CORE_JOB_QUEUE_SIZE - 1u)];
+        if(pJob->__IsPartOf(pRoot))
+        {
+            // move all older jobs into the gap (to keep their order)
+            for(coreUint32 j = i; j != iHead; --j)
+            {
+                m_apShared[j & (CORE_JOB_QUEUE_SIZE - 1u)] = m_apShared[(j - 1u) & (CORE_JOB_QUEUE_SIZE - 1u)];
+            }
+            m_iSharedHead.store(iHead + 1u, std::memory_order::relaxed);
+
+            return pJob;
+        }
+    }
+
+    return NULL;
+}
+
+
+// ****************************************************************
+/* find next job for the current thread */
+coreJob* coreJobManager::__FindJob(coreJobWorker* pWorker)
+{
+    coreJob* pJob;
+
+    // take newest job from own queue
+    if(pWorker && (pJob = pWorker->m_Queue.Pop())) return pJob;
+
+    // take oldest job from the shared queue
+    if((pJob = this->__PopShared())) return pJob;
+
+    // steal oldest job from other worker threads (start with the next one, to spread contention)
+    const coreUintW iNum   = m_apWorker.size();
+    const coreUintW iStart = pWorker ? (pWorker->m_iIndex + 1u) : 0u;
+
+    for(coreUintW i = 0u; i < iNum; ++i)
+    {
+        coreJobWorker* pOther = m_apWorker[(iStart + i) % iNum];
+        if((pOther != pWorker) && (pJob = pOther->m_Queue.Steal())) return pJob;
+    }
+
+    return NULL;
+}
+
+
+// ****************************************************************
+/* find next child job of a waited job */
+coreJob* coreJobManager::__FindChild(const coreJob* pRoot)
+{
+    coreJob* pJob;
+
+    if(s_pCurWorker && (pJob = s_pCurWorker->m_Queue.Pop()))
+    {
+        // take newest job from own queue
+        if(pJob->__IsPartOf(pRoot)) return pJob;
+
+        // search the whole own queue (unrelated jobs queued by executed children would otherwise hide all older child jobs)
+        coreJobQueue& oQueue = s_pCurWorker->m_Queue;
+        coreJob*      pFound = NULL;
+
+        const coreArenaScope oScope(coreThreadArena());
+        coreJob** ppSkipped = s_cast<coreJob**>(coreThreadArena()->Allocate(sizeof(coreJob*) * CORE_JOB_QUEUE_SIZE, alignof(coreJob*)));
+        coreUintW iSkipped  = 0u;
+
+        do
+        {
+            if(pJob->__IsPartOf(pRoot)) {pFound = pJob; break;}
+            ppSkipped[iSkipped++] = pJob;
+        }
+        while((pJob = oQueue.Pop()));
+
+        // put all unrelated jobs back (oldest first, which restores their order)
+        while(iSkipped)
+        {
+            coreJob* pSkipped = ppSkipped[--iSkipped];
+            if(!oQueue.Push(pSkipped)) pSkipped->__Execute();   // # cannot fail, space was freed before
+        }
+
+        if(pFound) return pFound;
+    }
+
+    // take oldest child job from the shared queue (other worker queues are not searched, their jobs may already be executed)
+    return this->__PopShared(pRoot);
+}
+
+
+// ****************************************************************
+/* distribute loop over all threads */
+void coreJobManager::__ParallelFor(const coreUintW iCount, const coreUintW iChunk, const coreJobRangeFunc pFunction, const void* pData)
+{
+    ASSERT(iCount && iChunk && pFunction)
+
+    /* parallel loop structure */
+    struct coreRange final
+    {
+        coreJobRangeFunc pFunction;   // range function to execute
+        const void*      pData;       // custom data forwarded to the function
+        coreUintW        iCount;      // total number of iterations
+        coreUintW        iChunk;      // number of iterations per job
+    };
+
+    const coreRange oRange     = {pFunction, pData, iCount, iChunk};
+    const coreUintW iNumChunks = coreMath::DivUp(iCount, iChunk);
+
+    // allocate temporary job memory
+    const coreArenaScope oScope(coreThreadArena());
+    coreJob* pJobs = s_cast<coreJob*>(coreThreadArena()->Allocate(sizeof(coreJob) * iNumChunks, alignof(coreJob)));
+
+    // create parent job (to wait for all chunks at once)
+    coreJob oParent(NULL, NULL, 0u);
+
+    // queue all chunks except the first one
+    for(coreUintW i = 1u; i < iNumChunks; ++i)
+    {
+        coreJob* pJob = new(pJobs + i) coreJob([](void* pData, const coreUintW iIndex)
+        {
+            const coreRange* pRange = s_cast<const coreRange*>(pData);
+            pRange->pFunction(pRange->pData, iIndex * pRange->iChunk, MIN((iIndex + 1u) * pRange->iChunk, pRange->iCount));
+        },
+        c_cast<coreRange*>(&oRange), i, &oParent);
+
+        this->Run(pJob);
+    }
+
+    // work on the current thread too
+    pFunction(pData, 0u, MIN(iChunk, iCount));
+    oParent.__Execute();
+
+    // wait for all chunks to finish
+    this->Wait(&oParent);
 }
\ No newline at end of file
@@ -22,6 +22,12 @@
 
 using coreThreadToken = coreUint32;      // function token type
 
+#define CORE_JOB_QUEUE_SIZE (4096u)      // max number of queued jobs per worker thread and in the shared queue (power of two)
+#define CORE_JOB_SPIN_COUNT (256u)       // number of unsuccessful job searches before a worker thread goes to sleep
+
+using coreJobFunc      = void (*) (void* pData, const coreUintW iIndex);                               // job function type
+using coreJobRangeFunc = void (*) (const void* pData, const coreUintW iFrom, const coreUintW iTo);   // job range function type (for parallel loops)
+
 
 // ****************************************************************
 /* thread interface */
@@ -119,4 +125,171 @@ template <typename F> coreThreadToken coreThread::AttachFunction(F&& nFunction,
 }
 
 
+// ****************************************************************
+/* job class */
+class coreJob final
+{
+private:
+    coreJobFunc             m_pFunction;     // function to execute (NULL to only group child jobs)
+    void*                   m_pData;         // custom data forwarded to the function
+    coreUintW               m_iIndex;        // custom index forwarded to the function
+    coreJob*                m_pParent;       // parent job (not finished before all its children are finished)
+    std::atomic<coreUint32> m_iUnfinished;   // number of unfinished jobs (itself and all children)
+
+
+public:
+    coreJob(const coreJobFunc pFunction, void* pData, const coreUintW iIndex, coreJob* pParent = NULL)noexcept;
+
+    DISABLE_COPY(coreJob)
+
+    /* check for completion (including all children) */
+    inline coreBool IsFinished()const {return !m_iUnfinished.load(std::memory_order::acquire);}
+
+
+private:
+    /* execute and finish the job */
+    void __Execute();
+    void __Finish ();
+
+    /* check for relation to another job (itself or any parent) */
+    inline coreBool __IsPartOf(const coreJob* pRoot)const {for(const coreJob* pJob = this; pJob; pJob = pJob->m_pParent) if(pJob == pRoot) return true; return false;}
+
+    /* allow access to job execution */
+    friend class coreJobWorker;
+    friend class coreJobManager;
+};
+
+
+// ****************************************************************
+/* work-stealing job queue class */
+class coreJobQueue final
+{
+private:
+    std::atomic<coreJob*> m_apJob[CORE_JOB_QUEUE_SIZE];                     // ring buffer with queued jobs
+
+    alignas(ALIGNMENT_CACHE) std::atomic<coreInt64> m_iTop;                 // position of the oldest job (for stealing threads)
+    alignas(ALIGNMENT_CACHE) std::atomic<coreInt64> m_iBottom;              // position after the newest job (for the owning thread)
+
+
+public:
+    coreJobQueue()noexcept;
+
+    DISABLE_COPY(coreJobQueue)
+
+    /* add and remove jobs on the owning thread (newest first) */
+    coreBool Push(coreJob* pJob);
+    coreJob* Pop ();
+
+    /* remove jobs on other threads (oldest first) */
+    coreJob* Steal();
+};
+
+
+// ****************************************************************
+/* job worker thread class */
+class coreJobWorker final : public coreThread
+{
+private:
+    coreJobQueue m_Queue;    // own work-stealing job queue
+    coreUintW    m_iIndex;   // index within the worker list
+    coreUint32   m_iIdle;    // number of unsuccessful job searches
+
+
+public:
+    explicit coreJobWorker(const coreUintW iIndex)noexcept;
+    ~coreJobWorker()final;
+
+    DISABLE_COPY(coreJobWorker)
+
+
+private:
+    /* execute the thread */
+    coreStatus __InitThread()final;
+    coreStatus __RunThread ()final;
+    void       __ExitThread()final;
+
+    /* allow access to the job queue */
+    friend class coreJobManager;
+};
+
+
+// ****************************************************************
+/* job manager */
+class coreJobManager final
+{
+private:
+    coreList<coreJobWorker*> m_apWorker;                         // worker threads (each with its own work-stealing job queue)
+
+    coreJob*                 m_apShared[CORE_JOB_QUEUE_SIZE];   // shared queue with jobs from other threads
+    std::atomic<coreUint32>  m_iSharedHead;                     // position of the oldest shared job
+    std::atomic<coreUint32>  m_iSharedTail;                     // position after the newest shared job
+    coreLock                 m_SharedLock;                      // lock for the shared queue
+
+    SDL_Semaphore*           m_pSemaphore;                      // wake-up signal for sleeping worker threads
+    std::atomic<coreUint32>  m_iNumSleeping;                    // current number of sleeping worker threads
+    std::atomic<coreBool>    m_bShutdown;                       // worker threads are shutting down (and must not sleep anymore)
+
+
+public:
+    coreJobManager()noexcept;
+    ~coreJobManager();
+
+    DISABLE_COPY(coreJobManager)
+
+    /* queue job for execution */
+    void Run(coreJob* pJob);
+
+    /* wait for job completion (and execute its child jobs in the meantime) */
+    void Wait(const coreJob* pJob);
+
+    /* distribute loop over all threads (including the current one) and wait for completion */
+    template <typename F> void ParallelFor(const coreUintW iCount, const coreUintW iChunk, F&& nFunction);   // [](const coreUintW iFrom, const coreUintW iTo) -> void
+
+    /* get object properties */
+    inline coreUintW GetNumWorkers()const {return m_apWorker.size();}
+    inline coreUintW GetNumThreads()const {return m_apWorker.size() + 1u;}
+
+
+private:
+    /* handle the shared queue */
+    coreBool __PushShared(coreJob* pJob);
+    coreJob* __PopShared ();
+    coreJob* __PopShared (const coreJob* pRoot);
+
+    /* find next job for the current thread */
+    coreJob* __FindJob  (coreJobWorker* pWorker);
+    coreJob* __FindChild(const coreJob* pRoot);
+
+    /* distribute loop (without template) */
+    void __ParallelFor(const coreUintW iCount, const coreUintW iChunk, const coreJobRangeFunc pFunction, const void* pData);
+
+    /* allow access to job search */
+    friend class coreJobWorker;
+};
+
+
+// ****************************************************************
+/* distribute loop over all threads */
+template <typename F> void coreJobManager::ParallelFor(const coreUintW iCount, const coreUintW iChunk, F&& nFunction)
+{
+    ASSERT(iChunk)
+
+    if(!iCount) return;
+
+    // execute directly (if there is nothing to distribute)
+    if((iCount <= iChunk) || m_apWorker.empty())
+    {
+        nFunction(0u, iCount);
+        return;
+    }
+
+    // distribute chunks as separate jobs
+    this->__ParallelFor(iCount, iChunk, [](const void* pData, const coreUintW iFrom, const coreUintW iTo)
+    {
+        (*s_cast<const std::remove_reference_t<F>*>(pData))(iFrom, iTo);
+    },
+    &nFunction);
+}
+
+
 #endif /* _CORE_GUARD_THREAD_H_ */
\ No newline at end of file
@@ -8,76 +8,280 @@
 ///////////////////////////////////////////////////////////
 #include "Core.h"
 
-alignas(ALIGNMENT_PAGE) static coreByte s_aaTempBuffer [CORE_MEMORY_TEMP_NUM][CORE_MEMORY_TEMP_SIZE] = {};
-static coreUintW                        s_aiTempPointer[CORE_MEMORY_TEMP_NUM]                        = {};
-static THREAD_LOCAL coreUintW           s_iTempIndex                                                 = SIZE_MAX;
+static THREAD_LOCAL coreArena* s_pThreadArena = NULL;   // memory-arena of the current thread (for temp-storage)
+static SDL_TLSID               s_ArenaTLS     = {};     // identifier for releasing memory-arenas on thread exit
+static coreArena               s_FrameArena;            // shared memory-arena reset at the end of each frame (main-thread only)
+
+static THREAD_LOCAL void* s_pThreadCache = NULL;        // thread-cache of the current thread (for managed memory-blocks)
+static SDL_TLSID          s_CacheTLS     = {};          // identifier for releasing thread-caches on thread exit
 
 
 // ****************************************************************
-/* initialize temp-storage */
-void coreTempStorageInit(const coreUintW iIndex)
+/* constructor */
+coreArena::coreArena(const coreUintW iPageSize)noexcept
+: m_pPage         (NULL)
+, m_pSpare        (NULL)
+, m_iOffset       (0u)
+, m_iPageSize     (iPageSize)
+, m_iHighWater    (0u)
+, m_iNumPages     (0u)
+, m_iNumOverflows (0u)
 {
-    ASSERT(iIndex < CORE_MEMORY_TEMP_NUM)
-    s_iTempIndex = iIndex;
 }
 
 
 // ****************************************************************
-/* allocate memory from the temp-storage */
-void* coreTempStorageAllocate(const coreUintW iSize, const coreUintW iAlign)
+/* destructor */
+coreArena::~coreArena()
 {
-    ASSERT(s_iTempIndex != SIZE_MAX)
-    ASSERT(iSize && iAlign)
+    // delete all memory-pages
+    while(m_pPage) this->__ReleasePage();
+    this->__DeleteSpare();
+}
+
+
+// ****************************************************************
+/* create memory-block */
+RETURN_RESTRICT void* coreArena::Allocate(const coreUintW iSize, const coreUintW iAlign)
+{
+    ASSERT(iSize && iAlign && coreMath::IsPot(iAlign))
+
+    if(m_pPage)
+    {
+        // calculate address range
+        const coreUintW iStart = coreMath::CeilAlign(P_TO_UI(m_pPage) + m_iOffset, iAlign) - P_TO_UI(m_pPage);
+        const coreUintW iEnd   = iStart + iSize;
+
+        // check if allocation fits into the current memory-page
+        if(iEnd <= m_pPage->iSize)
+        {
+            m_iOffset    = iEnd;
+            m_iHighWater = MAX(m_iHighWater, this->GetUsed());
 
-    const coreUintW I = s_iTempIndex;
+            return r_cast<coreByte*>(m_pPage) + iStart;
+        }
+
+        // track allocations exceeding the initial memory-page
+        m_iNumOverflows += 1u;
+    }
 
-    // select assigned temp-storage
-    coreByte*  B = s_aaTempBuffer [I];
-    coreUintW& P = s_aiTempPointer[I];
+    // chain new memory-page (large enough for the memory-block)
+    this->__AddPage(sizeof(coreArenaPage) + iSize + iAlign);
+
+    const coreUintW iStart = coreMath::CeilAlign(P_TO_UI(m_pPage) + m_iOffset, iAlign) - P_TO_UI(m_pPage);
+    m_iOffset    = iStart + iSize;
+    m_iHighWater = MAX(m_iHighWater, this->GetUsed());
+
+    return r_cast<coreByte*>(m_pPage) + iStart;
+}
 
-    // calculate address range
-    const coreUintW iStart = coreMath::CeilAlign(P, iAlign);
-    const coreUintW iEnd   = iStart + iSize;
 
-    // check if allocation fits into the temp-storage
-    if(iEnd <= CORE_MEMORY_TEMP_SIZE)
+// ****************************************************************
+/* remove memory-block and everything allocated after it */
+coreBool coreArena::Free(void** OUTPUT ppPointer)
+{
+    ASSERT(ppPointer && (*ppPointer))
+
+    // find memory-page containing the memory-block
+    for(coreArenaPage* pPage = m_pPage; pPage; pPage = pPage->pPrev)
     {
-        // adjust temp-storage pointer
-        P = iEnd;
-        return B + iStart;
+        const coreUintW iOffset = P_TO_UI(*ppPointer) - P_TO_UI(pPage);
+        if((iOffset >= sizeof(coreArenaPage)) && (iOffset < pPage->iSize))
+        {
+            // rewind to the memory-block
+            this->Rewind({pPage, iOffset});
+            (*ppPointer) = NULL;
+
+            return true;
+        }
     }
 
-    return NULL;
+    return false;
 }
 
 
 // ****************************************************************
-/* free memory from the temp-storage */
-coreBool coreTempStorageFree(void** OUTPUT pPointer)
+/* remove memory-block only if it was the last allocation (for standard containers) */
+void coreArena::Release(const void* pPointer, const coreUintW iSize)
 {
-    ASSERT(s_iTempIndex != SIZE_MAX)
-    ASSERT(pPointer && (*pPointer))
+    if(!m_pPage) return;
 
-    const coreUintW I = s_iTempIndex;
+    // move back the current position
+    const coreUintW iOffset = P_TO_UI(pPointer) - P_TO_UI(m_pPage);
+    if((iOffset >= sizeof(coreArenaPage)) && (iOffset + iSize == m_iOffset)) m_iOffset = iOffset;
+}
 
-    // select assigned temp-storage
-    coreByte*  B = s_aaTempBuffer [I];
-    coreUintW& P = s_aiTempPointer[I];
 
-    // calculate address range
-    const coreUintW iStart = P_TO_UI(*pPointer) - P_TO_UI(B);
+// ****************************************************************
+/* rewind memory-arena to a previous position */
+void coreArena::Rewind(const coreMarker& oMarker)
+{
+    // release all memory-pages created after the marker
+    while(m_pPage != oMarker.pPage) this->__ReleasePage();
 
-    // check if allocation is from the temp-storage
-    if(iStart <= CORE_MEMORY_TEMP_SIZE)
+    // restore offset (never move forward)
+    m_iOffset = MIN(m_iOffset, oMarker.iOffset);
+}
+
+
+// ****************************************************************
+/* reset memory-arena to its initial state */
+void coreArena::Reset()
+{
+    if(m_iNumOverflows)
     {
-        // adjust temp-storage pointer
-        P = MIN(P, iStart);
-        (*pPointer) = NULL;
+        // grow memory-pages to the high-water mark (to prevent chaining in the future)
+        m_iPageSize = coreMath::CeilAlign(m_iHighWater + sizeof(coreArenaPage), ALIGNMENT_PAGE);
+
+        // delete all memory-pages
+        while(m_pPage) this->__ReleasePage();
+        this->__DeleteSpare();
 
-        return true;
+        if(STATIC_ISVALID(Core::Log)) Core::Log->Warning("Memory-arena overflowed %u times (grown to %zu KB)", m_iNumOverflows, m_iPageSize / 1024u);
+    }
+    else
+    {
+        // keep single memory-page
+        this->Rewind({m_pPage, sizeof(coreArenaPage)});
     }
 
-    return false;
+    m_iNumOverflows = 0u;
+}
+
+
+// ****************************************************************
+/* chain new memory-page */
+void coreArena::__AddPage(const coreUintW iMinSize)
+{
+    const coreUintW iUsed = this->GetUsed();
+
+    // reuse spare memory-page or create a new one
+    coreArenaPage* pPage = m_pSpare;
+    if(pPage && (pPage->iSize >= iMinSize))
+    {
+        m_pSpare = pPage->pPrev;
+    }
+    else
+    {
+        const coreUintW iSize = coreMath::CeilAlign(MAX(iMinSize, m_iPageSize), ALIGNMENT_PAGE);
+
+        pPage        = s_cast<coreArenaPage*>(_aligned_malloc(iSize, ALIGNMENT_PAGE));
+        pPage->iSize = iSize;
+    }
+
+    // attach memory-page to the chain
+    pPage->pPrev       = m_pPage;
+    pPage->iUsedBefore = iUsed;
+
+    m_pPage     = pPage;
+    m_iOffset   = sizeof(coreArenaPage);
+    m_iNumPages += 1u;
+}
+
+
+// ****************************************************************
+/* move current memory-page to the spare list */
+void coreArena::__ReleasePage()
+{
+    ASSERT(m_pPage)
+
+    coreArenaPage* pPage = m_pPage;
+    m_pPage = pPage->pPrev;
+
+    // restore offset of the previous memory-page
+    if(m_pPage) m_iOffset = pPage->iUsedBefore - m_pPage->iUsedBefore + sizeof(coreArenaPage);
+
+    // keep only the largest spare memory-page (below the size limit, arenas without reset would hold it forever)
+    if((m_pSpare && (m_pSpare->iSize >= pPage->iSize)) || (pPage->iSize > CORE_MEMORY_ARENA_SPARE))
+    {
+        _aligned_free(pPage);
+    }
+    else
+    {
+        this->__DeleteSpare();
+
+        pPage->pPrev = NULL;
+        m_pSpare     = pPage;
+    }
+
+    m_iNumPages -= 1u;
+}
+
+
+// ****************************************************************
+/* delete spare memory-pages */
+void coreArena::__DeleteSpare()
+{
+    while(m_pSpare)
+    {
+        coreArenaPage* pPage = m_pSpare;
+        m_pSpare = pPage->pPrev;
+
+        _aligned_free(pPage);
+    }
+}
+
+
+// ****************************************************************
+/* release memory-arena of an exiting thread */
+static void SDLCALL ReleaseThreadArena(void* pData)
+{
+    coreArena* pArena = s_cast<coreArena*>(pData);
+    SAFE_DELETE(pArena)
+}
+
+
+// ****************************************************************
+/* get memory-arena of the current thread */
+coreArena* coreThreadArena()
+{
+    if(!s_pThreadArena)
+    {
+        // create memory-arena on first use
+        s_pThreadArena = new coreArena();
+
+        // release memory-arena on thread exit
+        SDL_SetTLS(&s_ArenaTLS, s_pThreadArena, ReleaseThreadArena);
+    }
+
+    return s_pThreadArena;
+}
+
+
+// ****************************************************************
+/* get shared frame memory-arena */
+coreArena* coreFrameArena()
+{
+    return &s_FrameArena;
+}
+
+
+// ****************************************************************
+/* allocate memory from the temp-storage */
+void* coreTempStorageAllocate(const coreUintW iSize, const coreUintW iAlign)
+{
+    coreArena* pArena = coreThreadArena();
+
+    // allocate from the memory-arena of the current thread
+    const coreUint32 iOldOverflows = pArena->GetNumOverflows();
+    void*            pPointer      = pArena->Allocate(iSize, iAlign);
+
+    // report overflows (thread memory-arenas are never reset, only report on power-of-two counts)
+    const coreUint32 iNewOverflows = pArena->GetNumOverflows();
+    if((iNewOverflows != iOldOverflows) && coreMath::IsPot(iNewOverflows))
+    {
+        if(STATIC_ISVALID(Core::Log)) Core::Log->Warning("Temp-storage overflowed %u times (last with %zu bytes, %zu KB in use)", iNewOverflows, iSize, pArena->GetUsed() / 1024u);
+    }
+
+    return pPointer;
+}
+
+
+// ****************************************************************
+/* free memory from the temp-storage */
+coreBool coreTempStorageFree(void** OUTPUT pPointer)
+{
+    return coreThreadArena()->Free(pPointer);
 }
 
 
@@ -117,30 +321,32 @@ s_Init;
 // ****************************************************************
 /* constructor */
 coreMemoryPool::coreMemoryPool()noexcept
-: m_apPageList  {}
-, m_apFreeStack {}
-, m_iBlockSize  (0u)
-, m_iPageSize   (0u)
-, m_iAlign      (0u)
-, m_bValid      (true)
-, m_pHeap       (NULL)
+: m_apPageList {}
+, m_pFreeList  (NULL)
+, m_iNumFree   (0u)
+, m_iBlockSize (0u)
+, m_iPageSize  (0u)
+, m_iAlign     (0u)
+, m_bValid     (true)
+, m_pHeap      (NULL)
 {
 }
 
-coreMemoryPool::coreMemoryPool(const coreUint16 iBlockSize, const coreUint16 iPageSize, const coreUint8 iAlign)noexcept
+coreMemoryPool::coreMemoryPool(const coreUint32 iBlockSize, const coreUint32 iPageSize, const coreUint8 iAlign)noexcept
 : coreMemoryPool ()
 {
     this->Configure(iBlockSize, iPageSize, iAlign);
 }
 
 coreMemoryPool::coreMemoryPool(coreMemoryPool&& m)noexcept
-: m_apPageList  (std::move(m.m_apPageList))
-, m_apFreeStack (std::move(m.m_apFreeStack))
-, m_iBlockSize  (m.m_iBlockSize)
-, m_iPageSize   (m.m_iPageSize)
-, m_iAlign      (m.m_iAlign)
-, m_bValid      (m.m_bValid)
-, m_pHeap       (std::exchange(m.m_pHeap, NULL))
+: m_apPageList (std::move(m.m_apPageList))
+, m_pFreeList  (std::exchange(m.m_pFreeList, NULL))
+, m_iNumFree   (std::exchange(m.m_iNumFree,  0u))
+, m_iBlockSize (m.m_iBlockSize)
+, m_iPageSize  (m.m_iPageSize)
+, m_iAlign     (m.m_iAlign)
+, m_bValid     (m.m_bValid)
+, m_pHeap      (std::exchange(m.m_pHeap, NULL))
 {
 }
 
@@ -162,13 +368,14 @@ coreMemoryPool::~coreMemoryPool()
 coreMemoryPool& coreMemoryPool::operator = (coreMemoryPool&& m)noexcept
 {
     // swap properties
-    std::swap(m_apPageList,  m.m_apPageList);
-    std::swap(m_apFreeStack, m.m_apFreeStack);
-    std::swap(m_iBlockSize,  m.m_iBlockSize);
-    std::swap(m_iPageSize,   m.m_iPageSize);
-    std::swap(m_iAlign,      m.m_iAlign);
-    std::swap(m_bValid,      m.m_bValid);
-    std::swap(m_pHeap,       m.m_pHeap);
+    std::swap(m_apPageList, m.m_apPageList);
+    std::swap(m_pFreeList,  m.m_pFreeList);
+    std::swap(m_iNumFree,   m.m_iNumFree);
+    std::swap(m_iBlockSize, m.m_iBlockSize);
+    std::swap(m_iPageSize,  m.m_iPageSize);
+    std::swap(m_iAlign,     m.m_iAlign);
+    std::swap(m_bValid,     m.m_bValid);
+    std::swap(m_pHeap,      m.m_pHeap);
 
     return *this;
 }
@@ -176,9 +383,9 @@ coreMemoryPool& coreMemoryPool::operator = (coreMemoryPool&& m)noexcept
 
 // ****************************************************************
 /* set required memory-pool properties */
-void coreMemoryPool::Configure(const coreUint16 iBlockSize, const coreUint16 iPageSize, const coreUint8 iAlign)
+void coreMemoryPool::Configure(const coreUint32 iBlockSize, const coreUint32 iPageSize, const coreUint8 iAlign)
 {
-    ASSERT(iBlockSize && iPageSize && iAlign && coreMath::IsPot(iAlign) && coreMath::IsAligned(iBlockSize, iAlign))
+    ASSERT((iBlockSize >= sizeof(void*)) && iPageSize && iAlign && coreMath::IsPot(iAlign) && coreMath::IsAligned(iBlockSize, iAlign))
     ASSERT(m_apPageList.empty())
 
     // save properties
@@ -195,7 +402,7 @@ void coreMemoryPool::Configure(const coreUint16 iBlockSize, const coreUint16 iPa
 /* reset memory-pool to its initial state */
 void coreMemoryPool::Reset()
 {
-    ASSERT((m_apFreeStack.size() == (m_apPageList.size() * m_iPageSize)) || !m_bValid)
+    ASSERT((m_iNumFree == (m_apPageList.size() * m_iPageSize)) || !m_bValid)
 
     // delete all memory-pages
     FOR_EACH(it, m_apPageList)
@@ -204,8 +411,9 @@ void coreMemoryPool::Reset()
     }
 
     // clear memory
-    m_apPageList .clear();
-    m_apFreeStack.clear();
+    m_apPageList.clear();
+    m_pFreeList = NULL;
+    m_iNumFree  = 0u;
 
     // revalidate memory-pool
     m_bValid = true;
@@ -228,12 +436,13 @@ RETURN_RESTRICT void* coreMemoryPool::Allocate()
     ASSERT(m_bValid)
 
     // check for free memory-block
-    if(m_apFreeStack.empty()) this->__AddPage();
-    ASSERT(!m_apFreeStack.empty())
+    if(!m_pFreeList) this->__AddPage();
+    ASSERT(m_pFreeList && m_iNumFree)
 
-    // get pointer from the free-stack
-    void* pMemory = m_apFreeStack.back();
-    m_apFreeStack.pop_back();
+    // take memory-block from the free-list
+    void* pMemory = m_pFreeList;
+    m_pFreeList = (*s_cast<void**>(pMemory));
+    m_iNumFree -= 1u;
 
     return pMemory;
 }
@@ -248,12 +457,10 @@ void coreMemoryPool::Free(void** OUTPUT ppPointer)
     // only return pointer if memory-pool is still valid
     if(m_bValid)
     {
-        // find target location with binary search
-        ASSERT(std::is_sorted(m_apFreeStack.begin(), m_apFreeStack.end(), std::greater<>()))
-        const auto it = std::lower_bound(m_apFreeStack.begin(), m_apFreeStack.end(), *ppPointer, std::greater<>());
-
-        // return pointer to the free-stack
-        m_apFreeStack.insert(it, *ppPointer);
+        // return memory-block to the free-list
+        (*s_cast<void**>(*ppPointer)) = m_pFreeList;
+        m_pFreeList = (*ppPointer);
+        m_iNumFree += 1u;
     }
 
     // remove reference
@@ -283,23 +490,25 @@ void coreMemoryPool::__AddPage()
     // align base address
     pNewPage = coreMath::CeilAlignPtr(pNewPage, m_iAlign);
 
-    // reserve memory for the free-stack
-    m_apFreeStack.reserve(m_apFreeStack.size() + m_iPageSize);
-
-    // add all containing memory-blocks to the free-stack
+    // add all containing memory-blocks to the free-list (in ascending order)
     for(coreUintW i = m_iPageSize; i--; )
     {
-        m_apFreeStack.push_back_unsafe(pNewPage + (m_iBlockSize * i));
+        void* pBlock = pNewPage + (m_iBlockSize * i);
+
+        (*s_cast<void**>(pBlock)) = m_pFreeList;
+        m_pFreeList = pBlock;
     }
+    m_iNumFree += m_iPageSize;
 }
 
 
 // ****************************************************************
 /* constructor */
 coreMemoryManager::coreMemoryManager()noexcept
-: m_apPointer   {}
-, m_aMemoryPool {}
-, m_PoolLock    ()
+: m_apPointer     {}
+, m_aSizeClass    {}
+, m_apThreadCache {}
+, m_CacheLock     ()
 {
     Core::Log->Info(CORE_LOG_BOLD("Memory Manager created"));
 }
@@ -309,40 +518,253 @@ coreMemoryManager::coreMemoryManager()noexcept
 /* destructor */
 coreMemoryManager::~coreMemoryManager()
 {
+    // detach thread-cache from the current thread
+    SDL_SetTLS(&s_CacheTLS, NULL, NULL);
+    s_pThreadCache = NULL;
+
+    // delete all thread-caches (other threads skip their release afterwards)
+    FOR_EACH(it, m_apThreadCache) ZERO_DELETE(*it)
+
+    // delete all memory-spans
+    for(coreUintW i = 0u; i < CORE_MEMORY_CLASSES; ++i)
+    {
+        FOR_EACH(it, m_aSizeClass[i].apSpan) ALIGNED_DELETE(*it)
+    }
+
     // clear memory
-    m_apPointer  .clear();
-    m_aMemoryPool.clear();
+    m_apPointer    .clear();
+    m_apThreadCache.clear();
 
     Core::Log->Info(CORE_LOG_BOLD("Memory Manager destroyed"));
 }
 
 
 // ****************************************************************
-/* create memory-block from internal memory-pool */
-RETURN_RESTRICT void* coreMemoryManager::Allocate(const coreUint16 iSize, const coreUint8 iAlign)
+/* create memory-block from thread-cache */
+RETURN_RESTRICT void* coreMemoryManager::Allocate(const coreUintW iSize, const coreUintW iAlign)
 {
-    const coreLocker oLocker(&m_PoolLock);
+    ASSERT(iSize && iAlign && coreMath::IsPot(iAlign))
 
-    // assemble lookup key
-    const coreUint32 iKey = (coreUint32(iSize) << 16u) | (coreUint32(iAlign));
+    // fall back to heap memory (for large or over-aligned memory-blocks)
+    const coreUintW iClass = coreMemoryManager::__GetClass(iSize, iAlign);
+    if(iClass >= CORE_MEMORY_CLASSES) return _aligned_malloc(iSize, MAX(iAlign, ALIGNMENT_NEW));
+
+    // get thread-cache of the current thread
+    coreThreadCache* pCache = this->__GetThreadCache();
+
+    // check for free memory-block
+    if(!pCache->apFreeList[iClass]) this->__RefillCache(pCache, iClass);
+    ASSERT(pCache->apFreeList[iClass] && pCache->aiNumFree[iClass])
 
-    // check and create memory-pool
-    if(!m_aMemoryPool.count(iKey)) m_aMemoryPool.emplace(iKey, iSize, 0x1000u / iSize, iAlign);
+    // take memory-block from the local free-list
+    void* pMemory = pCache->apFreeList[iClass];
+    pCache->apFreeList[iClass] = (*s_cast<void**>(pMemory));
+    pCache->aiNumFree [iClass] -= 1u;
+
+    return pMemory;
+}
+
+
+// ****************************************************************
+/* remove memory-block to thread-cache */
+void coreMemoryManager::Free(const coreUintW iSize, const coreUintW iAlign, void** OUTPUT ppPointer)
+{
+    ASSERT(iSize && iAlign && ppPointer && (*ppPointer))
+
+    // fall back to heap memory (for large or over-aligned memory-blocks)
+    const coreUintW iClass = coreMemoryManager::__GetClass(iSize, iAlign);
+    if(iClass >= CORE_MEMORY_CLASSES)
+    {
+        ALIGNED_DELETE(*ppPointer)
+        return;
+    }
+
+    // get thread-cache of the current thread
+    coreThreadCache* pCache = this->__GetThreadCache();
+
+    // return memory-block to the local free-list
+    (*s_cast<void**>(*ppPointer)) = pCache->apFreeList[iClass];
+    pCache->apFreeList[iClass] = (*ppPointer);
+    pCache->aiNumFree [iClass] += 1u;
+
+    // move surplus memory-blocks back to the size-class (e.g. when freeing objects from another thread)
+    if(pCache->aiNumFree[iClass] > CORE_MEMORY_BATCH * 2u) this->__FlushCache(pCache, iClass, CORE_MEMORY_BATCH);
+
+    // remove reference
+    (*ppPointer) = NULL;
+}
+
+
+// ****************************************************************
+/* get thread-cache of the current thread */
+coreMemoryManager::coreThreadCache* coreMemoryManager::__GetThreadCache()
+{
+    // return existing thread-cache (without synchronization)
+    if(s_pThreadCache) return s_cast<coreThreadCache*>(s_pThreadCache);
+
+    // create new thread-cache
+    coreThreadCache* pCache = ZERO_NEW(coreThreadCache, 1u);
+    s_pThreadCache = pCache;
+
+    // register thread-cache
+    {
+        const coreLocker oLocker(&m_CacheLock);
+        m_apThreadCache.push_back(pCache);
+    }
+
+    // release thread-cache on thread exit
+    SDL_SetTLS(&s_CacheTLS, pCache, coreMemoryManager::__ReleaseThreadCache);
+
+    return pCache;
+}
+
+
+// ****************************************************************
+/* move batch of memory-blocks from size-class to thread-cache */
+void coreMemoryManager::__RefillCache(coreThreadCache* OUTPUT pCache, const coreUintW iClass)
+{
+    ASSERT(!pCache->apFreeList[iClass] && (iClass < CORE_MEMORY_CLASSES))
+
+    coreSizeClass& oClass = m_aSizeClass[iClass];
+    const coreLocker oLocker(&oClass.oLock);
+
+    if(!oClass.pFreeList)
+    {
+        const coreUintW iBlockSize = coreMemoryManager::__GetBlockSize(iClass);
+        const coreUintW iNumBlocks = CORE_MEMORY_SPAN_SIZE / iBlockSize;
+
+        // create new memory-span
+        coreByte* pSpan = ALIGNED_NEW(coreByte, CORE_MEMORY_SPAN_SIZE, ALIGNMENT_PAGE);
+        oClass.apSpan.push_back(pSpan);
+
+        // add all containing memory-blocks to the central free-list (in ascending order)
+        for(coreUintW i = iNumBlocks; i--; )
+        {
+            void* pBlock = pSpan + (iBlockSize * i);
+
+            (*s_cast<void**>(pBlock)) = oClass.pFreeList;
+            oClass.pFreeList = pBlock;
+        }
+    }
+
+    // find end of the batch
+    void*      pLast  = oClass.pFreeList;
+    coreUint32 iCount = 1u;
+    while((iCount < CORE_MEMORY_BATCH) && (*s_cast<void**>(pLast)))
+    {
+        pLast = (*s_cast<void**>(pLast));
+        ++iCount;
+    }
+
+    // detach batch from the central free-list
+    pCache->apFreeList[iClass] = oClass.pFreeList;
+    pCache->aiNumFree [iClass] = iCount;
+    oClass.pFreeList = (*s_cast<void**>(pLast));
+    (*s_cast<void**>(pLast)) = NULL;
+}
+
+
+// ****************************************************************
+/* move batch of memory-blocks from thread-cache to size-class */
+void coreMemoryManager::__FlushCache(coreThreadCache* OUTPUT pCache, const coreUintW iClass, const coreUint32 iCount)
+{
+    ASSERT(iCount && (iCount <= pCache->aiNumFree[iClass]) && (iClass < CORE_MEMORY_CLASSES))
+
+    // find end of the batch (outside of the lock)
+    void* pFirst = pCache->apFreeList[iClass];
+    void* pLast  = pFirst;
+    for(coreUintW i = 1u; i < iCount; ++i)
+    {
+        pLast = (*s_cast<void**>(pLast));
+    }
+
+    // detach batch from the local free-list
+    pCache->apFreeList[iClass] = (*s_cast<void**>(pLast));
+    pCache->aiNumFree [iClass] -= iCount;
+
+    coreSizeClass& oClass = m_aSizeClass[iClass];
+    const coreLocker oLocker(&oClass.oLock);
+
+    // attach batch to the central free-list
+    (*s_cast<void**>(pLast)) = oClass.pFreeList;
+    oClass.pFreeList = pFirst;
+}
+
+
+// ****************************************************************
+/* return all memory-blocks of an exiting thread */
+void SDLCALL coreMemoryManager::__ReleaseThreadCache(void* pData)
+{
+    // skip if the memory manager was already destroyed (together with all thread-caches)
+    if(!STATIC_ISVALID(Core::Manager::Memory)) return;
+
+    coreMemoryManager* pManager = Core::Manager::Memory;
+    coreThreadCache*   pCache   = s_cast<coreThreadCache*>(pData);
+
+    // move all memory-blocks back to the size-classes
+    for(coreUintW i = 0u; i < CORE_MEMORY_CLASSES; ++i)
+    {
+        if(pCache->aiNumFree[i]) pManager->__FlushCache(pCache, i, pCache->aiNumFree[i]);
+    }
+
+    // unregister thread-cache
+    {
+        const coreLocker oLocker(&pManager->m_CacheLock);
+        pManager->m_apThreadCache.erase(std::find(pManager->m_apThreadCache.begin(), pManager->m_apThreadCache.end(), pCache));
+    }
+
+    // delete thread-cache
+    ZERO_DELETE(pCache)
+    s_pThreadCache = NULL;
+}
+
+
+// ****************************************************************
+/* get size-class for memory-block size and alignment */
+coreUintW coreMemoryManager::__GetClass(const coreUintW iSize, const coreUintW iAlign)
+{
+    // skip alignments not guaranteed by the memory-spans
+    if(iAlign > ALIGNMENT_PAGE) return CORE_MEMORY_CLASSES;
+
+    // align size and clamp to the smallest block
+    const coreUintW iAligned = MAX(coreMath::CeilAlign(iSize, iAlign), sizeof(void*));
+    if(iAligned > __GetBlockSize(CORE_MEMORY_CLASSES - 1u)) return CORE_MEMORY_CLASSES;
+
+    coreUintW iClass;
+    if(iAligned <= 256u)
+    {
+        // use linear steps for small blocks (16 bytes)
+        iClass = (iAligned - 1u) >> 4u;
+    }
+    else
+    {
+        // use four steps per power-of-two for large blocks
+        const coreUintW iValue = iAligned - 1u;
+        const coreUintW iLog   = coreMath::BitScanRev(iValue);
+        iClass = 16u + (iLog - 8u) * 4u + ((iValue >> (iLog - 2u)) & 0x03u);
+    }
+
+    // find next block size which preserves the alignment
+    if(iAlign > ALIGNMENT_NEW)
+    {
+        while((iClass < CORE_MEMORY_CLASSES) && !coreMath::IsAligned(__GetBlockSize(iClass), iAlign)) ++iClass;
+    }
 
-    // forward request to internal memory-pool
-    return m_aMemoryPool.at(iKey).Allocate();
+    return iClass;
 }
 
 
 // ****************************************************************
-/* remove memory-block to internal memory-pool */
-void coreMemoryManager::Free(const coreUint16 iSize, const coreUint8 iAlign, void** OUTPUT ppPointer)
+/* get memory-block size of a size-class */
+coreUintW coreMemoryManager::__GetBlockSize(const coreUintW iClass)
 {
-    const coreLocker oLocker(&m_PoolLock);
+    ASSERT(iClass < CORE_MEMORY_CLASSES)
 
-    // assemble lookup key
-    const coreUint32 iKey = (coreUint32(iSize) << 16u) | (coreUint32(iAlign));
+    // linear steps for small blocks
+    if(iClass < 16u) return (iClass + 1u) * 16u;
 
-    // forward request to internal memory-pool
-    m_aMemoryPool.at(iKey).Free(ppPointer);
+    // four steps per power-of-two for large blocks
+    const coreUintW iOctave  = (iClass - 16u) / 4u;
+    const coreUintW iQuarter = (iClass - 16u) % 4u;
+    return (256u << iOctave) + (iQuarter + 1u) * (64u << iOctave);
 }
\ No newline at end of file
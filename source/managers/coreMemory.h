@@ -15,20 +15,23 @@
 // TODO 5: memory-pool: support polymorphism
 // TODO 5: memory-pool: 1 block for multiple objects (array support)
 // TODO 5: add interface for reusing big memory-blocks (free when?)
-// TODO 3: pointer to next free block inside unused block (linked list) instead of free-stack (consider sorting)
 // TODO 5: <old comment style>
 // TODO 3: #define STATIC_EXTERN(t,p) extern t* const p; needs to be before Core class
 // TODO 2: add ASSERT when accessing static-memory without initialization
 // TODO 3: manually merge various locations with multiple separate allocations (e.g. texture, MD3)
 // TODO 3: use (smaller) indices instead of pointers for the pool allocator (but different pages have non-consecutive base addresses, without big address-space pre-reservation)
-// TODO 3: improve temp-storage: detect duplicate index assignments, detect wrong interleaved alloc-frees (because pointer is just decreased to the minimum), RETURN_RESTRICT (but requires non-null)
+// TODO 3: improve temp-storage: detect wrong interleaved alloc-frees (because pointer is just decreased to the minimum), RETURN_RESTRICT (but requires non-null)
 // TODO 3: std::start_lifetime_as with C++23 (and when libraries support it)
 
 
 // ****************************************************************
 /* memory definitions */
-#define CORE_MEMORY_TEMP_NUM  (DEFINED(_CORE_SINGLE_) ? 1u : 2u)   // number of temp-buffers
-#define CORE_MEMORY_TEMP_SIZE (1u * 1024u * 1024u)                 // size of each temp-buffer
+#define CORE_MEMORY_ARENA_SIZE  (1u * 1024u * 1024u)   // default size of each memory-page in a memory-arena
+#define CORE_MEMORY_ARENA_SPARE (4u * 1024u * 1024u)   // maximum size of a spare memory-page kept for reuse (larger ones are deleted immediately)
+
+#define CORE_MEMORY_CLASSES    (40u)                   // number of size-classes for managed memory-blocks (16 bytes to 16 KB)
+#define CORE_MEMORY_SPAN_SIZE  (64u * 1024u)           // size of each memory-span carved into memory-blocks of one size-class
+#define CORE_MEMORY_BATCH      (32u)                   // number of memory-blocks moved at once between thread-caches and size-classes
 
 #define CORE_MEMORY_SHARED    (STRING(__FILE__) ":" STRING(__LINE__))
 #define CORE_MEMORY_UNIQUE    (PRINT(CORE_MEMORY_SHARED ":%p", this))
@@ -76,9 +79,126 @@
 #endif
 
 
+// ****************************************************************
+/* memory-arena class */
+class coreArena final
+{
+private:
+    /* memory-page structure (header in front of the memory) */
+    struct coreArenaPage final
+    {
+        coreArenaPage* pPrev;        // previous memory-page in the chain (or next spare memory-page)
+        coreUintW      iSize;        // total size of the memory-page (including header)
+        coreUintW      iUsedBefore;  // used memory of all previous memory-pages
+    };
+
+
+public:
+    /* marker structure (position to rewind to) */
+    struct coreMarker final
+    {
+        coreArenaPage* pPage;        // current memory-page
+        coreUintW      iOffset;      // offset within the current memory-page
+    };
+
+
+private:
+    coreArenaPage* m_pPage;          // current memory-page
+    coreArenaPage* m_pSpare;         // released memory-pages kept for reuse
+    coreUintW      m_iOffset;        // offset within the current memory-page
+    coreUintW      m_iPageSize;      // size of new memory-pages (grows to the high-water mark on reset)
+
+    coreUintW  m_iHighWater;         // highest amount of used memory
+    coreUint32 m_iNumPages;          // number of chained memory-pages
+    coreUint32 m_iNumOverflows;      // number of allocations which required an additional memory-page (since last reset)
+
+
+public:
+    explicit coreArena(const coreUintW iPageSize = CORE_MEMORY_ARENA_SIZE)noexcept;
+    ~coreArena();
+
+    DISABLE_COPY(coreArena)
+
+    /* create and remove memory-blocks */
+    RETURN_RESTRICT void* Allocate(const coreUintW iSize, const coreUintW iAlign);
+    coreBool Free   (void** OUTPUT ppPointer);
+    void     Release(const void* pPointer, const coreUintW iSize);
+
+    /* control memory-arena position */
+    inline coreMarker GetMarker()const {return {m_pPage, m_iOffset};}
+    void Rewind(const coreMarker& oMarker);
+    void Reset();
+
+    /* get statistics */
+    inline coreUintW  GetUsed        ()const {return m_pPage ? (m_pPage->iUsedBefore + m_iOffset - sizeof(coreArenaPage)) : 0u;}
+    inline coreUintW  GetHighWater   ()const {return m_iHighWater;}
+    inline coreUint32 GetNumPages    ()const {return m_iNumPages;}
+    inline coreUint32 GetNumOverflows()const {return m_iNumOverflows;}
+
+
+private:
+    /* handle memory-pages */
+    void __AddPage    (const coreUintW iMinSize);
+    void __ReleasePage();
+    void __DeleteSpare();
+};
+
+
+// ****************************************************************
+/* memory-arena scope class */
+class coreArenaScope final
+{
+private:
+    coreArena*            m_pArena;    // associated memory-arena
+    coreArena::coreMarker m_oMarker;   // position to rewind to
+
+
+public:
+    explicit coreArenaScope(coreArena* pArena)noexcept : m_pArena (pArena), m_oMarker (pArena->GetMarker()) {}
+    ~coreArenaScope() {m_pArena->Rewind(m_oMarker);}
+
+    DISABLE_COPY(coreArenaScope)
+    DISABLE_HEAP
+};
+
+
+// ****************************************************************
+/* memory-arena allocator class (for standard containers) */
+template <typename T> class coreArenaAllocator
+{
+private:
+    coreArena* m_pArena;   // associated memory-arena
+
+
+public:
+    using value_type = T;
+
+    constexpr explicit coreArenaAllocator(coreArena* pArena)noexcept                                : m_pArena (pArena)            {}
+    template <typename S> constexpr coreArenaAllocator(const coreArenaAllocator<S>& oOther)noexcept : m_pArena (oOther.GetArena()) {}
+
+    /* create and remove memory-blocks */
+    inline T*   allocate  (const coreUintW iNum)                         {return s_cast<T*>(m_pArena->Allocate(iNum * sizeof(T), alignof(T)));}
+    inline void deallocate(T* OUTPUT pPointer, const coreUintW iNum)noexcept {m_pArena->Release(pPointer, iNum * sizeof(T));}
+
+    /* compare memory-arenas */
+    template <typename S> constexpr coreBool operator == (const coreArenaAllocator<S>& oOther)const {return (m_pArena == oOther.GetArena());}
+
+    /* get object properties */
+    constexpr coreArena* GetArena()const {return m_pArena;}
+};
+
+template <typename T> using coreArenaList   = coreList<T, coreArenaAllocator<T>>;
+using                       coreArenaString = coreStringAlloc<coreArenaAllocator<coreChar>>;
+
+
+// ****************************************************************
+/* memory-arena functions */
+extern coreArena* coreThreadArena();   // memory-arena of the current thread (created on first use)
+extern coreArena* coreFrameArena ();   // shared memory-arena reset at the end of each frame (main-thread only)
+
+
 // ****************************************************************
 /* temp-storage functions */
-extern void     coreTempStorageInit    (const coreUintW iIndex);
 extern void*    coreTempStorageAllocate(const coreUintW iSize, const coreUintW iAlign);
 extern coreBool coreTempStorageFree    (void** OUTPUT pPointer);
 
@@ -88,20 +208,21 @@ extern coreBool coreTempStorageFree    (void** OUTPUT pPointer);
 class coreMemoryPool final
 {
 private:
-    coreList<coreByte*> m_apPageList;    // list with memory-pages containing many memory-blocks
-    coreList<void*>     m_apFreeStack;   // stack with pointers to free memory-blocks
+    coreList<coreByte*> m_apPageList;   // list with memory-pages containing many memory-blocks
+    void*               m_pFreeList;    // linked list with free memory-blocks (next pointer stored inside each free memory-block)
+    coreUint32          m_iNumFree;     // number of free memory-blocks
 
-    coreUint16 m_iBlockSize;             // memory-block size (in bytes)
-    coreUint16 m_iPageSize;              // memory-page size (in number of containing memory-blocks)
-    coreUint8  m_iAlign;                 // memory-block address alignment
-    coreBool   m_bValid;                 // current working state
+    coreUint32 m_iBlockSize;            // memory-block size (in bytes)
+    coreUint32 m_iPageSize;             // memory-page size (in number of containing memory-blocks)
+    coreUint8  m_iAlign;                // memory-block address alignment
+    coreBool   m_bValid;                // current working state
 
-    void* m_pHeap;                       // private heap object
+    void* m_pHeap;                      // private heap object
 
 
 public:
     coreMemoryPool()noexcept;
-    coreMemoryPool(const coreUint16 iBlockSize, const coreUint16 iPageSize, const coreUint8 iAlign = 1u)noexcept;
+    coreMemoryPool(const coreUint32 iBlockSize, const coreUint32 iPageSize, const coreUint8 iAlign = 1u)noexcept;
     coreMemoryPool(coreMemoryPool&& m)noexcept;
     ~coreMemoryPool();
 
@@ -111,7 +232,7 @@ public:
     coreMemoryPool& operator = (coreMemoryPool&& m)noexcept;
 
     /* control state of the memory-pool */
-    void Configure(const coreUint16 iBlockSize, const coreUint16 iPageSize, const coreUint8 iAlign = 1u);
+    void Configure(const coreUint32 iBlockSize, const coreUint32 iPageSize, const coreUint8 iAlign = 1u);
     void Reset();
     void Shutdown();
 
@@ -134,10 +255,29 @@ private:
 class coreMemoryManager final
 {
 private:
-    coreMapStr<std::weak_ptr<void>>     m_apPointer;     // list with weak shared memory pointer
-    coreMap<coreUint32, coreMemoryPool> m_aMemoryPool;   // internal memory-pools (each for a different size and alignment)
+    /* size-class structure */
+    struct coreSizeClass final
+    {
+        void*           pFreeList;   // central linked list with free memory-blocks
+        coreList<void*> apSpan;      // memory-spans carved into memory-blocks
+        coreLock        oLock;       // lock to prevent invalid size-class access
+    };
+
+    /* thread-cache structure */
+    struct coreThreadCache final
+    {
+        void*      apFreeList[CORE_MEMORY_CLASSES];   // local linked lists with free memory-blocks
+        coreUint32 aiNumFree [CORE_MEMORY_CLASSES];   // number of free memory-blocks per list
+    };
+
+
+private:
+    coreMapStr<std::weak_ptr<void>> m_apPointer;                   // list with weak shared memory pointer
 
-    coreLock m_PoolLock;                                 // lock to prevent invalid memory-pool access
+    coreSizeClass              m_aSizeClass[CORE_MEMORY_CLASSES];   // central free-lists (each for a different block size)
+    coreList<coreThreadCache*> m_apThreadCache;                     // thread-caches of all threads with managed memory-blocks
+
+    coreLock m_CacheLock;                                           // lock to prevent invalid thread-cache list access
 
 
 private:
@@ -152,9 +292,21 @@ public:
     /* share memory pointer through specific identifier */
     template <typename T, typename... A> std::shared_ptr<T> Share(const coreHashString& sName, A&&... vArgs);
 
-    /* create and remove memory-blocks through internal memory-pools */
-    RETURN_RESTRICT void* Allocate(const coreUint16 iSize, const coreUint8 iAlign);
-    void Free(const coreUint16 iSize, const coreUint8 iAlign, void** OUTPUT ppPointer);
+    /* create and remove memory-blocks through size-classes (larger memory-blocks use the heap) */
+    RETURN_RESTRICT void* Allocate(const coreUintW iSize, const coreUintW iAlign);
+    void Free(const coreUintW iSize, const coreUintW iAlign, void** OUTPUT ppPointer);
+
+
+private:
+    /* handle thread-caches */
+    coreThreadCache* __GetThreadCache();
+    void __RefillCache(coreThreadCache* OUTPUT pCache, const coreUintW iClass);
+    void __FlushCache (coreThreadCache* OUTPUT pCache, const coreUintW iClass, const coreUint32 iCount);
+    static void SDLCALL __ReleaseThreadCache(void* pData);
+
+    /* convert between size-classes and block sizes */
+    static coreUintW __GetClass    (const coreUintW iSize, const coreUintW iAlign);
+    static coreUintW __GetBlockSize(const coreUintW iClass);
 };
 
 
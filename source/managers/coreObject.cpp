@@ -12,14 +12,15 @@
 // ****************************************************************
 /* constructor */
 coreObject::coreObject()noexcept
-: m_apTexture  {}
-, m_pProgram   (NULL)
-, m_vColor     (coreVector4(1.0f,1.0f,1.0f,1.0f))
-, m_vTexSize   (coreVector2(1.0f,1.0f))
-, m_vTexOffset (coreVector2(0.0f,0.0f))
-, m_eUpdate    (CORE_OBJECT_UPDATE_ALL)
-, m_eEnabled   (CORE_OBJECT_ENABLE_ALL)
-, m_iStatus    (0)
+: m_apTexture    {}
+, m_pProgram     (NULL)
+, m_vColor       (coreVector4(1.0f,1.0f,1.0f,1.0f))
+, m_pvColorStore (NULL)
+, m_vTexSize     (coreVector2(1.0f,1.0f))
+, m_vTexOffset   (coreVector2(0.0f,0.0f))
+, m_eUpdate      (CORE_OBJECT_UPDATE_ALL)
+, m_eEnabled     (CORE_OBJECT_ENABLE_ALL)
+, m_iStatus      (0)
 {
 }
 
@@ -28,9 +29,13 @@ coreObject::coreObject()noexcept
 /* constructor */
 coreObjectManager::coreObjectManager()noexcept
 : m_aapObjectList     {}
-, m_aiObjectCollision {}
-, m_aiIndex           {}
-, m_bIndexDirty       (false)
+, m_aObjectCollision  {}
+, m_iCollisionUsed    (0u)
+, m_iCollisionExpire  (0u)
+, m_aiDirtyType       {}
+, m_aaBroadphase      {}
+, m_aiCandidate       {}
+, m_iSweepAxis        (0u)
 , m_pLowQuad          (NULL)
 , m_pLowTriangle      (NULL)
 , m_apSpriteList      {}
@@ -123,9 +128,9 @@ coreBool coreObjectManager::TestCollision(const coreObject3D* pObject1, const co
     if(ABS(D2.y) > (vRange1.y + R2.y)) return false;
     if(ABS(D2.z) > (vRange1.z + R2.z)) return false;
 
-    // check if clusters are available for precise collision detection
-    const coreBool bPrecise1 = pObject1->GetVolume().IsUsable() && pObject1->GetVolume()->GetNumClusters();
-    const coreBool bPrecise2 = pObject2->GetVolume().IsUsable() && pObject2->GetVolume()->GetNumClusters();
+    // check if hierarchy is available for precise collision detection
+    const coreBool bPrecise1 = pObject1->GetVolume().IsUsable() && pObject1->GetVolume()->HasBvh();
+    const coreBool bPrecise2 = pObject2->GetVolume().IsUsable() && pObject2->GetVolume()->HasBvh();
 
     // return intersection between two simple volumes
     if(!bPrecise1 && !bPrecise2)
@@ -134,7 +139,7 @@ coreBool coreObjectManager::TestCollision(const coreObject3D* pObject1, const co
         return true;
     }
 
-    // move less complex object to the first position (to improve re-use of transformed data when iterating through clusters of both volumes)
+    // move less complex object to the first position (to transform fewer triangles when querying both volumes)
     const coreBool bSwap = (!bPrecise2 || (bPrecise1 && pObject1->GetVolume()->GetNumIndices() > pObject2->GetVolume()->GetNumIndices()));
     if(bSwap) std::swap(pObject1, pObject2);
 
@@ -143,144 +148,214 @@ coreBool coreObjectManager::TestCollision(const coreObject3D* pObject1, const co
     const coreVector4 vRelRotation = bSwap ? Q.QuatConjugate() : Q;
 
     // get volumes and object sizes
-    const coreModel*  pVolume1  = pObject1->GetVolume().IsUsable() ? pObject1->GetVolume().GetResource() : NULL;
-    const coreModel*  pVolume2  = pObject2->GetVolume().GetResource();
-    const coreVector3 vSize1    = pObject1->GetSize() * pObject1->GetCollisionModifier();
-    const coreVector3 vSize2    = pObject2->GetSize() * pObject2->GetCollisionModifier();
-    const coreFloat   vSizeMax1 = vSize1.Max();
-    const coreFloat   vSizeMax2 = vSize2.Max();
-
-    // calculate collision between precise and simple volume
+    const coreModel*  pVolume1 = pObject1->GetVolume().IsUsable() ? pObject1->GetVolume().GetResource() : NULL;
+    const coreModel*  pVolume2 = pObject2->GetVolume().GetResource();
+    const coreVector3 vSize1   = pObject1->GetSize() * pObject1->GetCollisionModifier();
+    const coreVector3 vSize2   = pObject2->GetSize() * pObject2->GetCollisionModifier();
+
+    // calculate collision between precise and simple volume (with first touching cluster, not exact)
     if(!bPrecise1 || !bPrecise2)
     {
         const coreVector3 vPosition1 = vRelPosition;
         const coreFloat   fRadius1   = pObject1->GetCollisionRadius();
 
-        for(coreUintW m = 0u, me = LOOP_NONZERO(pVolume2->GetNumClusters()); m < me; ++m)
-        {
-            const coreVector3 vPosition2 = vSize2 * pVolume2->GetClusterPosition(m);
-            const coreFloat   fRadius2   = pVolume2->GetClusterRadius(m) * vSizeMax2;
-
-            const coreVector3 vClusterDiff   = vPosition1 - vPosition2;
-            const coreFloat   fClusterRadius = fRadius1 + fRadius2;
+        const coreUintW m = pVolume2->FindCluster(vPosition1, fRadius1, vSize2);
+        if(m >= pVolume2->GetNumClusters()) return false;
 
-            if(vClusterDiff.LengthSq() > POW2(fClusterRadius))
-                continue;
+        const coreVector3 vPosition2 = vSize2 * pVolume2->GetClusterPosition(m);
+        const coreFloat   fRadius2   = pVolume2->GetClusterRadius(m) * vSize2.Max();
 
-            (*pvIntersection) = pObject2->GetPosition() + pObject2->GetRotation().QuatApply(vPosition2 + vClusterDiff * (fRadius2 / fClusterRadius));
-            return true;
-        }
+        const coreVector3 vClusterDiff   = vPosition1 - vPosition2;
+        const coreFloat   fClusterRadius = fRadius1 + fRadius2;
 
-        return false;
+        (*pvIntersection) = pObject2->GetPosition() + pObject2->GetRotation().QuatApply(vPosition2 + vClusterDiff * (fRadius2 / fClusterRadius));
+        return true;
     }
 
-    // calculate collision between two precise volumes (Moeller97b)
-    for(coreUintW k = 0u, ke = LOOP_NONZERO(pVolume1->GetNumClusters()); k < ke; ++k)
+    const coreVector3* pvVertexPosition1 = pVolume1->GetVertexPosition();
+    const coreVector3* pvVertexPosition2 = pVolume2->GetVertexPosition();
+    const coreVector4  vRevRotation      = vRelRotation.QuatConjugate();
+
+    // calculate collision between two precise volumes (only with triangles inside the bounding box of the other object)
+    return pVolume1->QueryBox(vRevRotation.QuatApply(-vRelPosition), pObject2->GetCollisionRange(), vRevRotation, vSize1, [&](const coreUint16* piIndex1)
     {
-        const coreVector3 vPosition1 = vRelPosition + vRelRotation.QuatApply(vSize1 * pVolume1->GetClusterPosition(k));
-        const coreFloat   fRadius1   = pVolume1->GetClusterRadius(k) * vSizeMax1;
+        const coreVector3 A1 = vRelPosition + vRelRotation.QuatApply(vSize1 * pvVertexPosition1[piIndex1[0]]);
+        const coreVector3 A2 = vRelPosition + vRelRotation.QuatApply(vSize1 * pvVertexPosition1[piIndex1[1]]);
+        const coreVector3 A3 = vRelPosition + vRelRotation.QuatApply(vSize1 * pvVertexPosition1[piIndex1[2]]);
 
-       if(vPosition1.LengthSq() > POW2(fRadius1 + pObject2->GetCollisionRadius()))   // if cluster 1 is not intersecting sphere 2
-            continue;
+        // get bounds of triangle 1
+        const coreVector3 vMin = coreVector3(MIN(A1.x, A2.x, A3.x), MIN(A1.y, A2.y, A3.y), MIN(A1.z, A2.z, A3.z));
+        const coreVector3 vMax = coreVector3(MAX(A1.x, A2.x, A3.x), MAX(A1.y, A2.y, A3.y), MAX(A1.z, A2.z, A3.z));
 
-        for(coreUintW m = 0u, me = LOOP_NONZERO(pVolume2->GetNumClusters()); m < me; ++m)
+        return pVolume2->QueryBox((vMin + vMax) * 0.5f, (vMax - vMin) * 0.5f, coreVector4::QuatIdentity(), vSize2, [&](const coreUint16* piIndex2)
         {
-            const coreVector3 vPosition2 = vSize2 * pVolume2->GetClusterPosition(m);
-            const coreFloat   fRadius2   = pVolume2->GetClusterRadius(m) * vSizeMax2;
+            coreVector3 vCenter;
+            if(!coreObjectManager::__TestTriangleTriangle(A1, A2, A3, vSize2 * pvVertexPosition2[piIndex2[0]],
+                                                                      vSize2 * pvVertexPosition2[piIndex2[1]],
+                                                                      vSize2 * pvVertexPosition2[piIndex2[2]], &vCenter))
+                return false;
 
-            const coreVector3 vClusterDiff   = vPosition1 - vPosition2;
-            const coreFloat   fClusterRadius = fRadius1 + fRadius2;
+            (*pvIntersection) = pObject2->GetPosition() + pObject2->GetRotation().QuatApply(vCenter);
+            return true;
+        });
+    });
+}
 
-            if(vClusterDiff.LengthSq() > POW2(fClusterRadius))   // if cluster 1 is not intersecting cluster 2
-                continue;
 
-            const coreFloat fRadius2Sq = POW2(fRadius2);
+// ****************************************************************
+/* test collision between many pairs of 3d-objects (only bounding sphere and box, keeps potential pairs at the front) */
+coreUintW coreObjectManager::TestCollisionBatch(const coreObject3D* const* ppObject1, const coreObject3D* const* ppObject2, coreUint64* OUTPUT piPair, const coreUintW iNumPairs)
+{
+    ASSERT(ppObject1 && ppObject2 && (piPair || !iNumPairs))
 
-            const coreVector3* pvVertexPosition1 = pVolume1->GetVertexPosition();
-            const coreVector3* pvVertexPosition2 = pVolume2->GetVertexPosition();
-            const coreUint16*  piClusterIndex1   = pVolume1->GetClusterIndex(k);
-            const coreUint16*  piClusterIndex2   = pVolume2->GetClusterIndex(m);
+    // gathered object data (one pair per lane)
+    alignas(ALIGNMENT_SIMD) coreFloat afDiff  [3][4];
+    alignas(ALIGNMENT_SIMD) coreFloat afRadius   [4];
+    alignas(ALIGNMENT_SIMD) coreFloat afRange1[3][4];
+    alignas(ALIGNMENT_SIMD) coreFloat afRange2[3][4];
+    alignas(ALIGNMENT_SIMD) coreFloat afRot1  [4][4];
+    alignas(ALIGNMENT_SIMD) coreFloat afRot2  [4][4];
 
-            for(coreUintW i = 0u, ie = LOOP_NONZERO(pVolume1->GetClusterNumIndices(k)); i < ie; i += 3u)
-            {
-                const coreVector3 A1 = vRelPosition + vRelRotation.QuatApply(vSize1 * pvVertexPosition1[piClusterIndex1[i]]);
-                const coreVector3 A2 = vRelPosition + vRelRotation.QuatApply(vSize1 * pvVertexPosition1[piClusterIndex1[i+1u]]);
-                const coreVector3 A3 = vRelPosition + vRelRotation.QuatApply(vSize1 * pvVertexPosition1[piClusterIndex1[i+2u]]);
+    const auto nGatherFunc = [&](const coreUintW j, const coreObject3D* pObject1, const coreObject3D* pObject2)
+    {
+        const coreVector3 vDiff   = pObject1->GetPosition() - pObject2->GetPosition();
+        const coreVector3 vRange1 = pObject1->GetCollisionRange();
+        const coreVector3 vRange2 = pObject2->GetCollisionRange();
+        const coreVector4 vRot1   = pObject1->GetRotation();
+        const coreVector4 vRot2   = pObject2->GetRotation();
 
-                const coreVector3 vCross1 = coreVector3::Cross(A2 - A1, A3 - A1);
+        for(coreUintW k = 0u; k < 3u; ++k)
+        {
+            afDiff  [k][j] = vDiff  .arr(k);
+            afRange1[k][j] = vRange1.arr(k);
+            afRange2[k][j] = vRange2.arr(k);
+        }
+        for(coreUintW k = 0u; k < 4u; ++k)
+        {
+            afRot1[k][j] = vRot1.arr(k);
+            afRot2[k][j] = vRot2.arr(k);
+        }
+        afRadius[j] = pObject1->GetCollisionRadius() + pObject2->GetCollisionRadius();
+    };
 
-                if(POW2(coreVector3::Dot(A1 - vPosition2, vCross1)) > fRadius2Sq * vCross1.LengthSq())   // if triangle 1 is not intersecting cluster 2
-                    continue;
+    // apply quaternion-transformation to vectors (v + 2 * (q x (q x v + w * v)))
+    const auto nQuatApplyFunc = [](const coreLane* pvQuat, const coreLane* pvInput, coreLane* OUTPUT pvOutput)
+    {
+        const coreLane& X = pvQuat[0]; const coreLane& Y = pvQuat[1]; const coreLane& Z = pvQuat[2]; const coreLane& W = pvQuat[3];
 
-                for(coreUintW j = 0u, je = LOOP_NONZERO(pVolume2->GetClusterNumIndices(m)); j < je; j += 3u)
-                {
-                    coreVector3 B1 = vSize2 * pvVertexPosition2[piClusterIndex2[j]];
-                    coreVector3 B2 = vSize2 * pvVertexPosition2[piClusterIndex2[j+1u]];
-                    coreVector3 B3 = vSize2 * pvVertexPosition2[piClusterIndex2[j+2u]];
-
-                    coreUint32 F1 = (coreVector3::Dot(B1 - A1, vCross1) >= 0.0f) ? 1u : 0u;
-                    coreUint32 F2 = (coreVector3::Dot(B2 - A1, vCross1) >= 0.0f) ? 1u : 0u;
-                    coreUint32 F3 = (coreVector3::Dot(B3 - A1, vCross1) >= 0.0f) ? 1u : 0u;
-
-                    if((F1 == F2) && (F1 == F3))
-                        continue;
-
-                    const coreVector3 vCross2 = coreVector3::Cross(B2 - B1, B3 - B1);
-
-                    coreUint32 G1 = (coreVector3::Dot(A1 - B1, vCross2) >= 0.0f) ? 1u : 0u;
-                    coreUint32 G2 = (coreVector3::Dot(A2 - B1, vCross2) >= 0.0f) ? 1u : 0u;
-                    coreUint32 G3 = (coreVector3::Dot(A3 - B1, vCross2) >= 0.0f) ? 1u : 0u;
-
-                    if((G1 == G2) && (G1 == G3))
-                        continue;
-
-                    coreVector3 C1 = A1;
-                    coreVector3 C2 = A2;
-                    coreVector3 C3 = A3;
-
-                    if(F2 != F3)
-                    {
-                        if(F1 != F2)
-                        {
-                            std::swap(B1, B2);
-                            std::swap(F1, F2);
-                        }
-                        else
-                        {
-                            std::swap(B1, B3);
-                            std::swap(F1, F3);
-                        }
-                    }
-
-                    if(G2 != G3)
-                    {
-                        if(G1 != G2)
-                        {
-                            std::swap(C1, C2);
-                            std::swap(G1, G2);
-                        }
-                        else
-                        {
-                            std::swap(C1, C3);
-                            std::swap(G1, G3);
-                        }
-                    }
-
-                    if(F1 > 0u) std::swap(C2, C3);
-                    if(G1 > 0u) std::swap(B2, B3);
-
-                    if((coreVector3::Dot(C2 - B1, coreVector3::Cross(B2 - B1, C1 - B1)) <= 0.0f) &&
-                       (coreVector3::Dot(C1 - B1, coreVector3::Cross(B3 - B1, C3 - B1)) <= 0.0f))
-                    {
-                        (*pvIntersection) = pObject2->GetPosition() + pObject2->GetRotation().QuatApply((C1 + C2 + C3 + B1 + B2 + B3) * (1.0f/6.0f));
-                        return true;
-                    }
-                }
+        const coreLane TX = coreLaneAdd(coreLaneSub(coreLaneMul(Y, pvInput[2]), coreLaneMul(Z, pvInput[1])), coreLaneMul(W, pvInput[0]));
+        const coreLane TY = coreLaneAdd(coreLaneSub(coreLaneMul(Z, pvInput[0]), coreLaneMul(X, pvInput[2])), coreLaneMul(W, pvInput[1]));
+        const coreLane TZ = coreLaneAdd(coreLaneSub(coreLaneMul(X, pvInput[1]), coreLaneMul(Y, pvInput[0])), coreLaneMul(W, pvInput[2]));
+
+        const coreLane vTwo = coreLaneSet(2.0f);
+        pvOutput[0] = coreLaneAdd(pvInput[0], coreLaneMul(vTwo, coreLaneSub(coreLaneMul(Y, TZ), coreLaneMul(Z, TY))));
+        pvOutput[1] = coreLaneAdd(pvInput[1], coreLaneMul(vTwo, coreLaneSub(coreLaneMul(Z, TX), coreLaneMul(X, TZ))));
+        pvOutput[2] = coreLaneAdd(pvInput[2], coreLaneMul(vTwo, coreLaneSub(coreLaneMul(X, TY), coreLaneMul(Y, TX))));
+    };
+
+    const coreLane vZero  = coreLaneSet(0.0f);
+    const coreLane vOne   = coreLaneSet(1.0f);
+    const coreLane vTwo   = coreLaneSet(2.0f);
+    const coreLane vSlack = coreLaneSet(1.0f + 1.0e-4f);   // # stay conservative against rounding differences to the single test
+
+    coreUintW iOutput = 0u;
+    for(coreUintW i = 0u; i < iNumPairs; i += 4u)
+    {
+        const coreUintW iLanes = MIN(iNumPairs - i, coreUintW(4u));
+
+        // gather object data (unused and invalid lanes get neutral values)
+        coreUint64 aiPair[4];
+        coreUint32 iValid = 0u;
+        for(coreUintW j = 0u; j < 4u; ++j)
+        {
+            const coreObject3D* pObject1 = NULL;
+            const coreObject3D* pObject2 = NULL;
+
+            if(j < iLanes)
+            {
+                aiPair[j] = piPair[i + j];
+                pObject1  = ppObject1[coreUintW(aiPair[j] >> 32u)];
+                pObject2  = ppObject2[coreUintW(aiPair[j] & 0xFFFFFFFFu)];
+            }
+
+            if(pObject1 && pObject2)
+            {
+                nGatherFunc(j, pObject1, pObject2);
+                ADD_BIT(iValid, j)
+            }
+            else
+            {
+                for(coreUintW k = 0u; k < 3u; ++k) afDiff[k][j] = afRange1[k][j] = afRange2[k][j] = 0.0f;
+                for(coreUintW k = 0u; k < 4u; ++k) afRot1[k][j] = afRot2  [k][j] = (k == 3u) ? 1.0f : 0.0f;
+                afRadius[j] = 0.0f;
             }
         }
+        if(!iValid) continue;
+
+        const coreLane avDiff  [3] = {coreLaneLoad(afDiff  [0]), coreLaneLoad(afDiff  [1]), coreLaneLoad(afDiff  [2])};
+        const coreLane avRange1[3] = {coreLaneLoad(afRange1[0]), coreLaneLoad(afRange1[1]), coreLaneLoad(afRange1[2])};
+        const coreLane avRange2[3] = {coreLaneLoad(afRange2[0]), coreLaneLoad(afRange2[1]), coreLaneLoad(afRange2[2])};
+        const coreLane avRot1  [4] = {coreLaneLoad(afRot1  [0]), coreLaneLoad(afRot1  [1]), coreLaneLoad(afRot1  [2]), coreLaneLoad(afRot1[3])};
+        const coreLane avRot2  [4] = {coreLaneLoad(afRot2  [0]), coreLaneLoad(afRot2  [1]), coreLaneLoad(afRot2  [2]), coreLaneLoad(afRot2[3])};
+
+        // check for sphere intersection
+        const coreLane vTotalRadius = coreLaneMul(coreLaneLoad(afRadius), vSlack);
+        const coreLane vLengthSq    = coreLaneAdd(coreLaneAdd(coreLaneMul(avDiff[0], avDiff[0]), coreLaneMul(avDiff[1], avDiff[1])), coreLaneMul(avDiff[2], avDiff[2]));
+
+        coreUint32 iMask = coreLaneLessEqual(vLengthSq, coreLaneMul(vTotalRadius, vTotalRadius)) & iValid;
+        if(!iMask) continue;
+
+        // revert both rotations
+        const coreLane avRevRot1[4] = {coreLaneSub(vZero, avRot1[0]), coreLaneSub(vZero, avRot1[1]), coreLaneSub(vZero, avRot1[2]), avRot1[3]};
+        const coreLane avRevRot2[4] = {coreLaneSub(vZero, avRot2[0]), coreLaneSub(vZero, avRot2[1]), coreLaneSub(vZero, avRot2[2]), avRot2[3]};
+
+        // calculate relative rotation (second reverted, then first)
+        const coreLane* A = avRevRot2;
+        const coreLane* B = avRot1;
+        const coreLane QX = coreLaneSub(coreLaneAdd(coreLaneAdd(coreLaneMul(A[0], B[3]), coreLaneMul(A[3], B[0])), coreLaneMul(A[1], B[2])), coreLaneMul(A[2], B[1]));
+        const coreLane QY = coreLaneSub(coreLaneAdd(coreLaneAdd(coreLaneMul(A[1], B[3]), coreLaneMul(A[3], B[1])), coreLaneMul(A[2], B[0])), coreLaneMul(A[0], B[2]));
+        const coreLane QZ = coreLaneSub(coreLaneAdd(coreLaneAdd(coreLaneMul(A[2], B[3]), coreLaneMul(A[3], B[2])), coreLaneMul(A[0], B[1])), coreLaneMul(A[1], B[0]));
+        const coreLane QW = coreLaneSub(coreLaneSub(coreLaneSub(coreLaneMul(A[3], B[3]), coreLaneMul(A[0], B[0])), coreLaneMul(A[1], B[1])), coreLaneMul(A[2], B[2]));
+
+        // calculate relative transformation matrix (with absolute values to check only for maximums)
+        const coreLane XX = coreLaneMul(QX, QX), XY = coreLaneMul(QX, QY), XZ = coreLaneMul(QX, QZ), XW = coreLaneMul(QX, QW);
+        const coreLane YY = coreLaneMul(QY, QY), YZ = coreLaneMul(QY, QZ), YW = coreLaneMul(QY, QW);
+        const coreLane ZZ = coreLaneMul(QZ, QZ), ZW = coreLaneMul(QZ, QW);
+
+        const coreLane S[3][3] =
+        {
+            {coreLaneAbs(coreLaneSub(vOne, coreLaneMul(vTwo, coreLaneAdd(YY, ZZ)))), coreLaneAbs(coreLaneMul(vTwo, coreLaneAdd(XY, ZW))),              coreLaneAbs(coreLaneMul(vTwo, coreLaneSub(XZ, YW)))},
+            {coreLaneAbs(coreLaneMul(vTwo, coreLaneSub(XY, ZW))),              coreLaneAbs(coreLaneSub(vOne, coreLaneMul(vTwo, coreLaneAdd(XX, ZZ)))), coreLaneAbs(coreLaneMul(vTwo, coreLaneAdd(YZ, XW)))},
+            {coreLaneAbs(coreLaneMul(vTwo, coreLaneAdd(XZ, YW))),              coreLaneAbs(coreLaneMul(vTwo, coreLaneSub(YZ, XW))),              coreLaneAbs(coreLaneSub(vOne, coreLaneMul(vTwo, coreLaneAdd(XX, YY))))}
+        };
+
+        // rotate and move objects relative to each other
+        const coreLane avNegDiff[3] = {coreLaneSub(vZero, avDiff[0]), coreLaneSub(vZero, avDiff[1]), coreLaneSub(vZero, avDiff[2])};
+        coreLane D1[3], D2[3];
+        nQuatApplyFunc(avRevRot2, avDiff,    D1);
+        nQuatApplyFunc(avRevRot1, avNegDiff, D2);
+
+        // check for both boundary intersections
+        for(coreUintW k = 0u; k < 3u; ++k)
+        {
+            const coreLane R1 = coreLaneAdd(coreLaneAdd(coreLaneMul(avRange1[0], S[0][k]), coreLaneMul(avRange1[1], S[1][k])), coreLaneMul(avRange1[2], S[2][k]));
+            const coreLane R2 = coreLaneAdd(coreLaneAdd(coreLaneMul(avRange2[0], S[k][0]), coreLaneMul(avRange2[1], S[k][1])), coreLaneMul(avRange2[2], S[k][2]));
+
+            iMask &= coreLaneLessEqual(coreLaneAbs(D1[k]), coreLaneMul(coreLaneAdd(R1, avRange2[k]), vSlack));
+            iMask &= coreLaneLessEqual(coreLaneAbs(D2[k]), coreLaneMul(coreLaneAdd(avRange1[k], R2), vSlack));
+        }
+
+        // keep all potential pairs (in original order, written in-place behind the current read position)
+        for(coreUintW j = 0u; j < iLanes; ++j)
+        {
+            if(!HAS_BIT(iMask, j)) continue;
+
+            ASSERT((iOutput <= i + j) && (i + j < iNumPairs))
+            piPair[iOutput++] = aiPair[j];
+        }
     }
 
-    return false;
+    return iOutput;
 }
 
 
@@ -310,8 +385,8 @@ coreBool coreObjectManager::TestCollision(const coreObject3D* pObject, const cor
     if(fOppositeSq > fRadiusSq)
         return false;
 
-    // check if clusters are available for precise collision detection
-    const coreBool bPrecise = pObject->GetVolume().IsUsable() && pObject->GetVolume()->GetNumClusters();
+    // check if hierarchy is available for precise collision detection
+    const coreBool bPrecise = pObject->GetVolume().IsUsable() && pObject->GetVolume()->HasBvh();
 
     // return intersection with simple volume
     if(!bPrecise)
@@ -342,11 +417,10 @@ coreBool coreObjectManager::TestCollision(const coreObject3D* pObject, const cor
     const coreVector3 vRelRayDir   = vRevRotation.QuatApply(vRayDir);
 
     // get volume and object size
-    const coreModel*  pVolume  = pObject->GetVolume().GetResource();
-    const coreVector3 vSize    = pObject->GetSize() * pObject->GetCollisionModifier();
-    const coreFloat   vSizeMax = vSize.Max();
+    const coreModel*  pVolume = pObject->GetVolume().GetResource();
+    const coreVector3 vSize   = pObject->GetSize() * pObject->GetCollisionModifier();
 
-    // calculate collision with precise volume (MoellerTrumbore97)
+    // calculate collision with precise volume (MoellerTrumbore97, only with triangles along the ray)
     if(bPrecise)
     {
         const auto nFilterFunc = [](coreFloat* OUTPUT pfArray, const coreUint8 iCount)
@@ -359,64 +433,47 @@ coreBool coreObjectManager::TestCollision(const coreObject3D* pObject, const cor
         coreFloat afHitDistance[CORE_OBJECT_RAY_HITCOUNT + 1u] = {};
         coreUint8 iHitCount                                    = 0u;
 
-        for(coreUintW m = 0u, me = LOOP_NONZERO(pVolume->GetNumClusters()); m < me; ++m)
-        {
-            const coreVector3 vClusterPos  = vSize * pVolume->GetClusterPosition(m);
-            const coreVector3 vClusterDiff = vClusterPos - vRelRayPos;
-
-            const coreFloat fAdjacent2 = coreVector3::Dot(vClusterDiff, vRelRayDir);
-            const coreFloat fDiffSq2   = vClusterDiff.LengthSq();
-            const coreFloat fRadiusSq2 = POW2(pVolume->GetClusterRadius(m) * vSizeMax);
-
-            if((fAdjacent2 < 0.0f) && (fDiffSq2 > fRadiusSq2))
-                continue;
-
-            const coreFloat fOppositeSq2 = fDiffSq2 - POW2(fAdjacent2);
+        const coreVector3* pvVertexPosition = pVolume->GetVertexPosition();
 
-            if(fOppositeSq2 > fRadiusSq2)
-                continue;
-
-            const coreVector3* pvVertexPosition = pVolume->GetVertexPosition();
-            const coreUint16*  piClusterIndex   = pVolume->GetClusterIndex(m);
-
-            for(coreUintW j = 0u, je = LOOP_NONZERO(pVolume->GetClusterNumIndices(m)); j < je; j += 3u)
-            {
-                const coreVector3 V1 = vSize * pvVertexPosition[piClusterIndex[j]];
-                const coreVector3 V2 = vSize * pvVertexPosition[piClusterIndex[j+1u]];
-                const coreVector3 V3 = vSize * pvVertexPosition[piClusterIndex[j+2u]];
+        pVolume->QueryRay(vRelRayPos, vRelRayDir, vSize, [&](const coreUint16* piIndex)
+        {
+            const coreVector3 V1 = vSize * pvVertexPosition[piIndex[0]];
+            const coreVector3 V2 = vSize * pvVertexPosition[piIndex[1]];
+            const coreVector3 V3 = vSize * pvVertexPosition[piIndex[2]];
 
-                const coreVector3 W1 = V2 - V1;
-                const coreVector3 W2 = V3 - V1;
+            const coreVector3 W1 = V2 - V1;
+            const coreVector3 W2 = V3 - V1;
 
-                const coreVector3 A = coreVector3::Cross(vRelRayDir, W2);
-                const coreFloat   B = coreVector3::Dot(W1, A);
+            const coreVector3 A = coreVector3::Cross(vRelRayDir, W2);
+            const coreFloat   B = coreVector3::Dot(W1, A);
 
-                if(coreMath::IsNear(B, 0.0f))
-                    continue;
+            if(coreMath::IsNear(B, 0.0f))
+                return false;
 
-                const coreFloat   C = 1.0f / B;
-                const coreVector3 D = vRelRayPos - V1;
-                const coreFloat   E = coreVector3::Dot(D, A) * C;
+            const coreFloat   C = 1.0f / B;
+            const coreVector3 D = vRelRayPos - V1;
+            const coreFloat   E = coreVector3::Dot(D, A) * C;
 
-                if((E < 0.0f) || (E > 1.0f))
-                    continue;
+            if((E < 0.0f) || (E > 1.0f))
+                return false;
 
-                const coreVector3 F = coreVector3::Cross(D, W1);
-                const coreFloat   G = coreVector3::Dot(vRelRayDir, F) * C;
-                const coreFloat   H = coreVector3::Dot(W2, F) * C;
+            const coreVector3 F = coreVector3::Cross(D, W1);
+            const coreFloat   G = coreVector3::Dot(vRelRayDir, F) * C;
+            const coreFloat   H = coreVector3::Dot(W2, F) * C;
 
-                if((G < 0.0f) || (G + E > 1.0f) || (H < 0.0f))
-                    continue;
+            if((G < 0.0f) || (G + E > 1.0f) || (H < 0.0f))
+                return false;
 
-                afHitDistance[iHitCount++] = H;
+            afHitDistance[iHitCount++] = H;
 
-                if(iHitCount == CORE_OBJECT_RAY_HITCOUNT + 1u)
-                {
-                    // remove duplicates early or drop biggest distance value
-                    iHitCount = MIN(nFilterFunc(afHitDistance, CORE_OBJECT_RAY_HITCOUNT + 1u), CORE_OBJECT_RAY_HITCOUNT);
-                }
+            if(iHitCount == CORE_OBJECT_RAY_HITCOUNT + 1u)
+            {
+                // remove duplicates early or drop biggest distance value
+                iHitCount = MIN(nFilterFunc(afHitDistance, CORE_OBJECT_RAY_HITCOUNT + 1u), CORE_OBJECT_RAY_HITCOUNT);
             }
-        }
+
+            return false;
+        });
 
         if(iHitCount)
         {
@@ -435,6 +492,27 @@ coreBool coreObjectManager::TestCollision(const coreObject3D* pObject, const cor
 }
 
 
+// ****************************************************************
+/* control broadphase for a type */
+void coreObjectManager::SetBroadphase(const coreInt32 iType, const coreBool bEnable)
+{
+    ASSERT(iType)
+
+    // # candidates are gathered once at the start of each test, callbacks moving objects into new overlaps are only detected with the next test
+
+    if(bEnable)
+    {
+        // start tracking all list entries (bounds are created on the next refresh)
+        if(!m_aaBroadphase.count_bs(iType)) m_aaBroadphase.emplace_bs(iType);
+    }
+    else
+    {
+        // stop tracking
+        if(m_aaBroadphase.count_bs(iType)) m_aaBroadphase.erase_bs(iType);
+    }
+}
+
+
 // ****************************************************************
 /* refresh all existing 2d-objects */
 void coreObjectManager::RefreshSprites()
@@ -494,42 +572,86 @@ void coreObjectManager::__Reset(const coreResourceReset eInit)
 /* update all objects and collisions */
 void coreObjectManager::__UpdateObjects()
 {
-    if(m_bIndexDirty)
+    // compact only lists with removed objects
+    FOR_EACH(it, m_aiDirtyType)
     {
-        m_bIndexDirty = false;
+        const coreInt32 iType = (*it);
+        coreObjectList& oList = m_aapObjectList.at(iType);
 
-        // clear index
-        m_aiIndex.clear();
-
-        // loop through all objects
-        FOR_EACH(it, m_aapObjectList)
+        if(m_aaBroadphase.count_bs(iType))
         {
-            FOR_EACH_DYN(et, *it)
+            coreList<coreObjectBound>& aBound = m_aaBroadphase.at_bs(iType);
+
+            // calculate compacted indices (in frame memory)
+            coreArenaList<coreUint32> aiNewIndex {coreArenaAllocator<coreUint32>(coreFrameArena())};
+            aiNewIndex.reserve(oList.size());
+
+            coreUint32 iNext = 0u;
+            FOR_EACH(et, oList) aiNewIndex.push_back((*et) ? (iNext++) : UINT32_MAX);
+
+            // remove bounds of invalid pointers and move the others to their new index (without changing the order)
+            coreUintW iWrite = 0u;
+            FOR_EACH(et, aBound)
             {
-                // check for invalid pointers and remove them
-                if(*et) DYN_KEEP  (et, *it)
-                   else DYN_REMOVE(et, *it)
+                const coreUint32 iNew = aiNewIndex[et->iIndex];
+                if(iNew != UINT32_MAX)
+                {
+                    aBound[iWrite]        = (*et);
+                    aBound[iWrite].iIndex = iNew;
+                    iWrite += 1u;
+                }
             }
-
-            // reconstruct index
-            for(coreUintW i = 0u, ie = it->size(); i < ie; ++i)
-                m_aiIndex.emplace((*it)[i], i);
+            aBound.resize(iWrite);
         }
 
-        // sort index explicitly (faster than sorting on reconstruction)
-        m_aiIndex.prepare_bs();
+        // remove invalid pointers and update the index of all moved objects (without changing the order)
+        coreUintW iWrite = 0u;
+        FOR_EACH(et, oList)
+        {
+            if(!(*et)) continue;
+
+            (*et)->m_iIndex = iWrite;
+            oList[iWrite++] = (*et);
+        }
+        oList.resize(iWrite);
     }
+    m_aiDirtyType.clear();
 
-    if(m_bUpdateCollision)
+    if(!m_aaBroadphase.empty())
     {
-        // loop through all collisions
-        const coreUint32 iCurFrame = Core::System->GetCurFrame();
-        FOR_EACH_DYN(it, m_aiObjectCollision)
+        coreVector3 vMin = coreVector3( 1.0f, 1.0f, 1.0f) * FLT_MAX;
+        coreVector3 vMax = coreVector3(-1.0f,-1.0f,-1.0f) * FLT_MAX;
+
+        // determine object spread of all tracked types
+        FOR_EACH(it, m_aaBroadphase)
         {
-            // check for old entries and remove them
-            if((*it) == iCurFrame) DYN_KEEP  (it, m_aiObjectCollision)
-                              else DYN_REMOVE(it, m_aiObjectCollision)
+            FOR_EACH(et, m_aapObjectList[*m_aaBroadphase.get_key(it)])
+            {
+                if(!(*et)) continue;
+
+                const coreVector3& vPosition = (*et)->GetPosition();
+                vMin = coreVector3(MIN(vMin.x, vPosition.x), MIN(vMin.y, vPosition.y), MIN(vMin.z, vPosition.z));
+                vMax = coreVector3(MAX(vMax.x, vPosition.x), MAX(vMax.y, vPosition.y), MAX(vMax.z, vPosition.z));
+            }
         }
+
+        // switch sweep axis only on clear difference (full sort required)
+        const coreVector3 vSpread = vMax - vMin;
+        const coreUint8   iAxis   = (vSpread.x >= vSpread.y) ? ((vSpread.x >= vSpread.z) ? 0u : 2u) : ((vSpread.y >= vSpread.z) ? 1u : 2u);
+        const coreBool    bResort = (vSpread.arr(iAxis) > vSpread.arr(m_iSweepAxis) * 1.5f);
+        if(bResort) m_iSweepAxis = iAxis;
+
+        // refresh all broadphase bounds (only small corrections between frames)
+        FOR_EACH(it, m_aaBroadphase)
+        {
+            this->__RefreshBroadphase(*m_aaBroadphase.get_key(it), bResort);
+        }
+    }
+
+    if(m_bUpdateCollision)
+    {
+        // expire all collisions without contact in the current frame (removed lazily)
+        m_iCollisionExpire = Core::System->GetCurFrame();
     }
 }
 
@@ -538,7 +660,7 @@ void coreObjectManager::__UpdateObjects()
 /* bind 3d-object to type */
 void coreObjectManager::__BindObject(coreObject3D* pObject, const coreInt32 iType)
 {
-    ASSERT(pObject && iType && !m_aiIndex.count_bs(pObject))
+    ASSERT(pObject && iType)
 
 #if defined(_CORE_DEBUG_)
 
@@ -553,8 +675,8 @@ void coreObjectManager::__BindObject(coreObject3D* pObject, const coreInt32 iTyp
     // get requested list
     coreObjectList& oList = m_aapObjectList[iType];
 
-    // add object and index
-    m_aiIndex.emplace_bs(pObject, oList.size());
+    // add object and remember its position
+    pObject->m_iIndex = oList.size();
     oList.push_back(pObject);
 }
 
@@ -563,16 +685,86 @@ void coreObjectManager::__BindObject(coreObject3D* pObject, const coreInt32 iTyp
 /* unbind 3d-object from type */
 void coreObjectManager::__UnbindObject(coreObject3D* pObject, const coreInt32 iType)
 {
-    ASSERT(pObject && iType && m_aiIndex.count_bs(pObject))
+    ASSERT(pObject && iType)
 
-    const auto it = m_aiIndex.find_bs(pObject);
+    coreObjectList& oList = m_aapObjectList.at(iType);
+    ASSERT((pObject->m_iIndex < oList.size()) && (oList[pObject->m_iIndex] == pObject))
 
-    // remove object and index
-    m_aapObjectList.at(iType)[*it] = NULL;
-    m_aiIndex.erase(it);
+    // remove object (keep positions of all other objects)
+    oList[pObject->m_iIndex] = NULL;
 
-    // request index reconstruction
-    m_bIndexDirty = true;
+    // request list compaction
+    if(!m_aiDirtyType.count_bs(iType)) m_aiDirtyType.insert_bs(iType);
+}
+
+
+// ****************************************************************
+/* test intersection between two triangles (Moeller97b) */
+coreBool coreObjectManager::__TestTriangleTriangle(const coreVector3 A1, const coreVector3 A2, const coreVector3 A3, coreVector3 B1, coreVector3 B2, coreVector3 B3, coreVector3* OUTPUT pvIntersection)
+{
+    ASSERT(pvIntersection)
+
+    const coreVector3 vCross1 = coreVector3::Cross(A2 - A1, A3 - A1);
+
+    coreUint32 F1 = (coreVector3::Dot(B1 - A1, vCross1) >= 0.0f) ? 1u : 0u;
+    coreUint32 F2 = (coreVector3::Dot(B2 - A1, vCross1) >= 0.0f) ? 1u : 0u;
+    coreUint32 F3 = (coreVector3::Dot(B3 - A1, vCross1) >= 0.0f) ? 1u : 0u;
+
+    if((F1 == F2) && (F1 == F3))
+        return false;
+
+    const coreVector3 vCross2 = coreVector3::Cross(B2 - B1, B3 - B1);
+
+    coreUint32 G1 = (coreVector3::Dot(A1 - B1, vCross2) >= 0.0f) ? 1u : 0u;
+    coreUint32 G2 = (coreVector3::Dot(A2 - B1, vCross2) >= 0.0f) ? 1u : 0u;
+    coreUint32 G3 = (coreVector3::Dot(A3 - B1, vCross2) >= 0.0f) ? 1u : 0u;
+
+    if((G1 == G2) && (G1 == G3))
+        return false;
+
+    coreVector3 C1 = A1;
+    coreVector3 C2 = A2;
+    coreVector3 C3 = A3;
+
+    if(F2 != F3)
+    {
+        if(F1 != F2)
+        {
+            std::swap(B1, B2);
+            std::swap(F1, F2);
+        }
+        else
+        {
+            std::swap(B1, B3);
+            std::swap(F1, F3);
+        }
+    }
+
+    if(G2 != G3)
+    {
+        if(G1 != G2)
+        {
+            std::swap(C1, C2);
+            std::swap(G1, G2);
+        }
+        else
+        {
+            std::swap(C1, C3);
+            std::swap(G1, G3);
+        }
+    }
+
+    if(F1 > 0u) std::swap(C2, C3);
+    if(G1 > 0u) std::swap(B2, B3);
+
+    if((coreVector3::Dot(C2 - B1, coreVector3::Cross(B2 - B1, C1 - B1)) <= 0.0f) &&
+       (coreVector3::Dot(C1 - B1, coreVector3::Cross(B3 - B1, C3 - B1)) <= 0.0f))
+    {
+        (*pvIntersection) = (C1 + C2 + C3 + B1 + B2 + B3) * (1.0f/6.0f);
+        return true;
+    }
+
+    return false;
 }
 
 
@@ -580,20 +772,254 @@ void coreObjectManager::__UnbindObject(coreObject3D* pObject, const coreInt32 iT
 /* handle and track new collisions */
 coreBool coreObjectManager::__NewCollision(const coreObject3D* pObject1, const coreObject3D* pObject2)
 {
-    // create lookup key
-    coreObjectCollision oCollision;
-    oCollision.pObject1 = pObject1;
-    oCollision.pObject2 = pObject2;
+    ASSERT(pObject1 && pObject2)
+
+    // keep the cache at most half full (also drops expired collisions)
+    if((m_iCollisionUsed + 1u) * 2u > m_aObjectCollision.size()) this->__RehashCollisions();
+
+    const coreUint32 iCurFrame = Core::System->GetCurFrame();
+    const coreUintW  iMask     = m_aObjectCollision.size() - 1u;
 
-    // find existing collision
-    if(m_aiObjectCollision.count_bs(oCollision))
+    for(coreUintW i = coreUintW(coreObjectManager::__HashCollision(pObject1, pObject2)) & iMask; true; i = (i + 1u) & iMask)
     {
-        // update frame number
-        m_aiObjectCollision.at_bs(oCollision) = Core::System->GetCurFrame();
-        return false;
+        coreObjectCollision& oSlot = m_aObjectCollision[i];
+
+        // add collision to cache
+        if(!oSlot.pObject1)
+        {
+            oSlot.pObject1 = pObject1;
+            oSlot.pObject2 = pObject2;
+            oSlot.iFrame   = iCurFrame;
+
+            m_iCollisionUsed += 1u;
+            return true;
+        }
+
+        // find existing collision
+        if((oSlot.pObject1 == pObject1) && (oSlot.pObject2 == pObject2))
+        {
+            // update frame number (and revive expired collision)
+            const coreBool bNew = (oSlot.iFrame < m_iCollisionExpire);
+            oSlot.iFrame = iCurFrame;
+
+            return bNew;
+        }
+    }
+}
+
+
+// ****************************************************************
+/* re-create collision cache without expired collisions */
+void coreObjectManager::__RehashCollisions()
+{
+    // take over all current collisions
+    coreList<coreObjectCollision> aOld = std::move(m_aObjectCollision);
+
+    coreUintW iAlive = 0u;
+    FOR_EACH(it, aOld) if(it->pObject1 && (it->iFrame >= m_iCollisionExpire)) ++iAlive;
+
+    // allocate new cache (at most a quarter full, to delay the next re-creation)
+    m_aObjectCollision.clear();
+    m_aObjectCollision.resize(MAX(coreMath::CeilPot(iAlive * 4u), coreUintW(CORE_OBJECT_COLLISION)));
+    m_iCollisionUsed = iAlive;
+
+    // re-insert all remaining collisions
+    const coreUintW iMask = m_aObjectCollision.size() - 1u;
+    FOR_EACH(it, aOld)
+    {
+        if(!it->pObject1 || (it->iFrame < m_iCollisionExpire)) continue;
+
+        coreUintW i = coreUintW(coreObjectManager::__HashCollision(it->pObject1, it->pObject2)) & iMask;
+        while(m_aObjectCollision[i].pObject1) i = (i + 1u) & iMask;
+
+        m_aObjectCollision[i] = (*it);
+    }
+}
+
+
+// ****************************************************************
+/* update broadphase bounds with current object positions */
+void coreObjectManager::__RefreshBroadphase(const coreInt32 iType, const coreBool bResort)
+{
+    const coreObjectList&      oList  = m_aapObjectList[iType];
+    coreList<coreObjectBound>& aBound = m_aaBroadphase.at_bs(iType);
+    ASSERT(aBound.size() <= oList.size())
+
+    // track new list entries (always added at the end)
+    for(coreUintW i = aBound.size(), ie = oList.size(); i < ie; ++i)
+    {
+        aBound.push_back({0.0f, 0.0f, coreUint32(i)});
+    }
+
+    // update bounds along the sweep axis
+    FOR_EACH(it, aBound)
+    {
+        const coreObject3D* pObject = oList[it->iIndex];
+        if(!pObject) continue;   // # skipped by all tests
+
+        const coreFloat fCenter = pObject->GetPosition().arr(m_iSweepAxis);
+        const coreFloat fRadius = pObject->GetCollisionRadius();
+        const coreFloat fError  = (ABS(fCenter) + fRadius + 1.0f) * (4.0f * FLT_EPSILON);   // stay conservative against rounding (compared to the narrowphase)
+
+        it->fMin = fCenter - fRadius - fError;
+        it->fMax = fCenter + fRadius + fError;
+    }
+
+    if(bResort)
+    {
+        // sort all bounds
+        std::sort(aBound.begin(), aBound.end(), [](const coreObjectBound& A, const coreObjectBound& B) {return (A.fMin < B.fMin);});
+    }
+    else
+    {
+        // restore order with insertion sort (bounds are nearly sorted from the previous refresh)
+        for(coreUintW i = 1u, ie = aBound.size(); i < ie; ++i)
+        {
+            const coreObjectBound oBound = aBound[i];
+
+            coreUintW j = i;
+            for(; j && (aBound[j - 1u].fMin > oBound.fMin); --j) aBound[j] = aBound[j - 1u];
+            aBound[j] = oBound;
+        }
+    }
+}
+
+
+// ****************************************************************
+/* gather potentially colliding entries within a list */
+coreBool coreObjectManager::__GatherCandidates(const coreInt32 iType, coreList<coreUint64>* OUTPUT paiCandidate)
+{
+    ASSERT(paiCandidate && paiCandidate->empty())
+
+    if(!m_aaBroadphase.count_bs(iType)) return false;
+    this->__RefreshBroadphase(iType, false);
+
+    const coreObjectList&            oList  = m_aapObjectList.at(iType);
+    const coreList<coreObjectBound>& aBound = m_aaBroadphase.at_bs(iType);
+
+    // sweep over all overlapping bounds
+    for(coreUintW i = 0u, ie = aBound.size(); i < ie; ++i)
+    {
+        const coreObjectBound& A = aBound[i];
+        if(!oList[A.iIndex]) continue;
+
+        for(coreUintW j = i + 1u; (j < ie) && (aBound[j].fMin <= A.fMax); ++j)
+        {
+            const coreObjectBound& B = aBound[j];
+            if(!oList[B.iIndex]) continue;
+
+            // store pair with ascending indices
+            paiCandidate->push_back((coreUint64(MIN(A.iIndex, B.iIndex)) << 32u) | coreUint64(MAX(A.iIndex, B.iIndex)));
+        }
+    }
+
+    // restore order of the full loop
+    std::sort(paiCandidate->begin(), paiCandidate->end());
+    return true;
+}
+
+
+// ****************************************************************
+/* gather potentially colliding entries between two different lists */
+coreBool coreObjectManager::__GatherCandidates(const coreInt32 iType1, const coreInt32 iType2, coreList<coreUint64>* OUTPUT paiCandidate)
+{
+    ASSERT(paiCandidate && paiCandidate->empty())
+
+    if(!m_aaBroadphase.count_bs(iType1) || !m_aaBroadphase.count_bs(iType2)) return false;
+    this->__RefreshBroadphase(iType1, false);
+    this->__RefreshBroadphase(iType2, false);
+
+    const coreObjectList&            oList1  = m_aapObjectList.at(iType1);
+    const coreObjectList&            oList2  = m_aapObjectList.at(iType2);
+    const coreList<coreObjectBound>& aBound1 = m_aaBroadphase.at_bs(iType1);
+    const coreList<coreObjectBound>& aBound2 = m_aaBroadphase.at_bs(iType2);
+
+    // sweep over both sorted lists at once (each pair is found from the bound with the lower start)
+    for(coreUintW i = 0u, j = 0u, ie = aBound1.size(), je = aBound2.size(); (i < ie) && (j < je); )
+    {
+        if(aBound1[i].fMin <= aBound2[j].fMin)
+        {
+            const coreObjectBound& A = aBound1[i++];
+            if(!oList1[A.iIndex]) continue;
+
+            for(coreUintW k = j; (k < je) && (aBound2[k].fMin <= A.fMax); ++k)
+            {
+                if(oList2[aBound2[k].iIndex]) paiCandidate->push_back((coreUint64(A.iIndex) << 32u) | coreUint64(aBound2[k].iIndex));
+            }
+        }
+        else
+        {
+            const coreObjectBound& B = aBound2[j++];
+            if(!oList2[B.iIndex]) continue;
+
+            for(coreUintW k = i; (k < ie) && (aBound1[k].fMin <= B.fMax); ++k)
+            {
+                if(oList1[aBound1[k].iIndex]) paiCandidate->push_back((coreUint64(aBound1[k].iIndex) << 32u) | coreUint64(B.iIndex));
+            }
+        }
+    }
+
+    // restore order of the full loop
+    std::sort(paiCandidate->begin(), paiCandidate->end());
+    return true;
+}
+
+
+// ****************************************************************
+/* gather potentially colliding entries with a 3d-object */
+coreBool coreObjectManager::__GatherCandidates(const coreInt32 iType, const coreObject3D* pObject, coreList<coreUint64>* OUTPUT paiCandidate)
+{
+    ASSERT(pObject && paiCandidate && paiCandidate->empty())
+
+    if(!m_aaBroadphase.count_bs(iType)) return false;
+    this->__RefreshBroadphase(iType, false);
+
+    const coreList<coreObjectBound>& aBound = m_aaBroadphase.at_bs(iType);
+
+    // calculate bound of the 3d-object (same as list entries)
+    const coreFloat fCenter = pObject->GetPosition().arr(m_iSweepAxis);
+    const coreFloat fRadius = pObject->GetCollisionRadius();
+    const coreFloat fError  = (ABS(fCenter) + fRadius + 1.0f) * (4.0f * FLT_EPSILON);
+    const coreFloat fMin    = fCenter - fRadius - fError;
+    const coreFloat fMax    = fCenter + fRadius + fError;
+
+    // collect all overlapping bounds
+    for(coreUintW i = 0u, ie = aBound.size(); (i < ie) && (aBound[i].fMin <= fMax); ++i)
+    {
+        if(aBound[i].fMax >= fMin) paiCandidate->push_back(aBound[i].iIndex);
+    }
+
+    // restore order of the full loop
+    std::sort(paiCandidate->begin(), paiCandidate->end());
+    return true;
+}
+
+
+// ****************************************************************
+/* gather potentially colliding entries with a ray */
+coreBool coreObjectManager::__GatherCandidates(const coreInt32 iType, const coreVector3 vRayPos, const coreVector3 vRayDir, coreList<coreUint64>* OUTPUT paiCandidate)
+{
+    ASSERT(paiCandidate && paiCandidate->empty())
+
+    if(!m_aaBroadphase.count_bs(iType)) return false;
+    this->__RefreshBroadphase(iType, false);
+
+    const coreList<coreObjectBound>& aBound = m_aaBroadphase.at_bs(iType);
+
+    // get ray along the sweep axis (only moving into one direction)
+    const coreFloat fPos = vRayPos.arr(m_iSweepAxis);
+    const coreFloat fDir = vRayDir.arr(m_iSweepAxis);
+
+    // collect all bounds in front of the ray
+    for(coreUintW i = 0u, ie = aBound.size(); i < ie; ++i)
+    {
+        if((fDir <= 0.0f) && (aBound[i].fMin > fPos)) break;
+        if((fDir >= 0.0f) && (aBound[i].fMax < fPos)) continue;
+
+        paiCandidate->push_back(aBound[i].iIndex);
     }
 
-    // add collision to list
-    m_aiObjectCollision.emplace_bs(oCollision, Core::System->GetCurFrame());
+    // restore order of the full loop
+    std::sort(paiCandidate->begin(), paiCandidate->end());
     return true;
 }
\ No newline at end of file
@@ -15,13 +15,13 @@
 // TODO 4: cleanup resource-manager reset of object-manager, change location of global resources/objects (incl. single triangle)
 // TODO 2: add pre-registering interface to object manager ? accessing a non-existing list can cause issues
 // TODO 4: [const coreObject3D*] should be [const coreObject3D&], but pointers are swapped (for performance reasons)
-// TODO 2: collision between precise and simple volume should actually do a sphere<>triangle intersection test
 // TODO 4: [CORE2] change m_iStatus and m_iType to unsigned
 
 
 // ****************************************************************
 /* object definitions */
-#define CORE_OBJECT_RAY_HITCOUNT (16u)   // maximum number of hits recognized by a single ray-intersection test
+#define CORE_OBJECT_RAY_HITCOUNT (16u)     // maximum number of hits recognized by a single ray-intersection test
+#define CORE_OBJECT_COLLISION    (0x400u)  // minimum number of collision cache slots (power of two)
 
 enum coreObjectUpdate : coreUint8
 {
@@ -51,7 +51,8 @@ protected:
     coreTexturePtr m_apTexture[CORE_TEXTURE_UNITS];   // multiple texture objects
     coreProgramPtr m_pProgram;                        // shader-program object
 
-    coreVector4 m_vColor;                             // RGBA color-value
+    coreVector4  m_vColor;                            // RGBA color-value (unused while redirected)
+    coreVector4* m_pvColorStore;                      // redirected RGBA color-value (inside a transform store, NULL = own value)
     coreVector2 m_vTexSize;                           // size-factor of the texture
     coreVector2 m_vTexOffset;                         // offset of the texture
 
@@ -86,9 +87,9 @@ public:
     inline coreBool HasStatus   (const coreInt32 iStatus)const {return HAS_FLAG(m_iStatus, iStatus);}
 
     /* set object properties */
-    inline void SetColor4   (const coreVector4      vColor)     {m_vColor     = vColor;}
-    inline void SetColor3   (const coreVector3      vColor)     {m_vColor.xyz(vColor);}
-    inline void SetAlpha    (const coreFloat        fAlpha)     {m_vColor.w   = fAlpha;}
+    inline void SetColor4   (const coreVector4      vColor)     {this->__Color()     = vColor;}
+    inline void SetColor3   (const coreVector3      vColor)     {this->__Color().xyz(vColor);}
+    inline void SetAlpha    (const coreFloat        fAlpha)     {this->__Color().w   = fAlpha;}
     inline void SetTexSize  (const coreVector2      vTexSize)   {m_vTexSize   = vTexSize;}
     inline void SetTexOffset(const coreVector2      vTexOffset) {m_vTexOffset = vTexOffset;}
     inline void SetEnabled  (const coreObjectEnable eEnabled)   {m_eEnabled   = eEnabled;}
@@ -97,13 +98,19 @@ public:
     /* get object properties */
     inline const coreTexturePtr&   GetTexture  (const coreUintW iUnit)const {ASSERT(iUnit < CORE_TEXTURE_UNITS) return m_apTexture[iUnit];}
     inline const coreProgramPtr&   GetProgram  ()const                      {return m_pProgram;}
-    inline const coreVector4&      GetColor4   ()const                      {return m_vColor;}
-    inline       coreVector3       GetColor3   ()const                      {return m_vColor.xyz();}
-    inline const coreFloat&        GetAlpha    ()const                      {return m_vColor.w;}
+    inline const coreVector4&      GetColor4   ()const                      {return this->__Color();}
+    inline       coreVector3       GetColor3   ()const                      {return this->__Color().xyz();}
+    inline const coreFloat&        GetAlpha    ()const                      {return this->__Color().w;}
     inline const coreVector2&      GetTexSize  ()const                      {return m_vTexSize;}
     inline const coreVector2&      GetTexOffset()const                      {return m_vTexOffset;}
     inline const coreObjectEnable& GetEnabled  ()const                      {return m_eEnabled;}
     inline const coreInt32&        GetStatus   ()const                      {return m_iStatus;}
+
+
+protected:
+    /* access color-value (redirected into a transform store while stored) */
+    inline       coreVector4& __Color()      {return m_pvColorStore ? (*m_pvColorStore) : m_vColor;}
+    inline const coreVector4& __Color()const {return m_pvColorStore ? (*m_pvColorStore) : m_vColor;}
 };
 
 
@@ -115,22 +122,34 @@ private:
     /* internal types */
     using coreObjectList = coreList<coreObject3D*>;
 
-    /* object collision structure */
+    /* object collision structure (open-addressing cache slot) */
     struct coreObjectCollision final
     {
-        const coreObject3D* pObject1;   // first 3d-object
+        const coreObject3D* pObject1;   // first 3d-object (NULL = empty slot)
         const coreObject3D* pObject2;   // second 3d-object
+        coreUint32          iFrame;     // frame of the last contact
+    };
 
-        ENABLE_COMPARISON(coreObjectCollision)
+    /* object bound structure (for the broadphase) */
+    struct coreObjectBound final
+    {
+        coreFloat  fMin;     // lower bound along the sweep axis
+        coreFloat  fMax;     // upper bound along the sweep axis
+        coreUint32 iIndex;   // index of the 3d-object within its list
     };
 
 
 private:
     coreMap<coreInt32, coreObjectList>       m_aapObjectList;       // lists with pointers to registered 3d-objects <type, list>
-    coreMap<coreObjectCollision, coreUint32> m_aiObjectCollision;   // currently recorded collisions
+    coreList<coreObjectCollision> m_aObjectCollision;               // currently recorded collisions (linear probing, power-of-two size)
+    coreUint32                    m_iCollisionUsed;                 // number of occupied collision slots (including expired ones)
+    coreUint32                    m_iCollisionExpire;               // frame of the last expiration (older contacts count as expired)
+
+    coreSet<coreInt32> m_aiDirtyType;                               // types with removed 3d-objects (lists get compacted on the next update)
 
-    coreMap<coreObject3D*, coreUint16> m_aiIndex;                   // index for fast 3d-object lookup
-    coreBool                           m_bIndexDirty;               // index needs full reconstruction
+    coreMap<coreInt32, coreList<coreObjectBound>> m_aaBroadphase;   // sweep-and-prune bounds of all list entries <type, bounds> (sorted by lower bound)
+    coreList<coreUint64>                          m_aiCandidate;    // reusable memory for broadphase candidates (packed list indices)
+    coreUint8                                     m_iSweepAxis;     // current sweep axis (with the largest object spread)
 
     coreModelPtr m_pLowQuad;                                        // low-memory square model (4 bytes per vertex, 16 total)
     coreModelPtr m_pLowTriangle;                                    // low-memory triangle model (8 bytes per vertex, 24 total)
@@ -161,6 +180,12 @@ public:
     static coreBool            TestCollision(const coreObject3D* pObject1, const coreObject3D* pObject2,                           coreVector3* OUTPUT pvIntersection);
     static coreBool            TestCollision(const coreObject3D* pObject,  const coreVector3   vRayPos, const coreVector3 vRayDir, coreFloat*   OUTPUT pfHitDistance, coreUint8* OUTPUT piHitCount);
 
+    /* test collision between many pairs of 3d-objects at once (bounding sphere and box only, <index1 << 32 | index2>, returns number of potential pairs kept at the front, result is only valid until objects change) */
+    static coreUintW TestCollisionBatch(const coreObject3D* const* ppObject1, const coreObject3D* const* ppObject2, coreUint64* OUTPUT piPair, const coreUintW iNumPairs);
+
+    /* control broadphase for a type (opt-in, same callbacks in the same order, as long as callbacks do not move objects into new overlaps within the same test) */
+    void SetBroadphase(const coreInt32 iType, const coreBool bEnable);
+
     /* refresh all existing 2d-objects */
     void RefreshSprites();
 
@@ -192,11 +217,37 @@ private:
     inline void __BindSprite  (coreObject2D* pSprite) {ASSERT(!m_apSpriteList.count_bs(pSprite)) m_apSpriteList.insert_bs(pSprite);}
     inline void __UnbindSprite(coreObject2D* pSprite) {ASSERT( m_apSpriteList.count_bs(pSprite)) m_apSpriteList.erase_bs (pSprite);}
 
+    /* test precise collision primitives */
+    static coreBool __TestTriangleTriangle(const coreVector3 A1, const coreVector3 A2, const coreVector3 A3, coreVector3 B1, coreVector3 B2, coreVector3 B3, coreVector3* OUTPUT pvIntersection);
+
     /* handle and track new collisions */
-    coreBool __NewCollision(const coreObject3D* pObject1, const coreObject3D* pObject2);
+    coreBool __NewCollision     (const coreObject3D* pObject1, const coreObject3D* pObject2);
+    void     __RehashCollisions ();
+    static inline coreUint64 __HashCollision(const coreObject3D* pObject1, const coreObject3D* pObject2);
+
+    /* update broadphase bounds with current object positions */
+    void __RefreshBroadphase(const coreInt32 iType, const coreBool bResort);
+
+    /* gather potentially colliding list entries with the broadphase (sorted like the full loops) */
+    coreBool __GatherCandidates(const coreInt32 iType,                          coreList<coreUint64>* OUTPUT paiCandidate);
+    coreBool __GatherCandidates(const coreInt32 iType1, const coreInt32 iType2, coreList<coreUint64>* OUTPUT paiCandidate);
+    coreBool __GatherCandidates(const coreInt32 iType,  const coreObject3D* pObject, coreList<coreUint64>* OUTPUT paiCandidate);
+    coreBool __GatherCandidates(const coreInt32 iType,  const coreVector3 vRayPos, const coreVector3 vRayDir, coreList<coreUint64>* OUTPUT paiCandidate);
 };
 
 
+// ****************************************************************
+/* hash collision pair (Murmur3 finalizer) */
+inline coreUint64 coreObjectManager::__HashCollision(const coreObject3D* pObject1, const coreObject3D* pObject2)
+{
+    coreUint64 iHash = coreUint64(P_TO_UI(pObject1)) ^ (coreUint64(P_TO_UI(pObject2)) * 0x9E3779B97F4A7C15u);
+    iHash ^= iHash >> 33u; iHash *= 0xFF51AFD7ED558CCDu;
+    iHash ^= iHash >> 33u; iHash *= 0xC4CEB9FE1A85EC53u;
+    iHash ^= iHash >> 33u;
+    return iHash;
+}
+
+
 // ****************************************************************
 /* test collision within a list */
 template <typename F> void coreObjectManager::TestCollision(const coreInt32 iType, F&& nCallback)
@@ -206,27 +257,50 @@ template <typename F> void coreObjectManager::TestCollision(const coreInt32 iTyp
     // get requested list
     const coreObjectList& oList = m_aapObjectList[iType];
 
-    // loop through all objects
-    for(coreUintW i = 0u, ie = oList.size(); i < ie; ++i)
+    const auto nTestFunc = [&](const coreUintW i, const coreUintW j)
     {
-        for(coreUintW j = i + 1u; j < ie; ++j)
+        coreObject3D* pObject1 = oList[i];   // # may change
+        if(!pObject1) return;
+
+        coreObject3D* pObject2 = oList[j];
+        if(!pObject2) return;
+
+        // test collision and call function
+        coreVector3 vIntersection;
+        if(coreObjectManager::TestCollision(pObject1, pObject2, &vIntersection))
         {
-            coreObject3D* pObject1 = oList[i];   // # may change
-            if(!pObject1) continue;
+            nCallback(d_cast<typename TRAIT_ARG_TYPE(F, 0u)>(pObject1),
+                      d_cast<typename TRAIT_ARG_TYPE(F, 1u)>(pObject2),
+                      vIntersection, this->__NewCollision(pObject1, pObject2));
+        }
+    };
+
+    // take over candidate memory (nested tests get their own)
+    coreList<coreUint64> aiCandidate = std::move(m_aiCandidate);
 
-            coreObject3D* pObject2 = oList[j];
-            if(!pObject2) continue;
+    if(this->__GatherCandidates(iType, &aiCandidate))
+    {
+        // remove candidates without bounding intersection (in batches, # before all callbacks, like the broadphase)
+        aiCandidate.resize(coreObjectManager::TestCollisionBatch(oList.data(), oList.data(), aiCandidate.data(), aiCandidate.size()));
 
-            // test collision and call function
-            coreVector3 vIntersection;
-            if(coreObjectManager::TestCollision(pObject1, pObject2, &vIntersection))
+        // loop through all candidates (# gathered before all callbacks, each one is still tested precisely with current values)
+        FOR_EACH(it, aiCandidate) nTestFunc(coreUintW((*it) >> 32u), coreUintW((*it) & 0xFFFFFFFFu));
+    }
+    else
+    {
+        // loop through all objects
+        for(coreUintW i = 0u, ie = oList.size(); i < ie; ++i)
+        {
+            for(coreUintW j = i + 1u; j < ie; ++j)
             {
-                nCallback(d_cast<typename TRAIT_ARG_TYPE(F, 0u)>(pObject1),
-                          d_cast<typename TRAIT_ARG_TYPE(F, 1u)>(pObject2),
-                          vIntersection, this->__NewCollision(pObject1, pObject2));
+                nTestFunc(i, j);
             }
         }
     }
+
+    // return candidate memory
+    aiCandidate.clear();
+    m_aiCandidate = std::move(aiCandidate);
 }
 
 
@@ -243,27 +317,50 @@ template <typename F> void coreObjectManager::TestCollision(const coreInt32 iTyp
     const coreObjectList& oList1 = m_aapObjectList.at(iType1);
     const coreObjectList& oList2 = m_aapObjectList.at(iType2);
 
-    // loop through all objects
-    for(coreUintW i = 0u, ie = oList1.size(), je = oList2.size(); i < ie; ++i)
+    const auto nTestFunc = [&](const coreUintW i, const coreUintW j)
     {
-        for(coreUintW j = 0u; j < je; ++j)
+        coreObject3D* pObject1 = oList1[i];   // # may change
+        if(!pObject1) return;
+
+        coreObject3D* pObject2 = oList2[j];
+        if(!pObject2) return;
+
+        // test collision and call function
+        coreVector3 vIntersection;
+        if(coreObjectManager::TestCollision(pObject1, pObject2, &vIntersection))
         {
-            coreObject3D* pObject1 = oList1[i];   // # may change
-            if(!pObject1) continue;
+            nCallback(d_cast<typename TRAIT_ARG_TYPE(F, 0u)>(pObject1),
+                      d_cast<typename TRAIT_ARG_TYPE(F, 1u)>(pObject2),
+                      vIntersection, this->__NewCollision(pObject1, pObject2));
+        }
+    };
 
-            coreObject3D* pObject2 = oList2[j];
-            if(!pObject2) continue;
+    // take over candidate memory (nested tests get their own)
+    coreList<coreUint64> aiCandidate = std::move(m_aiCandidate);
 
-            // test collision and call function
-            coreVector3 vIntersection;
-            if(coreObjectManager::TestCollision(pObject1, pObject2, &vIntersection))
+    if(this->__GatherCandidates(iType1, iType2, &aiCandidate))
+    {
+        // remove candidates without bounding intersection (in batches, # before all callbacks, like the broadphase)
+        aiCandidate.resize(coreObjectManager::TestCollisionBatch(oList1.data(), oList2.data(), aiCandidate.data(), aiCandidate.size()));
+
+        // loop through all candidates (# gathered before all callbacks, each one is still tested precisely with current values)
+        FOR_EACH(it, aiCandidate) nTestFunc(coreUintW((*it) >> 32u), coreUintW((*it) & 0xFFFFFFFFu));
+    }
+    else
+    {
+        // loop through all objects
+        for(coreUintW i = 0u, ie = oList1.size(), je = oList2.size(); i < ie; ++i)
+        {
+            for(coreUintW j = 0u; j < je; ++j)
             {
-                nCallback(d_cast<typename TRAIT_ARG_TYPE(F, 0u)>(pObject1),
-                          d_cast<typename TRAIT_ARG_TYPE(F, 1u)>(pObject2),
-                          vIntersection, this->__NewCollision(pObject1, pObject2));
+                nTestFunc(i, j);
             }
         }
     }
+
+    // return candidate memory
+    aiCandidate.clear();
+    m_aiCandidate = std::move(aiCandidate);
 }
 
 
@@ -276,14 +373,13 @@ template <typename F> void coreObjectManager::TestCollision(const coreInt32 iTyp
     // get requested list
     const coreObjectList& oList = m_aapObjectList[iType];
 
-    // loop through all objects
-    for(coreUintW i = 0u, ie = oList.size(); i < ie; ++i)
+    const auto nTestFunc = [&](const coreUintW i)
     {
         coreObject3D* pCurObject = oList[i];
-        if(!pCurObject) continue;
+        if(!pCurObject) return;
 
         // never compare with itself
-        if(pCurObject == pObject) continue;
+        if(pCurObject == pObject) return;
 
         // test collision and call function
         coreVector3 vIntersection;
@@ -293,7 +389,28 @@ template <typename F> void coreObjectManager::TestCollision(const coreInt32 iTyp
                       d_cast<typename TRAIT_ARG_TYPE(F, 1u)>(pObject),
                       vIntersection, this->__NewCollision(pCurObject, pObject));
         }
+    };
+
+    // take over candidate memory (nested tests get their own)
+    coreList<coreUint64> aiCandidate = std::move(m_aiCandidate);
+
+    if(this->__GatherCandidates(iType, pObject, &aiCandidate))
+    {
+        // loop through all candidates (# gathered before all callbacks, each one is still tested precisely with current values)
+        FOR_EACH(it, aiCandidate) nTestFunc(coreUintW(*it));
+    }
+    else
+    {
+        // loop through all objects
+        for(coreUintW i = 0u, ie = oList.size(); i < ie; ++i)
+        {
+            nTestFunc(i);
+        }
     }
+
+    // return candidate memory
+    aiCandidate.clear();
+    m_aiCandidate = std::move(aiCandidate);
 }
 
 
@@ -306,11 +423,10 @@ template <typename F> void coreObjectManager::TestCollision(const coreInt32 iTyp
     // get requested list
     const coreObjectList& oList = m_aapObjectList[iType];
 
-    // loop through all objects
-    for(coreUintW i = 0u, ie = oList.size(); i < ie; ++i)
+    const auto nTestFunc = [&](const coreUintW i)
     {
         coreObject3D* pCurObject = oList[i];
-        if(!pCurObject) continue;
+        if(!pCurObject) return;
 
         // test collision and call function
         coreFloat afHitDistance[CORE_OBJECT_RAY_HITCOUNT] = {};
@@ -320,7 +436,28 @@ template <typename F> void coreObjectManager::TestCollision(const coreInt32 iTyp
             nCallback(d_cast<typename TRAIT_ARG_TYPE(F, 0u)>(pCurObject),
                       afHitDistance, iHitCount, this->__NewCollision(pCurObject, r_cast<coreObject3D*>(&nCallback)));
         }
+    };
+
+    // take over candidate memory (nested tests get their own)
+    coreList<coreUint64> aiCandidate = std::move(m_aiCandidate);
+
+    if(this->__GatherCandidates(iType, vRayPos, vRayDir, &aiCandidate))
+    {
+        // loop through all candidates (# gathered before all callbacks, each one is still tested precisely with current values)
+        FOR_EACH(it, aiCandidate) nTestFunc(coreUintW(*it));
+    }
+    else
+    {
+        // loop through all objects
+        for(coreUintW i = 0u, ie = oList.size(); i < ie; ++i)
+        {
+            nTestFunc(i);
+        }
     }
+
+    // return candidate memory
+    aiCandidate.clear();
+    m_aiCandidate = std::move(aiCandidate);
 }
 
 
@@ -10,26 +10,29 @@
 
 alignas(ALIGNMENT_PAGE) coreResourceHandle* coreResourceManager::s_apHandleTable  [CORE_RESOURCE_INDICES] = {};   // # pages are only allocated on first access
 alignas(ALIGNMENT_PAGE) coreResource*       coreResourceManager::s_apResourceTable[CORE_RESOURCE_INDICES] = {};
+alignas(ALIGNMENT_PAGE) coreJob*            coreResourceManager::s_apJobTable     [CORE_RESOURCE_INDICES] = {};
 coreResourceIndex                           coreResourceManager::s_iTableStart                            = 1u;
 
 
 // ****************************************************************
 /* constructor */
-coreResourceHandle::coreResourceHandle(coreResource* pResource, coreFile* pFile, const coreChar* pcName, const coreBool bAutomatic, const coreBool bPersist)noexcept
+coreResourceHandle::coreResourceHandle(coreResource* pResource, coreFile* pFile, const coreInternString& sName, const coreBool bAutomatic, const coreBool bPersist)noexcept
 : m_pResource  (pResource)
 , m_pFile      (pFile)
-, m_sName      (pcName)
+, m_sName      (sName)
 , m_bAutomatic (bAutomatic)
 , m_bPersist   (bPersist)
 , m_bProxy     (false)
 , m_bUnload    (false)
+, m_ePriority  (CORE_RESOURCE_PRIORITY_SOON)
+, m_bPrepared  (false)
 , m_iIndex     (0u)
 , m_UpdateLock ()
 , m_eStatus    ((pFile || bAutomatic) ? CORE_BUSY : CORE_OK)
 , m_iRefCount  (0u)
 {
     // assign resource name
-    if(m_pResource) m_pResource->AssignName(pcName);
+    if(m_pResource) m_pResource->AssignName(m_sName.GetString());
 
     // acquire resource index table space
     coreResourceManager::AllocIndex(this);
@@ -38,6 +41,9 @@ coreResourceHandle::coreResourceHandle(coreResource* pResource, coreFile* pFile,
     if(m_bPersist || Core::Config->GetBool(CORE_CONFIG_BASE_PERSISTMODE) || DEFINED(_CORE_SWITCH_))
     {
         if(m_bAutomatic) this->RefIncrease();
+
+        // load only when nothing else is pending (until referenced)
+        m_ePriority = CORE_RESOURCE_PRIORITY_BACKGROUND;
     }
 }
 
@@ -105,6 +111,12 @@ coreResourceManager::coreResourceManager()noexcept
 , m_apDirectFile {}
 , m_apProxy      {}
 , m_apRelation   {}
+, m_ReadQueue    ()
+, m_aiFinish     {}
+, m_iFinishNext  (0u)
+, m_iFinishNum   (0u)
+, m_iJobNum      (0u)
+, m_FinishLock   ()
 , m_ResourceLock ()
 , m_FileLock     ()
 , m_bActive      (false)
@@ -147,6 +159,9 @@ coreResourceManager::~coreResourceManager()
     FOR_EACH(it, m_apArchive)    MANAGED_DELETE(*it)
     FOR_EACH(it, m_apDirectFile) MANAGED_DELETE(*it)
 
+    // delete loading jobs
+    for(coreUintW i = 0u; i < CORE_RESOURCE_INDICES; ++i) if(s_apJobTable[i]) MANAGED_DELETE(s_apJobTable[i])
+
     // clear memory
     m_apHandle    .clear();
     m_apArchive   .clear();
@@ -166,25 +181,60 @@ void coreResourceManager::UpdateResources(const coreFloat fBudgetSec)
     {
         const coreElapsed oElapsed;
 
-        m_ResourceLock.Lock();
+        // check for parallel resource loading
+        const coreBool bParallel = this->__IsParallel();
+
+        if(bParallel)
         {
-            // loop through all resource handles
-            for(coreUintW i = 0u; i < LOOP_NONZERO(m_apHandle.size()); ++i)   // # size may change
+            // finalize resource handles prepared by loading jobs
+            coreResourceHandle* pCurHandle;
+            while((pCurHandle = this->__FetchFinished()))
             {
-                coreResourceHandle* pCurHandle = m_apHandle[i];
+                pCurHandle->__AutoUpdate();
+
+                // test current budget and stop processing
+                if(coreFloat(oElapsed.GetSeconds()) >= fBudgetSec) return;
+            }
+        }
+
+        m_ResourceLock.Lock();
+        {
+            coreBool bExceeded = false;
+
+            // queue loading jobs of resource handles with completed file reads
+            m_ReadQueue.Update();
 
-                // check for requirements
-                if(pCurHandle->__CanAutoUpdate())
+            // loop through all priorities (highest first)
+            for(coreUintW j = 0u; (j < CORE_RESOURCE_PRIORITY_MAX) && !bExceeded; ++j)
+            {
+                // loop through all resource handles
+                for(coreUintW i = 0u; i < LOOP_NONZERO(m_apHandle.size()); ++i)   // # size may change
                 {
-                    m_ResourceLock.Unlock();
+                    coreResourceHandle* pCurHandle = m_apHandle.get_valuelist()[i];
+
+                    // check for requirements
+                    if((pCurHandle->m_ePriority == j) && pCurHandle->__CanAutoUpdate())
                     {
-                        // update resource handle
-                        pCurHandle->__AutoUpdate();
+                        // forward to job workers (update-lock is acquired again by the job)
+                        if(bParallel && !pCurHandle->m_bPrepared && (j != CORE_RESOURCE_PRIORITY_NOW))
+                        {
+                            pCurHandle->__AutoCancel();
+
+                            // hold back background resources while other loading jobs are pending
+                            if((j != CORE_RESOURCE_PRIORITY_BACKGROUND) || !m_iJobNum) this->__DispatchWork(pCurHandle);
+                            continue;
+                        }
+
+                        m_ResourceLock.Unlock();
+                        {
+                            // update resource handle
+                            pCurHandle->__AutoUpdate();
+                        }
+                        m_ResourceLock.Lock();
+
+                        // test current budget and stop processing
+                        if(coreFloat(oElapsed.GetSeconds()) >= fBudgetSec) {bExceeded = true; break;}
                     }
-                    m_ResourceLock.Lock();
-
-                    // test current budget and stop processing
-                    if(coreFloat(oElapsed.GetSeconds()) >= fBudgetSec) break;
                 }
             }
         }
@@ -391,14 +441,15 @@ void coreResourceManager::Reset(const coreResourceReset eInit)
             (*it)->__Reset(CORE_RESOURCE_RESET_INIT);
 
         // start resource thread
-        if(Core::Graphics->GetResourceContext())
-            this->StartThread();
+        if(Core::Graphics->GetResourceContext()) this->StartThread();
     }
     else
     {
         // kill resource thread
-        if(Core::Graphics->GetResourceContext())
-            this->KillThread();
+        if(Core::Graphics->GetResourceContext()) this->KillThread();
+
+        // wait for all remaining loading jobs
+        this->__WaitAllWork();
 
         // shut down relation-objects
         FOR_EACH(it, apRelationCopy)
@@ -514,9 +565,6 @@ coreStatus coreResourceManager::__InitThread()
         glMaxShaderCompilerThreadsARB(0xFFFFFFFFu);
     }
 
-    // initialize temp-storage
-    coreTempStorageInit(1u);
-
     return CORE_OK;
 }
 
@@ -550,6 +598,147 @@ void coreResourceManager::__ExitThread()
 }
 
 
+// ****************************************************************
+/* forward resource handle to the job manager */
+void coreResourceManager::__DispatchWork(coreResourceHandle* pHandle)
+{
+    coreJob*& pJob = s_apJobTable[pHandle->m_iIndex];
+
+    // skip if the previous job is still queued or running
+    if(pJob && !pJob->IsFinished()) return;
+
+    const auto nFunction = [](void* pData, const coreUintW iIndex)
+    {
+        s_cast<coreResourceManager*>(pData)->__ProcessWork(coreResourceIndex(iIndex));
+    };
+
+    // create or reuse job object (one per resource index)
+    if(pJob) {CALL_DESTRUCTOR(pJob) CALL_CONSTRUCTOR(pJob, nFunction, this, pHandle->m_iIndex)}
+        else pJob = MANAGED_NEW(coreJob, nFunction, this, pHandle->m_iIndex);
+
+    m_iJobNum.FetchAdd(1u);
+
+    coreFile* pFile = pHandle->m_pFile;
+    if(pFile)
+    {
+        // read file data first and queue the job on completion (keeps the disk busy while job workers are occupied)
+        coreJob* pReadJob = pJob;
+        if(pFile->LoadDataAsync(&m_ReadQueue, [pReadJob]() {Core::Manager::Job->Run(pReadJob);}) == CORE_OK) return;
+
+        // start readahead otherwise (e.g. for compressed data, which is read and decoded by the job)
+        pFile->Prefetch();
+    }
+
+    Core::Manager::Job->Run(pJob);
+}
+
+
+// ****************************************************************
+/* process resource handle on job worker */
+void coreResourceManager::__ProcessWork(const coreResourceIndex iIndex)
+{
+    coreResourceHandle* pHandle = s_apHandleTable[iIndex];
+    ASSERT(pHandle)
+
+    // acquire update-lock on this thread (handle may have been loaded meanwhile)
+    if(pHandle->__CanAutoUpdate())
+    {
+        if(pHandle->m_bPrepared)
+        {
+            // already waiting for finalization
+            pHandle->__AutoCancel();
+        }
+        else if(pHandle->m_pResource->GetResourceType() == CORE_RESOURCE_TYPE_GRAPHICS)
+        {
+            // prepare resource data and forward to OpenGL context
+            if(pHandle->__AutoPrepare())
+            {
+                const coreLocker oLocker(&m_FinishLock);
+                m_aiFinish.push_back(iIndex);
+                m_iFinishNum.FetchAdd(1u);
+            }
+        }
+        else
+        {
+            // load resource completely
+            pHandle->__AutoUpdate();
+        }
+    }
+
+    m_iJobNum.FetchSub(1u);
+}
+
+
+// ****************************************************************
+/* wait for the loading job of a resource handle */
+void coreResourceManager::__WaitWork(const coreResourceHandle* pHandle)
+{
+    const coreJob* pJob = s_apJobTable[pHandle->m_iIndex];
+    if(pJob && !pJob->IsFinished())
+    {
+        // complete pending file reads (job may not be queued yet)
+        {
+            const coreLocker oLocker(&m_ResourceLock);
+            m_ReadQueue.Wait();
+        }
+
+        Core::Manager::Job->Wait(pJob);
+    }
+}
+
+
+// ****************************************************************
+/* wait for all loading jobs */
+void coreResourceManager::__WaitAllWork()
+{
+    // complete pending file reads (queues the remaining jobs)
+    {
+        const coreLocker oLocker(&m_ResourceLock);
+        m_ReadQueue.Wait();
+    }
+
+    for(coreUintW i = 0u; i < CORE_RESOURCE_INDICES; ++i)
+    {
+        if(s_apJobTable[i]) Core::Manager::Job->Wait(s_apJobTable[i]);
+    }
+
+    // drop all prepared resource handles (stay in loading state, prepared data is released on unload)
+    const coreLocker oLocker(&m_FinishLock);
+    m_aiFinish.clear();
+    m_iFinishNext = 0u;
+    m_iFinishNum  = 0u;
+}
+
+
+// ****************************************************************
+/* retrieve next prepared resource handle */
+coreResourceHandle* coreResourceManager::__FetchFinished()
+{
+    if(!m_iFinishNum) return NULL;   // # fast check without lock
+
+    const coreLocker oLocker(&m_FinishLock);   // # main-thread and resource thread may both finalize
+
+    while(m_iFinishNext < m_aiFinish.size())
+    {
+        m_iFinishNum.FetchSub(1u);
+
+        // take in order of preparation (re-acquire update-lock, handle may have been unloaded meanwhile)
+        coreResourceHandle* pHandle = s_apHandleTable[m_aiFinish[m_iFinishNext++]];
+        if(pHandle && pHandle->__CanAutoUpdate())
+        {
+            if(pHandle->m_bPrepared) return pHandle;
+            pHandle->__AutoCancel();
+        }
+    }
+
+    // all consumed, restart list
+    m_aiFinish.clear();
+    m_iFinishNext = 0u;
+
+    return NULL;
+}
+
+
 // ****************************************************************
 /* load all relevant default resources */
 void coreResourceManager::__LoadDefault()
@@ -559,8 +748,8 @@ void coreResourceManager::__LoadDefault()
         s_cast<coreResourceManager*>(pData)->RetrieveArchive(pcPath);
     });
 
-    this->Load<coreModel>  ("default_cube.md3z",              CORE_RESOURCE_UPDATE_AUTO,   "data/models/default_cube.md3z");
-    this->Load<coreModel>  ("default_sphere.md3z",            CORE_RESOURCE_UPDATE_AUTO,   "data/models/default_sphere.md3z");
+    this->Load<coreModel>  ("default_cube.md3z",              CORE_RESOURCE_UPDATE_AUTO,   "data/models/default_cube.md3z",          CORE_MODEL_LOAD_ARENA);
+    this->Load<coreModel>  ("default_sphere.md3z",            CORE_RESOURCE_UPDATE_AUTO,   "data/models/default_sphere.md3z",        CORE_MODEL_LOAD_ARENA);
     this->Load<coreTexture>("default_black.webp",             CORE_RESOURCE_UPDATE_AUTO,   "data/textures/default_black.webp",       CORE_TEXTURE_LOAD_NO_COMPRESS | CORE_TEXTURE_LOAD_NO_FILTER | CORE_TEXTURE_LOAD_NEAREST);
     this->Load<coreTexture>("default_normal.webp",            CORE_RESOURCE_UPDATE_AUTO,   "data/textures/default_normal.webp",      CORE_TEXTURE_LOAD_NO_COMPRESS | CORE_TEXTURE_LOAD_NO_FILTER | CORE_TEXTURE_LOAD_NEAREST);
     this->Load<coreTexture>("default_white.webp",             CORE_RESOURCE_UPDATE_AUTO,   "data/textures/default_white.webp",       CORE_TEXTURE_LOAD_NO_COMPRESS | CORE_TEXTURE_LOAD_NO_FILTER | CORE_TEXTURE_LOAD_NEAREST);
@@ -46,6 +46,14 @@ enum coreResourceType : coreUint8
     CORE_RESOURCE_TYPE_AUDIO    = 2u    // audio resource    (requires OpenAL context)
 };
 
+enum coreResourcePriority : coreUint8
+{
+    CORE_RESOURCE_PRIORITY_NOW        = 0u,   // needed this frame (loaded directly, without jobs, raised while something waits for it)
+    CORE_RESOURCE_PRIORITY_SOON       = 1u,   // needed soon (default, raised on reference)
+    CORE_RESOURCE_PRIORITY_BACKGROUND = 2u,   // loaded when nothing else is pending (persistent resources without reference)
+    CORE_RESOURCE_PRIORITY_MAX        = 3u
+};
+
 
 // ****************************************************************
 /* resource interface */
@@ -65,6 +73,9 @@ public:
     virtual coreStatus Load(coreFile* pFile) = 0;
     virtual coreStatus Unload()              = 0;
 
+    /* prepare resource data before loading (called without OpenGL context, on job worker threads) */
+    virtual coreStatus Prepare(coreFile* pFile) {return CORE_OK;}
+
     /* get resource type */
     virtual coreResourceType GetResourceType()const = 0;
 
@@ -98,12 +109,15 @@ private:
     coreResource* m_pResource;             // handled resource object
     coreFile*     m_pFile;                 // pointer to resource file
 
-    coreString m_sName;                    // identifier of this resource handle
+    coreInternString m_sName;              // identifier of this resource handle (interned, 0 = unnamed)
     coreBool   m_bAutomatic : 1;           // updated automatically by the resource manager
     coreBool   m_bPersist   : 1;           // loaded on startup and kept in memory
     coreBool   m_bProxy     : 1;           // resource proxy without own resource
     coreBool   m_bUnload    : 1;           // check if resource needs to be unloaded
 
+    mutable coreAtomic<coreResourcePriority> m_ePriority;   // loading priority (only raised automatically)
+    coreBool                                 m_bPrepared;   // resource data already prepared (waiting for finalization)
+
     coreResourceIndex m_iIndex;            // unique resource index
 
     coreLock               m_UpdateLock;   // lock to prevent concurrent resource loading
@@ -112,7 +126,7 @@ private:
 
 
 private:
-    coreResourceHandle(coreResource* pResource, coreFile* pFile, const coreChar* pcName, const coreBool bAutomatic, const coreBool bPersist)noexcept;
+    coreResourceHandle(coreResource* pResource, coreFile* pFile, const coreInternString& sName, const coreBool bAutomatic, const coreBool bPersist)noexcept;
     ~coreResourceHandle();
 
 
@@ -129,13 +143,17 @@ public:
     inline coreBool      IsLoading     ()const {return (!this->IsLoaded() && m_iRefCount);}
 
     /* control the reference-counter */
-    inline void RefIncrease() {m_iRefCount.FetchAdd(1u); ASSERT(m_iRefCount)}
+    inline void RefIncrease() {m_iRefCount.FetchAdd(1u); ASSERT(m_iRefCount) this->RaisePriority(CORE_RESOURCE_PRIORITY_SOON);}
     inline void RefDecrease() {ASSERT(m_iRefCount) if(!m_iRefCount.SubFetch(1u)) m_bUnload = true;}
 
     /* handle resource loading */
-    inline coreBool Update () {if(!m_bProxy) {const coreLocker oLocker(&m_UpdateLock); if(this->IsLoading() && !m_bAutomatic)      {m_eStatus = m_pResource->Load(m_pFile);                      return true;}} return false;}
-    inline coreBool Reload () {if(!m_bProxy) {const coreLocker oLocker(&m_UpdateLock); m_pResource->Unload(); if(this->IsLoaded()) {m_eStatus = m_pResource->Load(m_pFile);                      return true;}} return false;}
-    inline coreBool Nullify() {if(!m_bProxy) {const coreLocker oLocker(&m_UpdateLock); m_pResource->Unload(); if(this->IsLoaded()) {m_eStatus = (m_pFile || m_bAutomatic) ? CORE_BUSY : CORE_OK; return true;}} return false;}
+    inline coreBool Update () {if(!m_bProxy) {const coreLocker oLocker(&m_UpdateLock); if(this->IsLoading() && !m_bAutomatic)                           {m_eStatus = m_pResource->Load(m_pFile);                      return true;}} return false;}
+    inline coreBool Reload () {if(!m_bProxy) {const coreLocker oLocker(&m_UpdateLock); m_pResource->Unload(); m_bPrepared = false; if(this->IsLoaded()) {m_eStatus = m_pResource->Load(m_pFile);                      return true;}} return false;}
+    inline coreBool Nullify() {if(!m_bProxy) {const coreLocker oLocker(&m_UpdateLock); m_pResource->Unload(); m_bPrepared = false; if(this->IsLoaded()) {m_eStatus = (m_pFile || m_bAutomatic) ? CORE_BUSY : CORE_OK; return true;}} return false;}
+
+    /* set loading priority */
+    inline void SetPriority  (const coreResourcePriority ePriority)     {ASSERT(ePriority < CORE_RESOURCE_PRIORITY_MAX) m_ePriority = ePriority;}
+    inline void RaisePriority(const coreResourcePriority ePriority)const {ASSERT(ePriority < CORE_RESOURCE_PRIORITY_MAX) m_ePriority.FetchMin(ePriority);}
 
     /* lock direct resource object access */
     template <typename F> inline void LockResource(F&& nFunction) {const coreLocker oLocker(&m_UpdateLock); nFunction(d_cast<typename TRAIT_ARG_TYPE(F, 0u)>(m_pResource));}   // [](coreResource* OUTPUT pResource) -> void
@@ -144,16 +162,19 @@ public:
     template <typename F> coreUint32 OnLoadedOnce(F&& nFunction, const coreUint32 iDependency = 0u)const;   // [](void) -> void
 
     /* get object properties */
-    inline const coreChar*          GetName    ()const {return m_sName.c_str();}
-    inline const coreResourceIndex& GetIndex   ()const {return m_iIndex;}
-    inline       coreStatus         GetStatus  ()const {return m_eStatus;}
-    inline       coreUint16         GetRefCount()const {return m_iRefCount;}
+    inline const coreChar*            GetName    ()const {return m_sName.GetString();}
+    inline const coreResourceIndex&   GetIndex   ()const {return m_iIndex;}
+    inline       coreStatus           GetStatus  ()const {return m_eStatus;}
+    inline       coreUint16           GetRefCount()const {return m_iRefCount;}
+    inline       coreResourcePriority GetPriority()const {return m_ePriority.Get();}
 
 
 private:
-    /* handle automatic resource loading */
+    /* handle automatic resource loading (# update-lock is always released on the same thread) */
     inline coreBool __CanAutoUpdate() {if(m_UpdateLock.TryLock()) {if(this->IsLoading() && m_bAutomatic) return true; m_UpdateLock.Unlock();} return false;}
-    inline void     __AutoUpdate   () {m_eStatus = m_pResource->Load(m_pFile); m_UpdateLock.Unlock();}
+    inline void     __AutoUpdate   () {m_eStatus = m_pResource->Load(m_pFile); if(this->IsLoaded()) m_bPrepared = false; m_UpdateLock.Unlock();}
+    inline coreBool __AutoPrepare  () {const coreStatus eStatus = m_pResource->Prepare(m_pFile); if(eStatus == CORE_OK) m_bPrepared = true; else if(eStatus != CORE_BUSY) m_eStatus = eStatus; m_UpdateLock.Unlock(); return (eStatus == CORE_OK);}
+    inline void     __AutoCancel   () {m_UpdateLock.Unlock();}
 };
 
 
@@ -184,7 +205,7 @@ private:
 class coreResourceManager final : public coreThread
 {
 private:
-    coreMapStr<coreResourceHandle*> m_apHandle;                            // resource handles
+    coreHashMap<coreUint32, coreResourceHandle*> m_apHandle;               // resource handles (keyed by interned name)
 
     coreMapStr<coreArchive*> m_apArchive;                                  // archives with resource files
     coreMapStr<coreFile*>    m_apDirectFile;                               // direct resource files
@@ -193,12 +214,21 @@ private:
 
     coreSet<coreResourceRelation*> m_apRelation;                           // objects to reset with the resource manager
 
+    coreReadQueue m_ReadQueue;                                             // asynchronous file reads of dispatched resource handles (keeps the disk busy while job workers are occupied)
+
+    coreList<coreResourceIndex> m_aiFinish;                                // prepared resource handles waiting for finalization (on OpenGL context)
+    coreUintW                   m_iFinishNext;                             // next resource handle to finalize
+    coreAtomic<coreUint32>      m_iFinishNum;                              // number of resource handles waiting for finalization (for the fast check without lock)
+    coreAtomic<coreUint32>      m_iJobNum;                                 // number of queued or running loading jobs (to hold back background resources)
+    coreLock                    m_FinishLock;                              // lock to prevent concurrent finalization list access
+
     coreLock m_ResourceLock;                                               // lock to prevent invalid resource handle access
     coreLock m_FileLock;                                                   // lock to prevent invalid resource file access
     coreBool m_bActive;                                                    // current management status
 
     static coreResourceHandle* s_apHandleTable  [CORE_RESOURCE_INDICES];   // resource handle index table
     static coreResource*       s_apResourceTable[CORE_RESOURCE_INDICES];   // resource object index table (to remove one indirection)
+    static coreJob*            s_apJobTable     [CORE_RESOURCE_INDICES];   // loading job index table (reused for each resource index)
     static coreResourceIndex   s_iTableStart;                              // next index table entry to check
 
 
@@ -227,7 +257,9 @@ public:
     template <typename T>                                void                Free        (coreResourcePtr<T>* OUTPUT pptResourcePtr);
 
     /* get existing resource handle */
-    inline coreResourceHandle* Get(const coreHashString& sName)const {if(!sName) return NULL; WARN_IF(!m_apHandle.count_bs(sName)) return NULL; return m_apHandle.at_bs(sName);}
+    inline coreResourceHandle* Get(const coreInternString& sName) const {return sName.GetID() ? this->__Get(sName.GetID())                 : NULL;}
+    inline coreResourceHandle* Get(const coreHashString&   sName) const {return sName         ? this->__Get(coreStringTable::Find(sName)) : NULL;}
+    inline coreResourceHandle* Get(const coreChar*         pcName)const {return this->Get(coreHashString(pcName));}
 
     /* retrieve archives and resource files */
     coreArchive* RetrieveArchive(const coreHashString& sPath);
@@ -270,6 +302,17 @@ private:
     /* load all relevant default resources */
     void __LoadDefault();
 
+    /* get existing resource handle by interned name */
+    inline coreResourceHandle* __Get(const coreUint32 iID)const {WARN_IF(!m_apHandle.count(iID)) return NULL; return m_apHandle.at(iID);}
+
+    /* handle parallel resource loading (as jobs on the job manager) */
+    void                __DispatchWork (coreResourceHandle* pHandle);
+    void                __ProcessWork  (const coreResourceIndex iIndex);
+    void                __WaitWork     (const coreResourceHandle* pHandle);
+    void                __WaitAllWork  ();
+    coreResourceHandle* __FetchFinished();
+    inline coreBool     __IsParallel   ()const {return (Core::Manager::Job->GetNumWorkers() != 0u);}
+
     /* bind and unbind relation-objects */
     inline void __BindRelation  (coreResourceRelation* pRelation) {ASSERT(!m_apRelation.count_bs(pRelation)) m_apRelation.insert_bs(pRelation);}
     inline void __UnbindRelation(coreResourceRelation* pRelation) {ASSERT( m_apRelation.count_bs(pRelation)) m_apRelation.erase_bs (pRelation);}
@@ -329,6 +372,9 @@ template <typename F> coreUint32 coreResourceHandle::OnLoadedOnce(F&& nFunction,
     }
     else
     {
+        // load as soon as possible (something is waiting for it)
+        this->RaisePriority(CORE_RESOURCE_PRIORITY_NOW);
+
         // attach wrapper to the resource thread
         return Core::Manager::Resource->AttachFunction([this, nFunction = std::forward<F>(nFunction)]()
         {
@@ -355,15 +401,16 @@ template <typename F> coreUint32 coreResourceHandle::OnLoadedOnce(F&& nFunction,
 template <typename T, typename... A> coreResourceHandle* coreResourceManager::Load(const coreHashString& sName, const coreResourceUpdate eUpdate, const coreHashString& sPath, A&&... vArgs)
 {
     // check for existing resource handle
-    if(m_apHandle.count_bs(sName)) return m_apHandle.at_bs(sName);
+    const coreInternString sIntern = sName;
+    if(m_apHandle.count(sIntern.GetID())) return m_apHandle.at(sIntern.GetID());
 
     // create new resource handle
-    coreResourceHandle* pNewHandle = MANAGED_NEW(coreResourceHandle, std::is_same_v<T, coreResourceDummy> ? NULL : new T(std::forward<A>(vArgs)...), sPath ? this->RetrieveFile(sPath) : NULL, sName.GetString(), (eUpdate != CORE_RESOURCE_UPDATE_MANUAL), (eUpdate == CORE_RESOURCE_UPDATE_PERSIST));
+    coreResourceHandle* pNewHandle = MANAGED_NEW(coreResourceHandle, std::is_same_v<T, coreResourceDummy> ? NULL : new T(std::forward<A>(vArgs)...), sPath ? this->RetrieveFile(sPath) : NULL, sIntern, (eUpdate != CORE_RESOURCE_UPDATE_MANUAL), (eUpdate == CORE_RESOURCE_UPDATE_PERSIST));
 
     m_ResourceLock.Lock();
     {
         // add resource handle to manager
-        m_apHandle.emplace_bs(sName, pNewHandle);
+        m_apHandle.emplace(sIntern.GetID(), pNewHandle);
     }
     m_ResourceLock.Unlock();
 
@@ -373,16 +420,17 @@ template <typename T, typename... A> coreResourceHandle* coreResourceManager::Lo
 template <typename T, typename... A> RETURN_RESTRICT coreResourceHandle* coreResourceManager::LoadNew(A&&... vArgs)const
 {
     // create unique unmanaged resource handle
-    return MANAGED_NEW(coreResourceHandle, std::is_same_v<T, coreResourceDummy> ? NULL : new T(std::forward<A>(vArgs)...), NULL, "", false, false);
+    return MANAGED_NEW(coreResourceHandle, std::is_same_v<T, coreResourceDummy> ? NULL : new T(std::forward<A>(vArgs)...), NULL, coreInternString(), false, false);
 }
 
 inline coreResourceHandle* coreResourceManager::LoadProxy(const coreHashString& sName)
 {
     // check for existing resource proxy
-    if(m_apHandle.count_bs(sName))
+    const coreUint32 iID = coreStringTable::Find(sName);
+    if(m_apHandle.count(iID))
     {
-        ASSERT(m_apProxy.count(m_apHandle.at_bs(sName)))
-        return m_apHandle.at_bs(sName);
+        ASSERT(m_apProxy.count(m_apHandle.at(iID)))
+        return m_apHandle.at(iID);
     }
 
     // create new resource proxy without own resource
@@ -422,12 +470,12 @@ template <typename T> void coreResourceManager::Free(coreResourcePtr<T>* OUTPUT
     coreResourceHandle* pHandle = pptResourcePtr->GetHandle();
     if(pHandle)
     {
-        if(!pHandle->m_sName.empty())
+        if(pHandle->m_sName.GetID())
         {
             m_ResourceLock.Lock();
             {
                 // remove resource handle from manager
-                m_apHandle.erase_bs(pHandle->m_sName.c_str());
+                m_apHandle.erase(pHandle->m_sName.GetID());
             }
             m_ResourceLock.Unlock();
         }
@@ -440,6 +488,7 @@ template <typename T> void coreResourceManager::Free(coreResourcePtr<T>* OUTPUT
         }
 
         // wait on possible resource loading
+        this->__WaitWork(pHandle);
         while(pHandle->m_UpdateLock.IsLocked()) CORE_LOCK_YIELD   // # locked again in destructor
 
         // delete resource handle
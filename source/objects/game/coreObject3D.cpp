@@ -17,54 +17,71 @@ coreObject3D::coreObject3D()noexcept
 , m_vSize              (coreVector3(1.0f,1.0f,1.0f))
 , m_vDirection         (coreVector3(0.0f,1.0f,0.0f))
 , m_vOrientation       (coreVector3(0.0f,0.0f,1.0f))
+, m_vRotation          (coreVector4::QuatIdentity())
+, m_pStore             (NULL)
+, m_iStoreSlot         (0u)
 , m_pModel             (NULL)
 , m_pVolume            (NULL)
-, m_vRotation          (coreVector4::QuatIdentity())
 , m_vCollisionModifier (coreVector3(1.0f,1.0f,1.0f))
 , m_vCollisionRange    (coreVector3(0.0f,0.0f,0.0f))
 , m_fCollisionRadius   (0.0f)
 , m_vVisualRange       (coreVector3(0.0f,0.0f,0.0f))
 , m_fVisualRadius      (0.0f)
 , m_iType              (0)
+, m_iIndex             (0u)
 {
 }
 
 coreObject3D::coreObject3D(const coreObject3D& c)noexcept
 : coreObject           (c)
-, m_vPosition          (c.m_vPosition)
-, m_vSize              (c.m_vSize)
+, m_vPosition          (c.GetPosition())
+, m_vSize              (c.GetSize())
 , m_vDirection         (c.m_vDirection)
 , m_vOrientation       (c.m_vOrientation)
+, m_vRotation          (c.GetRotation())
+, m_pStore             (NULL)
+, m_iStoreSlot         (0u)
 , m_pModel             (c.m_pModel)
 , m_pVolume            (c.m_pVolume)
-, m_vRotation          (c.m_vRotation)
 , m_vCollisionModifier (c.m_vCollisionModifier)
 , m_vCollisionRange    (c.m_vCollisionRange)
 , m_fCollisionRadius   (c.m_fCollisionRadius)
 , m_vVisualRange       (c.m_vVisualRange)
 , m_fVisualRadius      (c.m_fVisualRadius)
 , m_iType              (0)
+, m_iIndex             (0u)
 {
+    // keep own color-value (store slots are never shared)
+    m_pvColorStore = NULL;
+    m_vColor       = c.GetColor4();
+
     // bind to object manager
     this->ChangeType(c.m_iType);
 }
 
 coreObject3D::coreObject3D(coreObject3D&& m)noexcept
 : coreObject           (std::move(m))
-, m_vPosition          (m.m_vPosition)
-, m_vSize              (m.m_vSize)
+, m_vPosition          (m.GetPosition())
+, m_vSize              (m.GetSize())
 , m_vDirection         (m.m_vDirection)
 , m_vOrientation       (m.m_vOrientation)
+, m_vRotation          (m.GetRotation())
+, m_pStore             (NULL)
+, m_iStoreSlot         (0u)
 , m_pModel             (std::move(m.m_pModel))
 , m_pVolume            (std::move(m.m_pVolume))
-, m_vRotation          (m.m_vRotation)
 , m_vCollisionModifier (m.m_vCollisionModifier)
 , m_vCollisionRange    (m.m_vCollisionRange)
 , m_fCollisionRadius   (m.m_fCollisionRadius)
 , m_vVisualRange       (m.m_vVisualRange)
 , m_fVisualRadius      (m.m_fVisualRadius)
 , m_iType              (0)
+, m_iIndex             (0u)
 {
+    // keep own color-value (store slots are never shared)
+    m_pvColorStore = NULL;
+    m_vColor       = m.GetColor4();
+
     // bind to object manager
     this->ChangeType(m.m_iType);
 }
@@ -74,6 +91,9 @@ coreObject3D::coreObject3D(coreObject3D&& m)noexcept
 /* destructor */
 coreObject3D::~coreObject3D()
 {
+    // remove from transform store
+    if(m_pStore) m_pStore->Remove(this);
+
     // unbind from object manager
     this->ChangeType(0);
 }
@@ -86,15 +106,18 @@ coreObject3D& coreObject3D::operator = (const coreObject3D& c)noexcept
     // bind to object manager
     this->ChangeType(c.m_iType);
 
-    // copy properties
+    // copy properties (keep own store slot)
+    coreVector4* pvColorStore = m_pvColorStore;
     this->coreObject::operator = (c);
-    m_vPosition          = c.m_vPosition;
-    m_vSize              = c.m_vSize;
+    m_pvColorStore       = pvColorStore;
+    this->__Color()      = c.GetColor4();
+    this->__Position()   = c.GetPosition();
+    this->__Size()       = c.GetSize();
     m_vDirection         = c.m_vDirection;
     m_vOrientation       = c.m_vOrientation;
+    this->__Rotation()   = c.GetRotation();
     m_pModel             = c.m_pModel;
     m_pVolume            = c.m_pVolume;
-    m_vRotation          = c.m_vRotation;
     m_vCollisionModifier = c.m_vCollisionModifier;
     m_vCollisionRange    = c.m_vCollisionRange;
     m_fCollisionRadius   = c.m_fCollisionRadius;
@@ -109,15 +132,18 @@ coreObject3D& coreObject3D::operator = (coreObject3D&& m)noexcept
     // bind to object manager
     this->ChangeType(m.m_iType);
 
-    // move properties
+    // move properties (keep own store slot)
+    coreVector4* pvColorStore = m_pvColorStore;
     this->coreObject::operator = (std::move(m));
-    m_vPosition          = m.m_vPosition;
-    m_vSize              = m.m_vSize;
+    m_pvColorStore       = pvColorStore;
+    this->__Color()      = m.GetColor4();
+    this->__Position()   = m.GetPosition();
+    this->__Size()       = m.GetSize();
     m_vDirection         = m.m_vDirection;
     m_vOrientation       = m.m_vOrientation;
+    this->__Rotation()   = m.GetRotation();
     m_pModel             = std::move(m.m_pModel);
     m_pVolume            = std::move(m.m_pVolume);
-    m_vRotation          = m.m_vRotation;
     m_vCollisionModifier = m.m_vCollisionModifier;
     m_vCollisionRange    = m.m_vCollisionRange;
     m_fCollisionRadius   = m.m_fCollisionRadius;
@@ -157,10 +183,10 @@ coreBool coreObject3D::Prepare(const coreProgramPtr& pProgram)
 
     // update all object uniforms
     coreProgram* pLocal = pProgram.GetResource();
-    pLocal->SendUniform(CORE_SHADER_UNIFORM_3D_POSITION, m_vPosition);
-    pLocal->SendUniform(CORE_SHADER_UNIFORM_3D_SIZE,     m_vSize);
-    pLocal->SendUniform(CORE_SHADER_UNIFORM_3D_ROTATION, m_vRotation);
-    pLocal->SendUniform(CORE_SHADER_UNIFORM_COLOR,       m_vColor);
+    pLocal->SendUniform(CORE_SHADER_UNIFORM_3D_POSITION, this->__Position());
+    pLocal->SendUniform(CORE_SHADER_UNIFORM_3D_SIZE,     this->__Size());
+    pLocal->SendUniform(CORE_SHADER_UNIFORM_3D_ROTATION, this->__Rotation());
+    pLocal->SendUniform(CORE_SHADER_UNIFORM_COLOR,       this->__Color());
     pLocal->SendUniform(CORE_SHADER_UNIFORM_TEXPARAM,    coreVector4(m_vTexSize, m_vTexOffset));
     ASSERT(pLocal->RetrieveUniform(CORE_SHADER_UNIFORM_3D_POSITION) >= 0)
 
@@ -210,7 +236,7 @@ void coreObject3D::Move()
         if(HAS_FLAG(m_eUpdate, CORE_OBJECT_UPDATE_TRANSFORM))
         {
             // update rotation quaternion
-            m_vRotation = coreMatrix4::Orientation(m_vDirection, m_vOrientation).m123().ToQuat();
+            this->__Rotation() = coreMatrix4::Orientation(m_vDirection, m_vOrientation).m123().ToQuat();
 
             // reset the update status
             REMOVE_FLAG(m_eUpdate, CORE_OBJECT_UPDATE_TRANSFORM)
@@ -222,7 +248,7 @@ void coreObject3D::Move()
             if(pVolume.IsUsable())
             {
                 // calculate extent and correction
-                const coreVector3 vExtent     = m_vSize * m_vCollisionModifier;
+                const coreVector3 vExtent     = this->__Size() * m_vCollisionModifier;
                 const coreVector3 vCorrection = pVolume->GetBoundingRange() / MAX(pVolume->GetBoundingRange().Max(), CORE_MATH_PRECISION);
 
                 // update collision range and radius
@@ -242,8 +268,8 @@ void coreObject3D::Move()
                 const coreVector3 vCorrection = m_pModel->GetBoundingRange() / MAX(m_pModel->GetBoundingRange().Max(), CORE_MATH_PRECISION);
 
                 // update visual range and radius
-                m_vVisualRange  = m_pModel->GetBoundingRange () * (m_vSize);
-                m_fVisualRadius = m_pModel->GetBoundingRadius() * (m_vSize * vCorrection).Max();
+                m_vVisualRange  = m_pModel->GetBoundingRange () * (this->__Size());
+                m_fVisualRadius = m_pModel->GetBoundingRadius() * (this->__Size() * vCorrection).Max();
 
                 // reset the update status
                 REMOVE_FLAG(m_eUpdate, CORE_OBJECT_UPDATE_VISUAL)
@@ -266,6 +292,138 @@ void coreObject3D::ChangeType(const coreInt32 iType)
 }
 
 
+// ****************************************************************
+/* constructor */
+coreTransformStore::coreTransformStore()noexcept
+: m_avPosition {}
+, m_avSize     {}
+, m_avRotation {}
+, m_avColor    {}
+, m_apObject   {}
+{
+}
+
+
+// ****************************************************************
+/* destructor */
+coreTransformStore::~coreTransformStore()
+{
+    // move properties back into all 3d-objects
+    this->Clear();
+}
+
+
+// ****************************************************************
+/* insert 3d-object */
+void coreTransformStore::Insert(coreObject3D* pObject)
+{
+    ASSERT(pObject)
+
+    // keep 3d-objects in their first store
+    if(pObject->m_pStore) return;
+
+    const coreVector4* pvOldColor = m_avColor.data();
+
+    // move properties into a new slot
+    m_avPosition.push_back(pObject->m_vPosition);
+    m_avSize    .push_back(pObject->m_vSize);
+    m_avRotation.push_back(pObject->m_vRotation);
+    m_avColor   .push_back(pObject->m_vColor);
+    m_apObject  .push_back(pObject);
+
+    // redirect all properties
+    pObject->m_pStore     = this;
+    pObject->m_iStoreSlot = m_apObject.size() - 1u;
+
+    // point color-values into the store (all of them after reallocation)
+    if(m_avColor.data() == pvOldColor) this->__LinkColors(pObject->m_iStoreSlot, pObject->m_iStoreSlot + 1u);
+                                  else this->__LinkColors(0u, m_apObject.size());
+}
+
+
+// ****************************************************************
+/* remove 3d-object */
+void coreTransformStore::Remove(coreObject3D* pObject)
+{
+    ASSERT(pObject)
+
+    // ignore 3d-objects from other stores
+    if(pObject->m_pStore != this) return;
+
+    const coreUint32 iSlot = pObject->m_iStoreSlot;
+    const coreUint32 iLast = m_apObject.size() - 1u;
+    ASSERT(m_apObject[iSlot] == pObject)
+
+    // move properties back into the 3d-object
+    pObject->m_vPosition    = m_avPosition[iSlot];
+    pObject->m_vSize        = m_avSize    [iSlot];
+    pObject->m_vRotation    = m_avRotation[iSlot];
+    pObject->m_vColor       = m_avColor   [iSlot];
+    pObject->m_pStore       = NULL;
+    pObject->m_pvColorStore = NULL;
+
+    if(iSlot != iLast)
+    {
+        // fill the gap with the last slot (keep all arrays dense)
+        m_avPosition[iSlot] = m_avPosition[iLast];
+        m_avSize    [iSlot] = m_avSize    [iLast];
+        m_avRotation[iSlot] = m_avRotation[iLast];
+        m_avColor   [iSlot] = m_avColor   [iLast];
+        m_apObject  [iSlot] = m_apObject  [iLast];
+
+        // redirect the moved 3d-object
+        m_apObject[iSlot]->m_iStoreSlot = iSlot;
+        this->__LinkColors(iSlot, iSlot + 1u);
+    }
+
+    // remove last slot
+    m_avPosition.pop_back();
+    m_avSize    .pop_back();
+    m_avRotation.pop_back();
+    m_avColor   .pop_back();
+    m_apObject  .pop_back();
+}
+
+
+// ****************************************************************
+/* remove all 3d-objects */
+void coreTransformStore::Clear()
+{
+    // move properties back into all 3d-objects
+    for(coreUintW i = 0u, ie = m_apObject.size(); i < ie; ++i)
+    {
+        coreObject3D* pObject = m_apObject[i];
+
+        pObject->m_vPosition    = m_avPosition[i];
+        pObject->m_vSize        = m_avSize    [i];
+        pObject->m_vRotation    = m_avRotation[i];
+        pObject->m_vColor       = m_avColor   [i];
+        pObject->m_pStore       = NULL;
+        pObject->m_pvColorStore = NULL;
+    }
+
+    // clear memory
+    m_avPosition.clear();
+    m_avSize    .clear();
+    m_avRotation.clear();
+    m_avColor   .clear();
+    m_apObject  .clear();
+}
+
+
+// ****************************************************************
+/* point color-values of stored 3d-objects into the store */
+void coreTransformStore::__LinkColors(const coreUintW iFrom, const coreUintW iTo)
+{
+    ASSERT((iFrom <= iTo) && (iTo <= m_apObject.size()))
+
+    for(coreUintW i = iFrom; i < iTo; ++i)
+    {
+        m_apObject[i]->m_pvColorStore = &m_avColor[i];
+    }
+}
+
+
 // ****************************************************************
 /* constructor */
 coreBatchList::coreBatchList(const coreUint32 iStartCapacity)noexcept
@@ -282,6 +440,10 @@ coreBatchList::coreBatchList(const coreUint32 iStartCapacity)noexcept
 , m_nUpdateDataFunc    (NULL)
 , m_nUpdateShaderFunc  (NULL)
 , m_iCustomSize        (0u)
+, m_pTransformStore    (NULL)
+, m_apRender           {}
+, m_apVisible          {}
+, m_bCulling           (false)
 , m_iFilled            (0u)
 , m_eUpdate            (CORE_BATCHLIST_UPDATE_NOTHING)
 {
@@ -300,9 +462,10 @@ coreBatchList::~coreBatchList()
     // delete vertex array objects and instance data buffers
     this->__Reset(CORE_RESOURCE_RESET_EXIT);
 
-    // free buffer memory
+    // free buffer memory (and move properties back into all 3d-objects)
     SAFE_DELETE(m_paInstanceBuffer)
     SAFE_DELETE(m_paCustomBuffer)
+    SAFE_DELETE(m_pTransformStore)
 }
 
 
@@ -322,8 +485,37 @@ void coreBatchList::Render(const coreProgramPtr& pProgramInstanced, const corePr
     if(m_apObjectList.empty()) return;
 
     // re-determine render-count (may have changed between move and render)
-    const coreUint32 iRenderCount = std::count_if(m_apObjectList.begin(), m_apObjectList.end(), [](const coreObject3D* pObject) {return pObject->IsEnabled(CORE_OBJECT_ENABLE_RENDER);});
-    if(!iRenderCount) return;
+    const coreUint32 iEnabledCount = std::count_if(m_apObjectList.begin(), m_apObjectList.end(), [](const coreObject3D* pObject) {return pObject->IsEnabled(CORE_OBJECT_ENABLE_RENDER);});
+    if(!iEnabledCount) return;
+
+    coreUint32 iRenderCount = iEnabledCount;
+    m_apRender.clear();
+
+    if(this->IsInstanced())
+    {
+        if(m_bCulling)
+        {
+            // cull all instances against the current view frustum
+            iRenderCount = this->__CullInstances();
+
+            // update debug counters
+            Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_CULLED, iEnabledCount - iRenderCount);
+
+            if(!iRenderCount) return;
+
+            // repack only if the visible set has changed (objects themselves are tracked by move)
+            if(m_apRender != m_apVisible)
+            {
+                m_apVisible.assign(m_apRender.begin(), m_apRender.end());
+                ADD_FLAG(m_eUpdate, CORE_BATCHLIST_UPDATE_ALL)
+            }
+        }
+        else if((iEnabledCount >= CORE_BATCHLIST_PARALLEL_THRESHOLD) && HAS_FLAG(m_eUpdate, CORE_BATCHLIST_UPDATE_INSTANCE))
+        {
+            // collect all instances for parallel packing
+            this->__GatherInstances();
+        }
+    }
 
     // adjust buffer capacity (with additional space)
     if(iRenderCount > m_iNumInstances) this->Reallocate(MIN(iRenderCount + iRenderCount / 10u + 1u, m_apObjectList.capacity()));
@@ -423,12 +615,28 @@ void coreBatchList::MoveSort()
 }
 
 
+// ****************************************************************
+/* control frustum culling */
+void coreBatchList::SetCulling(const coreBool bCulling)
+{
+    if(bCulling == m_bCulling) return;
+
+    // save culling status
+    m_bCulling = bCulling;
+    m_apVisible.clear();
+
+    // set the update status
+    m_eUpdate = CORE_BATCHLIST_UPDATE_ALL;
+}
+
+
 // ****************************************************************
 /* bind 3d-object */
 void coreBatchList::BindObject(coreObject3D* pObject)
 {
     // add object to list
     m_apObjectList.insert(pObject);
+    if(m_pTransformStore) m_pTransformStore->Insert(pObject);
 
     // set the update status
     m_eUpdate = CORE_BATCHLIST_UPDATE_ALL;
@@ -438,6 +646,7 @@ void coreBatchList::BindObjectUnsafe(coreObject3D* pObject)
 {
     // add object to list (without reallocation check)
     m_apObjectList.insert_unsafe(pObject);
+    if(m_pTransformStore) m_pTransformStore->Insert(pObject);
 
     // set the update status
     m_eUpdate = CORE_BATCHLIST_UPDATE_ALL;
@@ -450,6 +659,7 @@ void coreBatchList::UnbindObject(coreObject3D* pObject)
 {
     // remove object from list
     m_apObjectList.erase(pObject);
+    if(m_pTransformStore) m_pTransformStore->Remove(pObject);
 
     // set the update status
     m_eUpdate = CORE_BATCHLIST_UPDATE_ALL;
@@ -462,6 +672,27 @@ void coreBatchList::Clear()
 {
     // just clear memory
     m_apObjectList.clear();
+    if(m_pTransformStore) m_pTransformStore->Clear();
+}
+
+
+// ****************************************************************
+/* control transform store */
+void coreBatchList::SetTransformStore(const coreBool bStore)
+{
+    if(bStore == (m_pTransformStore != NULL)) return;
+
+    if(bStore)
+    {
+        // create transform store and move all bound objects into it
+        m_pTransformStore = new coreTransformStore();
+        FOR_EACH(it, m_apObjectList) m_pTransformStore->Insert(*it);
+    }
+    else
+    {
+        // move properties back into all objects
+        SAFE_DELETE(m_pTransformStore)
+    }
 }
 
 
@@ -624,44 +855,18 @@ void coreBatchList::__RenderDefault(const coreProgramPtr& pProgramInstanced, con
             m_aiVertexArray    .next();
             m_paInstanceBuffer->next();
 
-            if(CORE_GL_SUPPORT(ARB_half_float_vertex))
-            {
-                // map required area of the instance data buffer
-                coreByte* pRange  = m_paInstanceBuffer->current().MapWrite(0u, iRenderCount * CORE_BATCHLIST_INSTANCE_SIZE_HIGH, CORE_DATABUFFER_MAP_INVALIDATE_ALL);
-                coreByte* pCursor = pRange;
-
-                FOR_EACH(it, m_apObjectList)
-                {
-                    const coreObject3D* pObject = (*it);
-
-                    // render only enabled objects
-                    if(pObject->IsEnabled(CORE_OBJECT_ENABLE_RENDER))
-                    {
-                        // compress data
-                        const coreVector3 vPosition  = pObject->GetPosition();
-                        const coreUint64  iSize      = coreVector4(pObject->GetSize(), 0.0f)                      .PackFloat4x16();
-                        const coreUint64  iRotation  = pObject->GetRotation()                                     .PackSnorm4x16();
-                        const coreUint32  iColor     = pObject->GetColor4  ()                                     .PackUnorm4x8 ();
-                        const coreUint64  iTexParams = coreVector4(pObject->GetTexSize(), pObject->GetTexOffset()).PackFloat4x16();
-                        ASSERT((pObject->GetColor4   ().Min() >=  0.0f) && (pObject->GetColor4   ().Max() <= 1.0f))
-                        ASSERT((pObject->GetTexOffset().Min() >= -4.0f) && (pObject->GetTexOffset().Max() <= 4.0f))
-
-                        // write data to the buffer
-                        std::memcpy(pCursor,       &vPosition,  sizeof(coreVector3));
-                        std::memcpy(pCursor + 12u, &iSize,      sizeof(coreUint64));
-                        std::memcpy(pCursor + 20u, &iRotation,  sizeof(coreUint64));
-                        std::memcpy(pCursor + 28u, &iColor,     sizeof(coreUint32));
-                        std::memcpy(pCursor + 32u, &iTexParams, sizeof(coreUint64));
-                        pCursor += CORE_BATCHLIST_INSTANCE_SIZE_HIGH;
-                    }
-                }
+            // map required area of the instance data buffer
+            const coreBool  bHigh   = CORE_GL_SUPPORT(ARB_half_float_vertex);
+            const coreUintW iSize   = bHigh ? CORE_BATCHLIST_INSTANCE_SIZE_HIGH : CORE_BATCHLIST_INSTANCE_SIZE_LOW;
+            coreByte*       pRange  = m_paInstanceBuffer->current().MapWrite(0u, iRenderCount * iSize, CORE_DATABUFFER_MAP_INVALIDATE_ALL);
 
-                ASSERT(coreUint32(pCursor - pRange) == iRenderCount * CORE_BATCHLIST_INSTANCE_SIZE_HIGH)
+            if(!m_apRender.empty())
+            {
+                // pack data from the collected objects
+                this->__PackInstances(pRange, iRenderCount);
             }
             else
             {
-                // map required area of the instance data buffer
-                coreByte* pRange  = m_paInstanceBuffer->current().MapWrite(0u, iRenderCount * CORE_BATCHLIST_INSTANCE_SIZE_LOW, CORE_DATABUFFER_MAP_INVALIDATE_ALL);
                 coreByte* pCursor = pRange;
 
                 FOR_EACH(it, m_apObjectList)
@@ -671,26 +876,14 @@ void coreBatchList::__RenderDefault(const coreProgramPtr& pProgramInstanced, con
                     // render only enabled objects
                     if(pObject->IsEnabled(CORE_OBJECT_ENABLE_RENDER))
                     {
-                        // compress data
-                        const coreVector3 vPosition  = pObject->GetPosition();
-                        const coreVector3 vSize      = pObject->GetSize    ();
-                        const coreUint64  iRotation  = pObject->GetRotation().PackSnorm4x16();
-                        const coreUint32  iColor     = pObject->GetColor4  ().PackUnorm4x8 ();
-                        const coreVector4 vTexParams = coreVector4(pObject->GetTexSize(), pObject->GetTexOffset());
-                        ASSERT((pObject->GetColor4   ().Min() >=  0.0f) && (pObject->GetColor4   ().Max() <= 1.0f))
-                        ASSERT((pObject->GetTexOffset().Min() >= -4.0f) && (pObject->GetTexOffset().Max() <= 4.0f))
-
                         // write data to the buffer
-                        std::memcpy(pCursor,       &vPosition,  sizeof(coreVector3));
-                        std::memcpy(pCursor + 12u, &vSize,      sizeof(coreVector3));
-                        std::memcpy(pCursor + 24u, &iRotation,  sizeof(coreUint64));
-                        std::memcpy(pCursor + 32u, &iColor,     sizeof(coreUint32));
-                        std::memcpy(pCursor + 36u, &vTexParams, sizeof(coreVector4));
-                        pCursor += CORE_BATCHLIST_INSTANCE_SIZE_LOW;
+                        if(bHigh) coreBatchList::__WriteInstanceHigh(pCursor, pObject->GetPosition(), pObject->GetSize(), pObject->GetRotation(), pObject->GetColor4(), coreVector4(pObject->GetTexSize(), pObject->GetTexOffset()));
+                             else coreBatchList::__WriteInstanceLow (pCursor, pObject->GetPosition(), pObject->GetSize(), pObject->GetRotation(), pObject->GetColor4(), coreVector4(pObject->GetTexSize(), pObject->GetTexOffset()));
+                        pCursor += iSize;
                     }
                 }
 
-                ASSERT(coreUint32(pCursor - pRange) == iRenderCount * CORE_BATCHLIST_INSTANCE_SIZE_LOW)
+                ASSERT(coreUint32(pCursor - pRange) == iRenderCount * iSize)
             }
 
             // unmap buffer
@@ -773,18 +966,30 @@ void coreBatchList::__RenderCustom(const coreProgramPtr& pProgramInstanced, cons
             coreByte* pRange  = m_paCustomBuffer->current().MapWrite(0u, iRenderCount * m_iCustomSize, CORE_DATABUFFER_MAP_INVALIDATE_ALL);
             coreByte* pCursor = pRange;
 
-            FOR_EACH(it, m_apObjectList)
+            if(!m_apRender.empty())
             {
-                coreObject3D* pObject = (*it);
-
-                // render only enabled objects
-                if(pObject->IsEnabled(CORE_OBJECT_ENABLE_RENDER))
+                FOR_EACH(it, m_apRender)
                 {
-                    // write data to the buffer
-                    m_nUpdateDataFunc(pCursor, pObject);
+                    // write data to the buffer (in the same order as the instance data)
+                    m_nUpdateDataFunc(pCursor, (*it));
                     pCursor += m_iCustomSize;
                 }
             }
+            else
+            {
+                FOR_EACH(it, m_apObjectList)
+                {
+                    coreObject3D* pObject = (*it);
+
+                    // render only enabled objects
+                    if(pObject->IsEnabled(CORE_OBJECT_ENABLE_RENDER))
+                    {
+                        // write data to the buffer
+                        m_nUpdateDataFunc(pCursor, pObject);
+                        pCursor += m_iCustomSize;
+                    }
+                }
+            }
 
             ASSERT(coreUint32(pCursor - pRange) == iRenderCount * m_iCustomSize)
 
@@ -820,4 +1025,188 @@ void coreBatchList::__RenderCustom(const coreProgramPtr& pProgramInstanced, cons
             }
         }
     }
+}
+
+
+// ****************************************************************
+/* collect all render-enabled 3d-objects */
+void coreBatchList::__GatherInstances()
+{
+    ASSERT(m_apRender.empty())
+
+    m_apRender.reserve(m_iNumEnabled);
+
+    FOR_EACH(it, m_apObjectList)
+    {
+        coreObject3D* pObject = (*it);
+
+        // collect only enabled objects
+        if(pObject->IsEnabled(CORE_OBJECT_ENABLE_RENDER))
+            m_apRender.push_back(pObject);
+    }
+}
+
+
+// ****************************************************************
+/* collect all render-enabled 3d-objects inside the view frustum */
+coreUint32 coreBatchList::__CullInstances()
+{
+    ASSERT(m_apRender.empty())
+
+    // get current view frustum
+    coreVector4 avPlane[6];
+    Core::Graphics->CalcFrustum(avPlane);
+
+    alignas(ALIGNMENT_SIMD) coreFloat afX[4], afY[4], afZ[4], afR[4];
+    coreObject3D* apGroup[4];
+    coreUintW     iGroup = 0u;
+
+    // test bounding spheres of a group against all planes
+    const auto nTestFunc = [&]()
+    {
+        const coreLane vX = coreLaneLoad(afX);
+        const coreLane vY = coreLaneLoad(afY);
+        const coreLane vZ = coreLaneLoad(afZ);
+        const coreLane vR = coreLaneLoad(afR);
+
+        coreUint32 iOutside = 0u;
+        for(coreUintW j = 0u; j < 6u; ++j)
+        {
+            const coreLane vDist = coreLaneAdd(coreLaneAdd(coreLaneAdd(coreLaneMul(vX, coreLaneSet(avPlane[j].x)), coreLaneMul(vY, coreLaneSet(avPlane[j].y))), coreLaneAdd(coreLaneMul(vZ, coreLaneSet(avPlane[j].z)), coreLaneSet(avPlane[j].w))), vR);
+            iOutside |= coreLaneLessEqual(vDist, coreLaneSet(0.0f));
+        }
+
+        // remember all visible objects
+        for(coreUintW k = 0u; k < iGroup; ++k)
+        {
+            if(!HAS_BIT(iOutside, k)) m_apRender.push_back(apGroup[k]);
+        }
+
+        iGroup = 0u;
+    };
+
+    m_apRender.reserve(m_iNumEnabled);
+
+    FOR_EACH(it, m_apObjectList)
+    {
+        coreObject3D* pObject = (*it);
+
+        // cull only enabled objects
+        if(pObject->IsEnabled(CORE_OBJECT_ENABLE_RENDER))
+        {
+            const coreVector3 vPosition = pObject->GetPosition();
+
+            // gather next four objects
+            afX[iGroup] = vPosition.x;
+            afY[iGroup] = vPosition.y;
+            afZ[iGroup] = vPosition.z;
+            afR[iGroup] = pObject->GetVisualRadius();
+
+            apGroup[iGroup] = pObject;
+            if(++iGroup == 4u) nTestFunc();
+        }
+    }
+
+    if(iGroup)
+    {
+        // test remaining objects (repeat the last one)
+        for(coreUintW k = iGroup; k < 4u; ++k)
+        {
+            afX[k] = afX[iGroup - 1u];
+            afY[k] = afY[iGroup - 1u];
+            afZ[k] = afZ[iGroup - 1u];
+            afR[k] = afR[iGroup - 1u];
+        }
+        nTestFunc();
+    }
+
+    return m_apRender.size();
+}
+
+
+// ****************************************************************
+/* pack instance data from the collected 3d-objects */
+void coreBatchList::__PackInstances(coreByte* OUTPUT pOutput, const coreUint32 iRenderCount)const
+{
+    ASSERT(m_apRender.size() == iRenderCount)
+
+    // distribute chunks of instances over all threads (only for larger lists)
+    const coreUint32 iChunk = (iRenderCount >= CORE_BATCHLIST_PARALLEL_THRESHOLD) ? CORE_BATCHLIST_PARALLEL_CHUNK : iRenderCount;
+    Core::Manager::Job->ParallelFor(iRenderCount, MAX(iChunk, 1u), [&](const coreUintW iFrom, const coreUintW iTo)
+    {
+        this->__PackRange(pOutput, iFrom, iTo);
+    });
+}
+
+
+// ****************************************************************
+/* pack a range of instances from the collected 3d-objects */
+void coreBatchList::__PackRange(coreByte* OUTPUT pOutput, const coreUint32 iFrom, const coreUint32 iTo)const
+{
+    if(CORE_GL_SUPPORT(ARB_half_float_vertex))
+    {
+        coreByte* pCursor = pOutput + iFrom * CORE_BATCHLIST_INSTANCE_SIZE_HIGH;
+
+        for(coreUint32 i = iFrom; i < iTo; ++i)
+        {
+            const coreObject3D* pObject = m_apRender[i];
+
+            // write data to the buffer
+            coreBatchList::__WriteInstanceHigh(pCursor, pObject->GetPosition(), pObject->GetSize(), pObject->GetRotation(), pObject->GetColor4(), coreVector4(pObject->GetTexSize(), pObject->GetTexOffset()));
+            pCursor += CORE_BATCHLIST_INSTANCE_SIZE_HIGH;
+        }
+    }
+    else
+    {
+        coreByte* pCursor = pOutput + iFrom * CORE_BATCHLIST_INSTANCE_SIZE_LOW;
+
+        for(coreUint32 i = iFrom; i < iTo; ++i)
+        {
+            const coreObject3D* pObject = m_apRender[i];
+
+            // write data to the buffer
+            coreBatchList::__WriteInstanceLow(pCursor, pObject->GetPosition(), pObject->GetSize(), pObject->GetRotation(), pObject->GetColor4(), coreVector4(pObject->GetTexSize(), pObject->GetTexOffset()));
+            pCursor += CORE_BATCHLIST_INSTANCE_SIZE_LOW;
+        }
+    }
+}
+
+
+// ****************************************************************
+/* write compressed instance data (high quality) */
+void coreBatchList::__WriteInstanceHigh(coreByte* OUTPUT pCursor, const coreVector3 vPosition, const coreVector3 vSize, const coreVector4 vRotation, const coreVector4 vColor, const coreVector4 vTexParams)
+{
+    // compress data
+    const coreUint64 iSize      = coreVector4(vSize, 0.0f).PackFloat4x16();
+    const coreUint64 iRotation  = vRotation .PackSnorm4x16();
+    const coreUint32 iColor     = vColor    .PackUnorm4x8 ();
+    const coreUint64 iTexParams = vTexParams.PackFloat4x16();
+    ASSERT((vColor         .Min() >=  0.0f) && (vColor         .Max() <= 1.0f))
+    ASSERT((vTexParams.zw().Min() >= -4.0f) && (vTexParams.zw().Max() <= 4.0f))
+
+    // write data to the buffer
+    std::memcpy(pCursor,       &vPosition,  sizeof(coreVector3));
+    std::memcpy(pCursor + 12u, &iSize,      sizeof(coreUint64));
+    std::memcpy(pCursor + 20u, &iRotation,  sizeof(coreUint64));
+    std::memcpy(pCursor + 28u, &iColor,     sizeof(coreUint32));
+    std::memcpy(pCursor + 32u, &iTexParams, sizeof(coreUint64));
+}
+
+
+// ****************************************************************
+/* write compressed instance data (low quality) */
+void coreBatchList::__WriteInstanceLow(coreByte* OUTPUT pCursor, const coreVector3 vPosition, const coreVector3 vSize, const coreVector4 vRotation, const coreVector4 vColor, const coreVector4 vTexParams)
+{
+    // compress data
+    const coreUint64 iRotation = vRotation.PackSnorm4x16();
+    const coreUint32 iColor    = vColor   .PackUnorm4x8 ();
+    ASSERT((vColor         .Min() >=  0.0f) && (vColor         .Max() <= 1.0f))
+    ASSERT((vTexParams.zw().Min() >= -4.0f) && (vTexParams.zw().Max() <= 4.0f))
+
+    // write data to the buffer
+    std::memcpy(pCursor,       &vPosition,  sizeof(coreVector3));
+    std::memcpy(pCursor + 12u, &vSize,      sizeof(coreVector3));
+    std::memcpy(pCursor + 24u, &iRotation,  sizeof(coreUint64));
+    std::memcpy(pCursor + 32u, &iColor,     sizeof(coreUint32));
+    std::memcpy(pCursor + 36u, &vTexParams, sizeof(coreVector4));
 }
\ No newline at end of file
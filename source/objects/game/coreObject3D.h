@@ -24,6 +24,8 @@
 #define CORE_BATCHLIST_INSTANCE_SIZE_LOW  (52u)   // instancing per-object size (low quality)  (position (12), size (12), rotation (8), color (4), texture-parameters (16))
 #define CORE_BATCHLIST_INSTANCE_BUFFERS   (3u)    // number of concurrent instance data buffer
 #define CORE_BATCHLIST_INSTANCE_THRESHOLD (4u)    // minimum number of objects to draw instanced
+#define CORE_BATCHLIST_PARALLEL_CHUNK     (1024u) // number of instances packed by a single job
+#define CORE_BATCHLIST_PARALLEL_THRESHOLD (4096u) // minimum number of instances to pack in parallel
 
 enum coreBatchListUpdate : coreUint8
 {
@@ -35,23 +37,64 @@ enum coreBatchListUpdate : coreUint8
 ENABLE_BITWISE(coreBatchListUpdate)
 
 
+// ****************************************************************
+/* 3d-object transform store class (structure-of-arrays, owned by a batch list) */
+class coreTransformStore final
+{
+private:
+    coreList<coreVector3>   m_avPosition;   // positions of all stored 3d-objects
+    coreList<coreVector3>   m_avSize;       // size-factors of all stored 3d-objects
+    coreList<coreVector4>   m_avRotation;   // rotation quaternions of all stored 3d-objects
+    coreList<coreVector4>   m_avColor;      // RGBA color-values of all stored 3d-objects
+    coreList<coreObject3D*> m_apObject;     // owner of each slot
+
+
+public:
+    coreTransformStore()noexcept;
+    ~coreTransformStore();
+
+    DISABLE_COPY(coreTransformStore)
+    FRIEND_CLASS(coreObject3D)
+
+    /* insert and remove 3d-objects (moves their properties into or out of the store) */
+    void Insert(coreObject3D* pObject);
+    void Remove(coreObject3D* pObject);
+    void Clear ();
+
+    /* access dense property arrays directly (indexed by slot) */
+    inline const coreVector3*   GetPosition()const {return m_avPosition.data();}
+    inline const coreVector3*   GetSize    ()const {return m_avSize    .data();}
+    inline const coreVector4*   GetRotation()const {return m_avRotation.data();}
+    inline const coreVector4*   GetColor4  ()const {return m_avColor   .data();}
+    inline coreObject3D* const* GetObject  ()const {return m_apObject  .data();}
+    inline coreUint32           GetNumSlots()const {return m_apObject  .size();}
+
+
+private:
+    /* point color-values of stored 3d-objects into the store */
+    void __LinkColors(const coreUintW iFrom, const coreUintW iTo);
+};
+
+
 // ****************************************************************
 /* 3d-object class */
 class coreObject3D : public coreObject
 {
 private:
-    coreVector3 m_vPosition;      // position of the 3d-object
-    coreVector3 m_vSize;          // size-factor of the 3d-object
+    coreVector3 m_vPosition;      // position of the 3d-object (unused while stored)
+    coreVector3 m_vSize;          // size-factor of the 3d-object (unused while stored)
     coreVector3 m_vDirection;     // direction for the rotation quaternion
     coreVector3 m_vOrientation;   // orientation for the rotation quaternion
+    coreVector4 m_vRotation;      // separate rotation quaternion (unused while stored)
+
+    coreTransformStore* m_pStore;       // transform store holding position, size, rotation and color (NULL = own properties)
+    coreUint32          m_iStoreSlot;   // slot within the transform store (only valid while stored)
 
 
 protected:
     coreModelPtr m_pModel;              // model object
     coreModelPtr m_pVolume;             // bounding volume object
 
-    coreVector4 m_vRotation;            // separate rotation quaternion
-
     coreVector3 m_vCollisionModifier;   // size-modifier for collision detection
     coreVector3 m_vCollisionRange;      // total collision range (volume range * modified size)
     coreFloat   m_fCollisionRadius;     // total collision radius (volume radius * maximum modified size)
@@ -59,7 +102,8 @@ protected:
     coreVector3 m_vVisualRange;         // visual range (model range)
     coreFloat   m_fVisualRadius;        // visual radius (model radius)
 
-    coreInt32 m_iType;                  // object type identifier (!0 = currently registered in the object manager)
+    coreInt32  m_iType;                 // object type identifier (!0 = currently registered in the object manager)
+    coreUint32 m_iIndex;                // position within the object manager list (only valid while registered)
 
 
 public:
@@ -68,7 +112,9 @@ public:
     coreObject3D(coreObject3D&&      m)noexcept;
     virtual ~coreObject3D();
 
-    CUSTOM_COPY(coreObject3D)
+    FRIEND_CLASS(coreObjectManager)
+    FRIEND_CLASS(coreTransformStore)
+    CUSTOM_COPY (coreObject3D)
 
     /* assignment operations */
     coreObject3D& operator = (const coreObject3D& c)noexcept;
@@ -94,8 +140,8 @@ public:
     void ChangeType(const coreInt32 iType);
 
     /* set object properties */
-    inline void SetPosition         (const coreVector3 vPosition)          {m_vPosition = vPosition;}
-    inline void SetSize             (const coreVector3 vSize)              {if(m_vSize              != vSize)              {ADD_FLAG(m_eUpdate, CORE_OBJECT_UPDATE_COLLISION | CORE_OBJECT_UPDATE_VISUAL) m_vSize              = vSize;}}
+    inline void SetPosition         (const coreVector3 vPosition)          {this->__Position() = vPosition;}
+    inline void SetSize             (const coreVector3 vSize)              {if(this->__Size()       != vSize)              {ADD_FLAG(m_eUpdate, CORE_OBJECT_UPDATE_COLLISION | CORE_OBJECT_UPDATE_VISUAL) this->__Size()       = vSize;}}
     inline void SetDirection        (const coreVector3 vDirection)         {if(m_vDirection         != vDirection)         {ADD_FLAG(m_eUpdate, CORE_OBJECT_UPDATE_TRANSFORM)                             m_vDirection         = vDirection;}   ASSERT(vDirection  .IsNormalized())}
     inline void SetOrientation      (const coreVector3 vOrientation)       {if(m_vOrientation       != vOrientation)       {ADD_FLAG(m_eUpdate, CORE_OBJECT_UPDATE_TRANSFORM)                             m_vOrientation       = vOrientation;} ASSERT(vOrientation.IsNormalized())}
     inline void SetCollisionModifier(const coreVector3 vCollisionModifier) {if(m_vCollisionModifier != vCollisionModifier) {ADD_FLAG(m_eUpdate, CORE_OBJECT_UPDATE_COLLISION)                             m_vCollisionModifier = vCollisionModifier;}}
@@ -103,17 +149,28 @@ public:
     /* get object properties */
     inline const coreModelPtr& GetModel            ()const {return m_pModel;}
     inline const coreModelPtr& GetVolume           ()const {return m_pVolume ? m_pVolume : m_pModel;}
-    inline const coreVector3&  GetPosition         ()const {return m_vPosition;}
-    inline const coreVector3&  GetSize             ()const {return m_vSize;}
+    inline const coreVector3&  GetPosition         ()const {return this->__Position();}
+    inline const coreVector3&  GetSize             ()const {return this->__Size();}
     inline const coreVector3&  GetDirection        ()const {return m_vDirection;}
     inline const coreVector3&  GetOrientation      ()const {return m_vOrientation;}
-    inline const coreVector4&  GetRotation         ()const {return m_vRotation;}
+    inline const coreVector4&  GetRotation         ()const {return this->__Rotation();}
     inline const coreVector3&  GetCollisionModifier()const {return m_vCollisionModifier;}
     inline const coreVector3&  GetCollisionRange   ()const {return m_vCollisionRange;}
     inline const coreFloat&    GetCollisionRadius  ()const {return m_fCollisionRadius;}
     inline const coreVector3&  GetVisualRange      ()const {return m_vVisualRange;}
     inline const coreFloat&    GetVisualRadius     ()const {return m_fVisualRadius;}
     inline const coreInt32&    GetType             ()const {return m_iType;}
+    inline coreTransformStore* GetTransformStore   ()const {return m_pStore;}
+
+
+private:
+    /* access transformation (redirected into the transform store while stored) */
+    inline       coreVector3& __Position()      {return m_pStore ? m_pStore->m_avPosition[m_iStoreSlot] : m_vPosition;}
+    inline const coreVector3& __Position()const {return m_pStore ? m_pStore->m_avPosition[m_iStoreSlot] : m_vPosition;}
+    inline       coreVector3& __Size    ()      {return m_pStore ? m_pStore->m_avSize    [m_iStoreSlot] : m_vSize;}
+    inline const coreVector3& __Size    ()const {return m_pStore ? m_pStore->m_avSize    [m_iStoreSlot] : m_vSize;}
+    inline       coreVector4& __Rotation()      {return m_pStore ? m_pStore->m_avRotation[m_iStoreSlot] : m_vRotation;}
+    inline const coreVector4& __Rotation()const {return m_pStore ? m_pStore->m_avRotation[m_iStoreSlot] : m_vRotation;}
 };
 
 
@@ -146,6 +203,12 @@ private:
     coreUpdateShader m_nUpdateShaderFunc;                                              // function for updating custom attributes through shader uniforms
     coreUint8        m_iCustomSize;                                                    // vertex size for the custom attribute buffers
 
+    coreTransformStore* m_pTransformStore;                                             // optional transform store for all bound 3d-objects
+
+    coreList<coreObject3D*> m_apRender;                                                // render-enabled 3d-objects to pack (only with culling or parallel packing, in list order)
+    coreList<coreObject3D*> m_apVisible;                                               // visible 3d-objects of the last culling pass (to detect changes)
+    coreBool                m_bCulling;                                                // frustum culling status
+
     coreUint8           m_iFilled;                                                     // vertex array fill status
     coreBatchListUpdate m_eUpdate;                                                     // buffer update status (dirty flag)
 
@@ -179,6 +242,14 @@ public:
     inline void Reserve    (const coreUint32 iCapacity) {m_apObjectList.reserve(iCapacity);}
     inline void ShrinkToFit()                           {m_apObjectList.shrink_to_fit();}
 
+    /* control frustum culling (# only with instancing, repacks all instance data when the visible set changes) */
+    void                   SetCulling(const coreBool bCulling);
+    inline const coreBool& GetCulling()const {return m_bCulling;}
+
+    /* control transform store (# 3d-objects stay in the first store they are bound to) */
+    void                             SetTransformStore(const coreBool bStore);
+    inline const coreTransformStore* GetTransformStore()const {return m_pTransformStore;}
+
     /* control custom vertex attributes */
     template <typename F, typename G, typename H> void CreateCustom(const coreUint8 iVertexSize, F&& nDefineBufferFunc, G&& nUpdateDataFunc, H&& nUpdateShaderFunc);   // [](coreVertexBuffer* OUTPUT pBuffer) -> void, [](coreByte* OUTPUT pData, const coreObject3D* pObject) -> void, [](const coreProgramPtr& pProgram, const coreObject3D* pObject) -> void
 
@@ -207,6 +278,18 @@ private:
     /* render the batch list */
     void __RenderDefault(const coreProgramPtr& pProgramInstanced, const coreProgramPtr& pProgramSingle, const coreUint32 iRenderCount);
     void __RenderCustom (const coreProgramPtr& pProgramInstanced, const coreProgramPtr& pProgramSingle, const coreUint32 iRenderCount);
+
+    /* collect render-enabled 3d-objects (optionally culled against the view frustum) */
+    void       __GatherInstances();
+    coreUint32 __CullInstances  ();
+
+    /* pack instance data from the collected 3d-objects */
+    void __PackInstances(coreByte* OUTPUT pOutput, const coreUint32 iRenderCount)const;
+    void __PackRange    (coreByte* OUTPUT pOutput, const coreUint32 iFrom, const coreUint32 iTo)const;
+
+    /* write compressed instance data */
+    static void __WriteInstanceHigh(coreByte* OUTPUT pCursor, const coreVector3 vPosition, const coreVector3 vSize, const coreVector4 vRotation, const coreVector4 vColor, const coreVector4 vTexParams);
+    static void __WriteInstanceLow (coreByte* OUTPUT pCursor, const coreVector3 vPosition, const coreVector3 vSize, const coreVector4 vRotation, const coreVector4 vColor, const coreVector4 vTexParams);
 };
 
 
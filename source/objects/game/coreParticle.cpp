@@ -35,6 +35,9 @@ coreParticleSystem::coreParticleSystem(const coreUint32 iStartSize)noexcept
 , m_pProgram           (NULL)
 , m_apRenderList       {}
 , m_pDefaultEffect     (NULL)
+, m_aiOrder            {}
+, m_aiOrderSwap        {}
+, m_eStage             (CORE_PARTICLE_STAGE_NONE)
 , m_aiVertexArray      {}
 , m_aInstanceBuffer    {}
 , m_pAnimateData       (NULL)
@@ -85,6 +88,23 @@ void coreParticleSystem::Render()
 {
     if(m_apRenderList.empty()) return;
 
+    coreUint32 iRenderCount = m_apRenderList.size();
+    m_aiOrder.clear();
+
+    if(m_eStage)
+    {
+        // cull and sort all particles
+        iRenderCount = this->__ProcessStage();
+
+        // update debug counters
+        Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_CULLED, m_apRenderList.size() - iRenderCount);
+
+        if(!iRenderCount) return;
+
+        // always repack (camera may have changed since the last render)
+        m_bUpdate = true;
+    }
+
     // enable the shader-program
     ASSERT(m_pProgram)
     if(!m_pProgram.IsUsable()) return;
@@ -105,66 +125,12 @@ void coreParticleSystem::Render()
             m_aiVertexArray  .next();
             m_aInstanceBuffer.next();
 
-            if(CORE_GL_SUPPORT(ARB_half_float_vertex))
-            {
-                // map required area of the instance data buffer
-                coreByte* pRange  = m_aInstanceBuffer.current().MapWrite(0u, m_apRenderList.size() * CORE_PARTICLE_INSTANCE_SIZE_HIGH, CORE_DATABUFFER_MAP_INVALIDATE_ALL);
-                coreByte* pCursor = pRange;
+            // map required area of the instance data buffer
+            const coreUintW iSize  = CORE_GL_SUPPORT(ARB_half_float_vertex) ? CORE_PARTICLE_INSTANCE_SIZE_HIGH : CORE_PARTICLE_INSTANCE_SIZE_LOW;
+            coreByte*       pRange = m_aInstanceBuffer.current().MapWrite(0u, iRenderCount * iSize, CORE_DATABUFFER_MAP_INVALIDATE_ALL);
 
-                FOR_EACH_REV(it, m_apRenderList)
-                {
-                    // get current particle state
-                    const coreParticle* pParticle = (*it);
-                    const coreObject3D* pOrigin   = pParticle->GetEffect()->GetOrigin();
-
-                    // animate particle
-                    const coreParticle::coreAnim oAnim = m_nAnimateFunc(*pParticle, m_pAnimateData);
-
-                    // compress data
-                    const coreVector3 vPosition = pOrigin ? (pOrigin->GetPosition() + oAnim.vPosition) : oAnim.vPosition;
-                    const coreUint64  iData     = coreVector4(oAnim.fScale, oAnim.fAngle, pParticle->GetValue(), 0.0f).PackFloat4x16();
-                    const coreUint32  iColor    = oAnim.vColor.PackUnorm4x8();
-                    ASSERT((oAnim.vColor.Min() >= 0.0f) && (oAnim.vColor.Max() <= 1.0f))
-
-                    // write data to the buffer
-                    std::memcpy(pCursor,       &vPosition, sizeof(coreVector3));
-                    std::memcpy(pCursor + 12u, &iData,     sizeof(coreUint64));
-                    std::memcpy(pCursor + 20u, &iColor,    sizeof(coreUint32));
-                    pCursor += CORE_PARTICLE_INSTANCE_SIZE_HIGH;
-                }
-
-                ASSERT(coreUint32(pCursor - pRange) == m_apRenderList.size() * CORE_PARTICLE_INSTANCE_SIZE_HIGH)
-            }
-            else
-            {
-                // map required area of the instance data buffer
-                coreByte* pRange  = m_aInstanceBuffer.current().MapWrite(0u, m_apRenderList.size() * CORE_PARTICLE_INSTANCE_SIZE_LOW, CORE_DATABUFFER_MAP_INVALIDATE_ALL);
-                coreByte* pCursor = pRange;
-
-                FOR_EACH_REV(it, m_apRenderList)
-                {
-                    // get current particle state
-                    const coreParticle* pParticle = (*it);
-                    const coreObject3D* pOrigin   = pParticle->GetEffect()->GetOrigin();
-
-                    // animate particle
-                    const coreParticle::coreAnim oAnim = m_nAnimateFunc(*pParticle, m_pAnimateData);
-
-                    // compress data
-                    const coreVector3 vPosition = pOrigin ? (pOrigin->GetPosition() + oAnim.vPosition) : oAnim.vPosition;
-                    const coreVector3 vData     = coreVector3(oAnim.fScale, oAnim.fAngle, pParticle->GetValue());
-                    const coreUint32  iColor    = oAnim.vColor.PackUnorm4x8();
-                    ASSERT((oAnim.vColor.Min() >= 0.0f) && (oAnim.vColor.Max() <= 1.0f))
-
-                    // write data to the buffer
-                    std::memcpy(pCursor,       &vPosition, sizeof(coreVector3));
-                    std::memcpy(pCursor + 12u, &vData,     sizeof(coreVector3));
-                    std::memcpy(pCursor + 24u, &iColor,    sizeof(coreUint32));
-                    pCursor += CORE_PARTICLE_INSTANCE_SIZE_LOW;
-                }
-
-                ASSERT(coreUint32(pCursor - pRange) == m_apRenderList.size() * CORE_PARTICLE_INSTANCE_SIZE_LOW)
-            }
+            // animate and pack all particles (newest first, or as processed)
+            this->__PackParticles(pRange, iRenderCount);
 
             // unmap buffer
             m_aInstanceBuffer.current().Unmap();
@@ -178,7 +144,7 @@ void coreParticleSystem::Render()
 
         // draw the model instanced
         glBindVertexArray(m_aiVertexArray.current());
-        Core::Manager::Object->GetLowQuad()->DrawArraysInstanced(m_apRenderList.size());
+        Core::Manager::Object->GetLowQuad()->DrawArraysInstanced(iRenderCount);
 
         // update debug counters
         Core::Debug->CounterAdd(CORE_DEBUG_COUNTER_BINDS_MODEL, 1u);
@@ -189,10 +155,10 @@ void coreParticleSystem::Render()
         coreModel*   pModel   = Core::Manager::Object->GetLowQuad().GetResource();
 
         // draw without instancing
-        FOR_EACH_REV(it, m_apRenderList)
+        for(coreUint32 i = 0u; i < iRenderCount; ++i)
         {
             // get current particle state
-            const coreParticle* pParticle = (*it);
+            const coreParticle* pParticle = m_apRenderList[this->__GetRenderIndex(i)];
             const coreObject3D* pOrigin   = pParticle->GetEffect()->GetOrigin();
 
             // animate particle
@@ -220,20 +186,22 @@ void coreParticleSystem::Render()
 /* move the particle system */
 void coreParticleSystem::Move()
 {
-    FOR_EACH_DYN(it, m_apRenderList)
+    coreUintW iNum = 0u;
+
+    FOR_EACH(it, m_apRenderList)
     {
         coreParticle* pParticle = (*it);
 
         // update particle
         pParticle->__Update();
-        if(!pParticle->IsActive())
-        {
-            // remove finished particle
-            DYN_REMOVE(it, m_apRenderList)
-        }
-        else DYN_KEEP(it, m_apRenderList)
+
+        // keep only active particles (in order)
+        if(pParticle->IsActive()) m_apRenderList[iNum++] = pParticle;
     }
 
+    // remove all finished particles
+    m_apRenderList.resize(iNum);
+
     // set the update status
     m_bUpdate = true;
 }
@@ -336,7 +304,9 @@ void coreParticleSystem::Clear(const coreParticleEffect* pEffect)
 {
     ASSERT(pEffect)
 
-    FOR_EACH_DYN(it, m_apRenderList)
+    coreUintW iNum = 0u;
+
+    FOR_EACH(it, m_apRenderList)
     {
         coreParticle* pParticle = (*it);
 
@@ -345,12 +315,12 @@ void coreParticleSystem::Clear(const coreParticleEffect* pEffect)
         {
             // reset particle state
             pParticle->Deactivate();
-
-            // remove particle
-            DYN_REMOVE(it, m_apRenderList)
         }
-        else DYN_KEEP(it, m_apRenderList)
+        else m_apRenderList[iNum++] = pParticle;
     }
+
+    // remove all cleared particles
+    m_apRenderList.resize(iNum);
 }
 
 
@@ -388,6 +358,26 @@ void coreParticleSystem::ClearAll()
 }
 
 
+// ****************************************************************
+/* advance simulation of active particles */
+void coreParticleSystem::Advance(const coreParticleEffect* pEffect, const coreFloat fTime)
+{
+    ASSERT(pEffect)
+
+    // advance only particles of the effect
+    this->__Advance(pEffect, fTime);
+}
+
+
+// ****************************************************************
+/* advance simulation of all active particles */
+void coreParticleSystem::AdvanceAll(const coreFloat fTime)
+{
+    // advance every particle
+    this->__Advance(NULL, fTime);
+}
+
+
 // ****************************************************************
 /* change current size */
 void coreParticleSystem::Reallocate(const coreUint32 iSize)
@@ -484,6 +474,283 @@ void coreParticleSystem::__Reset(const coreResourceReset eInit)
 }
 
 
+// ****************************************************************
+/* advance simulation of active particles */
+void coreParticleSystem::__Advance(const coreParticleEffect* pEffect, const coreFloat fTime)
+{
+    ASSERT(fTime >= 0.0f)
+
+    coreUintW iNum = 0u;
+
+    FOR_EACH(it, m_apRenderList)
+    {
+        coreParticle* pParticle = (*it);
+
+        // check particle effect object
+        if(!pEffect || (pParticle->GetEffect() == pEffect))
+        {
+            // update simulation value
+            pParticle->m_fValue -= pParticle->m_fSpeed * fTime;
+        }
+
+        // keep only active particles (in order)
+        if(pParticle->IsActive()) m_apRenderList[iNum++] = pParticle;
+                             else pParticle->Deactivate();
+    }
+
+    // remove all finished particles
+    m_apRenderList.resize(iNum);
+
+    // set the update status
+    m_bUpdate = true;
+}
+
+
+// ****************************************************************
+/* cull and sort active particles */
+coreUint32 coreParticleSystem::__ProcessStage()
+{
+    ASSERT(m_eStage && !m_apRenderList.empty())
+
+    const coreBool bCull = HAS_FLAG(m_eStage, CORE_PARTICLE_STAGE_CULL);
+    const coreBool bSort = HAS_FLAG(m_eStage, CORE_PARTICLE_STAGE_SORT);
+
+    // get current view frustum
+    coreVector4 avPlane[6];
+    if(bCull) Core::Graphics->CalcFrustum(avPlane);
+
+    // prepare depth quantization (values behind the far clipping plane are clamped)
+    const coreVector3 vCamPosition  = Core::Graphics->GetCamPosition();
+    const coreVector3 vCamDirection = Core::Graphics->GetCamDirection();
+    const coreFloat   fDepthFactor  = RCP(Core::Graphics->GetFarClip());
+    const coreUint32  iDepthMax     = BITLINE(CORE_PARTICLE_DEPTH_BITS);
+
+    // get extent of the particle geometry
+    const coreFloat fExtent = Core::Manager::Object->GetLowQuad()->GetBoundingRadius();
+
+    const coreUint32 iSize = m_apRenderList.size();
+    m_aiOrder.reserve(iSize);
+
+    for(coreUint32 i = 0u; i < iSize; ++i)
+    {
+        // process newest particles first (same order as without processing)
+        const coreUint32    iIndex    = iSize - 1u - i;
+        const coreParticle* pParticle = m_apRenderList[iIndex];
+        const coreObject3D* pOrigin   = pParticle->GetEffect()->GetOrigin();
+
+        coreVector3 vPosition;
+        coreFloat   fScale;
+
+        if(m_nAnimateFunc == DefaultAnimateFunc)
+        {
+            // interpolate only required properties
+            vPosition = LERP(pParticle->m_EndState.vPosition, pParticle->m_BeginState.vPosition, pParticle->m_fValue);
+            fScale    = LERP(pParticle->m_EndState.fScale,    pParticle->m_BeginState.fScale,    pParticle->m_fValue);
+        }
+        else
+        {
+            // animate particle
+            const coreParticle::coreAnim oAnim = m_nAnimateFunc(*pParticle, m_pAnimateData);
+
+            vPosition = oAnim.vPosition;
+            fScale    = oAnim.fScale;
+        }
+
+        if(pOrigin) vPosition += pOrigin->GetPosition();
+
+        if(bCull)
+        {
+            const coreFloat fRadius = ABS(fScale) * fExtent;
+
+            // test bounding sphere against all planes
+            coreBool bOutside = false;
+            for(coreUintW j = 0u; j < 6u; ++j)
+            {
+                if(coreVector3::Dot(avPlane[j].xyz(), vPosition) + avPlane[j].w + fRadius <= 0.0f)
+                {
+                    bOutside = true;
+                    break;
+                }
+            }
+            if(bOutside) continue;
+        }
+
+        // quantize depth (inverted, to sort back-to-front)
+        const coreUint64 iDepth = bSort ? (iDepthMax - F_TO_UI(CLAMP01(coreVector3::Dot(vPosition - vCamPosition, vCamDirection) * fDepthFactor) * I_TO_F(iDepthMax))) : 0u;
+
+        // remember visible particle
+        m_aiOrder.push_back((iDepth << 32u) | iIndex);
+    }
+
+    if(bSort && !m_aiOrder.empty())
+    {
+        m_aiOrderSwap.resize(m_aiOrder.size());
+
+        // sort by depth with a stable radix sort (equal depths keep their order between frames)
+        for(coreUintW iShift = 32u, ie = 32u + CORE_PARTICLE_DEPTH_BITS; iShift < ie; iShift += 8u)
+        {
+            coreUint32 aiCount[256] = {};
+
+            // count occurrences of each digit
+            FOR_EACH(it, m_aiOrder) ++aiCount[((*it) >> iShift) & 0xFFu];
+
+            // calculate target offsets
+            for(coreUint32 j = 0u, iTotal = 0u; j < 256u; ++j)
+            {
+                const coreUint32 iCount = aiCount[j];
+                aiCount[j] = iTotal;
+                iTotal    += iCount;
+            }
+
+            // move all entries to their targets
+            FOR_EACH(it, m_aiOrder) m_aiOrderSwap[aiCount[((*it) >> iShift) & 0xFFu]++] = (*it);
+            m_aiOrder.swap(m_aiOrderSwap);
+        }
+
+        STATIC_ASSERT(CORE_PARTICLE_DEPTH_BITS % 8u == 0u)
+    }
+
+    return m_aiOrder.size();
+}
+
+
+// ****************************************************************
+/* animate and pack active particles into the instance data buffer */
+void coreParticleSystem::__PackParticles(coreByte* OUTPUT pOutput, const coreUint32 iCount)const
+{
+    // distribute chunks of particles over all threads (only for larger systems with the default animation)
+    const coreUint32 iChunk = ((iCount >= CORE_PARTICLE_PARALLEL_THRESHOLD) && (m_nAnimateFunc == DefaultAnimateFunc)) ? CORE_PARTICLE_PARALLEL_CHUNK : iCount;
+    Core::Manager::Job->ParallelFor(iCount, MAX(iChunk, 1u), [&](const coreUintW iFrom, const coreUintW iTo)
+    {
+        this->__PackRange(pOutput, iFrom, iTo);
+    });
+}
+
+
+// ****************************************************************
+/* animate and pack a range of particles */
+void coreParticleSystem::__PackRange(coreByte* OUTPUT pOutput, const coreUint32 iFrom, const coreUint32 iTo)const
+{
+    ASSERT((iFrom < iTo) && (iTo <= m_apRenderList.size()) && (m_aiOrder.empty() || (iTo <= m_aiOrder.size())))
+
+    // select instance data format
+    const coreBool  bHigh = CORE_GL_SUPPORT(ARB_half_float_vertex);
+    const coreUintW iSize = bHigh ? CORE_PARTICLE_INSTANCE_SIZE_HIGH : CORE_PARTICLE_INSTANCE_SIZE_LOW;
+
+    coreByte* pCursor = pOutput + iFrom * iSize;
+
+    if(m_nAnimateFunc == DefaultAnimateFunc)
+    {
+        for(coreUint32 i = iFrom; i < iTo; i += 4u)
+        {
+            alignas(ALIGNMENT_SIMD) coreFloat aafBegin[9][4];   // position (3), scale, angle, color (4)
+            alignas(ALIGNMENT_SIMD) coreFloat aafEnd  [9][4];
+            alignas(ALIGNMENT_SIMD) coreFloat aafAnim [9][4];
+            alignas(ALIGNMENT_SIMD) coreFloat afValue    [4];
+
+            // transpose state into lanes
+            const auto nGatherFunc = [](coreFloat (*OUTPUT pafLane)[4], const coreUintW k, const coreParticle::coreState& oState)
+            {
+                const coreVector4 vColor = oState.GetColor4();
+
+                pafLane[0][k] = oState.vPosition.x;
+                pafLane[1][k] = oState.vPosition.y;
+                pafLane[2][k] = oState.vPosition.z;
+                pafLane[3][k] = oState.fScale;
+                pafLane[4][k] = oState.fAngle;
+                pafLane[5][k] = vColor.x;
+                pafLane[6][k] = vColor.y;
+                pafLane[7][k] = vColor.z;
+                pafLane[8][k] = vColor.w;
+            };
+
+            // gather next four particles (repeat the last one)
+            for(coreUintW k = 0u; k < 4u; ++k)
+            {
+                const coreParticle* pParticle = m_apRenderList[this->__GetRenderIndex(MIN(i + k, iTo - 1u))];
+
+                nGatherFunc(aafBegin, k, pParticle->m_BeginState);
+                nGatherFunc(aafEnd,   k, pParticle->m_EndState);
+                afValue[k] = pParticle->m_fValue;
+            }
+
+            // interpolate between final and initial state (same as LERP)
+            const coreLane vValue   = coreLaneLoad(afValue);
+            const coreLane vInverse = coreLaneSub(coreLaneSet(1.0f), vValue);
+            for(coreUintW j = 0u; j < 9u; ++j)
+            {
+                coreLaneStore(aafAnim[j], coreLaneAdd(coreLaneMul(coreLaneLoad(aafEnd[j]), vInverse), coreLaneMul(coreLaneLoad(aafBegin[j]), vValue)));
+            }
+
+            // write data to the buffer
+            for(coreUintW k = 0u, ke = MIN(4u, iTo - i); k < ke; ++k)
+            {
+                const coreParticle* pParticle = m_apRenderList[this->__GetRenderIndex(i + k)];
+                const coreObject3D* pOrigin   = pParticle->GetEffect()->GetOrigin();
+
+                const coreVector3 vPosition = coreVector3(aafAnim[0][k], aafAnim[1][k], aafAnim[2][k]);
+                const coreVector4 vColor    = coreVector4(aafAnim[5][k], aafAnim[6][k], aafAnim[7][k], aafAnim[8][k]);
+
+                if(bHigh) coreParticleSystem::__WriteParticleHigh(pCursor, pOrigin ? (pOrigin->GetPosition() + vPosition) : vPosition, aafAnim[3][k], aafAnim[4][k], afValue[k], vColor);
+                     else coreParticleSystem::__WriteParticleLow (pCursor, pOrigin ? (pOrigin->GetPosition() + vPosition) : vPosition, aafAnim[3][k], aafAnim[4][k], afValue[k], vColor);
+                pCursor += iSize;
+            }
+        }
+    }
+    else
+    {
+        for(coreUint32 i = iFrom; i < iTo; ++i)
+        {
+            // get current particle state
+            const coreParticle* pParticle = m_apRenderList[this->__GetRenderIndex(i)];
+            const coreObject3D* pOrigin   = pParticle->GetEffect()->GetOrigin();
+
+            // animate particle
+            const coreParticle::coreAnim oAnim = m_nAnimateFunc(*pParticle, m_pAnimateData);
+
+            // write data to the buffer
+            if(bHigh) coreParticleSystem::__WriteParticleHigh(pCursor, pOrigin ? (pOrigin->GetPosition() + oAnim.vPosition) : oAnim.vPosition, oAnim.fScale, oAnim.fAngle, pParticle->GetValue(), oAnim.vColor);
+                 else coreParticleSystem::__WriteParticleLow (pCursor, pOrigin ? (pOrigin->GetPosition() + oAnim.vPosition) : oAnim.vPosition, oAnim.fScale, oAnim.fAngle, pParticle->GetValue(), oAnim.vColor);
+            pCursor += iSize;
+        }
+    }
+
+    ASSERT(coreUintW(pCursor - pOutput) == iTo * iSize)
+}
+
+
+// ****************************************************************
+/* write compressed instance data (high quality) */
+void coreParticleSystem::__WriteParticleHigh(coreByte* OUTPUT pCursor, const coreVector3 vPosition, const coreFloat fScale, const coreFloat fAngle, const coreFloat fValue, const coreVector4 vColor)
+{
+    // compress data
+    const coreUint64 iData  = coreVector4(fScale, fAngle, fValue, 0.0f).PackFloat4x16();
+    const coreUint32 iColor = vColor.PackUnorm4x8();
+    ASSERT((vColor.Min() >= 0.0f) && (vColor.Max() <= 1.0f))
+
+    // write data to the buffer
+    std::memcpy(pCursor,       &vPosition, sizeof(coreVector3));
+    std::memcpy(pCursor + 12u, &iData,     sizeof(coreUint64));
+    std::memcpy(pCursor + 20u, &iColor,    sizeof(coreUint32));
+}
+
+
+// ****************************************************************
+/* write compressed instance data (low quality) */
+void coreParticleSystem::__WriteParticleLow(coreByte* OUTPUT pCursor, const coreVector3 vPosition, const coreFloat fScale, const coreFloat fAngle, const coreFloat fValue, const coreVector4 vColor)
+{
+    // compress data
+    const coreVector3 vData  = coreVector3(fScale, fAngle, fValue);
+    const coreUint32  iColor = vColor.PackUnorm4x8();
+    ASSERT((vColor.Min() >= 0.0f) && (vColor.Max() <= 1.0f))
+
+    // write data to the buffer
+    std::memcpy(pCursor,       &vPosition, sizeof(coreVector3));
+    std::memcpy(pCursor + 12u, &vData,     sizeof(coreVector3));
+    std::memcpy(pCursor + 24u, &iColor,    sizeof(coreUint32));
+}
+
+
 // ****************************************************************
 /* constructor */
 coreParticleEffect::coreParticleEffect(coreParticleSystem* pSystem)noexcept
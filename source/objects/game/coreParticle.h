@@ -16,10 +16,7 @@
 // TODO 5: how about texture index parameter to allow different objects to be rendered
 // TODO 5: high systems: currently CPU(move) is bottleneck, look for improvement with transform feedback(3.0) or compute shader(4.3)
 // TODO 5: low systems: merge geometry to reduce draw calls
-// TODO 3: sorting based on position
-// TODO 3: culling (also on instancing)
 // TODO 5: <old comment style>
-// TODO 3: also allow advancing simulation of already created particles
 
 
 // ****************************************************************
@@ -27,6 +24,18 @@
 #define CORE_PARTICLE_INSTANCE_SIZE_HIGH (24u)   // instancing per-particle size (high quality) (position (12), data (8),  color (4))
 #define CORE_PARTICLE_INSTANCE_SIZE_LOW  (28u)   // instancing per-particle size (low quality)  (position (12), data (12), color (4))
 #define CORE_PARTICLE_INSTANCE_BUFFERS   (3u)    // number of concurrent instance data buffer
+#define CORE_PARTICLE_PARALLEL_CHUNK     (1024u) // number of particles packed by a single job (multiple of 4)
+#define CORE_PARTICLE_PARALLEL_THRESHOLD (8192u) // minimum number of particles to pack in parallel
+#define CORE_PARTICLE_DEPTH_BITS         (16u)   // precision of the quantized depth used for sorting (radix sort with 8 bits per pass)
+
+enum coreParticleStage : coreUint8
+{
+    CORE_PARTICLE_STAGE_NONE = 0x00u,   // render all particles from newest to oldest
+    CORE_PARTICLE_STAGE_CULL = 0x01u,   // drop particles outside of the view frustum
+    CORE_PARTICLE_STAGE_SORT = 0x02u,   // sort particles back-to-front
+    CORE_PARTICLE_STAGE_ALL  = 0x03u    // cull and sort
+};
+ENABLE_BITWISE(coreParticleStage)
 
 
 // ****************************************************************
@@ -134,8 +143,12 @@ private:
     coreTexturePtr m_apTexture[CORE_TEXTURE_UNITS];                                 // multiple texture objects
     coreProgramPtr m_pProgram;                                                      // shader-program object
 
-    std::deque<coreParticle*> m_apRenderList;                                       // sorted render list with active particles
-    coreParticleEffect*       m_pDefaultEffect;                                     // default particle effect object (dynamic, because of class order)
+    coreList<coreParticle*> m_apRenderList;                                         // sorted render list with active particles
+    coreParticleEffect*     m_pDefaultEffect;                                       // default particle effect object (dynamic, because of class order)
+
+    coreList<coreUint64> m_aiOrder;                                                 // render list indices of all processed particles (with quantized depth in the upper 32 bits)
+    coreList<coreUint64> m_aiOrderSwap;                                             // temporary memory for sorting
+    coreParticleStage    m_eStage;                                                  // additional processing before render
 
     coreRing<GLuint,           CORE_PARTICLE_INSTANCE_BUFFERS> m_aiVertexArray;     // vertex array objects
     coreRing<coreVertexBuffer, CORE_PARTICLE_INSTANCE_BUFFERS> m_aInstanceBuffer;   // instance data buffers
@@ -150,6 +163,7 @@ public:
     explicit coreParticleSystem(const coreUint32 iStartSize = 0u)noexcept;
     ~coreParticleSystem()final;
 
+    FRIEND_CLASS(coreParticleEffect)
     DISABLE_COPY(coreParticleSystem)
 
     /* define the visual appearance */
@@ -176,6 +190,10 @@ public:
     void UnbindAll();
     void ClearAll ();
 
+    /* advance simulation of active particles */
+    void Advance   (const coreParticleEffect* pEffect, const coreFloat fTime);
+    void AdvanceAll(const coreFloat fTime);
+
     /* control memory allocation */
     void Reallocate(const coreUint32 iSize);
 
@@ -186,12 +204,16 @@ public:
     /* override particle animation function */
     template <typename F> inline void SetAnimateFunc(void* pAnimateData, F&& nAnimateFunc) {m_pAnimateData = pAnimateData; m_nAnimateFunc = std::forward<F>(nAnimateFunc);}   // [](const coreParticle& oParticle, void* pData) -> coreParticle::coreAnim
 
+    /* set object properties */
+    inline void SetStage(const coreParticleStage eStage) {m_eStage = eStage; m_bUpdate = true;}
+
     /* get object properties */
-    inline const coreTexturePtr& GetTexture           (const coreUintW iUnit)const {ASSERT(iUnit < CORE_TEXTURE_UNITS) return m_apTexture[iUnit];}
-    inline const coreProgramPtr& GetProgram           ()const                      {return m_pProgram;}
-    inline const coreUint32&     GetNumParticles      ()const                      {return m_iNumParticles;}
-    inline       coreUintW       GetNumActiveParticles()const                      {return m_apRenderList.size();}
-    inline coreParticleEffect*   GetDefaultEffect     ()const                      {return m_pDefaultEffect;}
+    inline const coreTexturePtr&    GetTexture           (const coreUintW iUnit)const {ASSERT(iUnit < CORE_TEXTURE_UNITS) return m_apTexture[iUnit];}
+    inline const coreProgramPtr&    GetProgram           ()const                      {return m_pProgram;}
+    inline const coreUint32&        GetNumParticles      ()const                      {return m_iNumParticles;}
+    inline       coreUintW          GetNumActiveParticles()const                      {return m_apRenderList.size();}
+    inline coreParticleEffect*      GetDefaultEffect     ()const                      {return m_pDefaultEffect;}
+    inline const coreParticleStage& GetStage             ()const                      {return m_eStage;}
 
 
 private:
@@ -200,6 +222,21 @@ private:
 
     /* reshape with the resource manager */
     inline void __Reshape()final {}
+
+    /* advance simulation of active particles (NULL = all) */
+    void __Advance(const coreParticleEffect* pEffect, const coreFloat fTime);
+
+    /* cull and sort active particles */
+    coreUint32 __ProcessStage();
+    inline coreUint32 __GetRenderIndex(const coreUint32 iIndex)const {return m_aiOrder.empty() ? (m_apRenderList.size() - 1u - iIndex) : coreUint32(m_aiOrder[iIndex]);}
+
+    /* animate and pack active particles into the instance data buffer */
+    void __PackParticles(coreByte* OUTPUT pOutput, const coreUint32 iCount)const;
+    void __PackRange    (coreByte* OUTPUT pOutput, const coreUint32 iFrom, const coreUint32 iTo)const;
+
+    /* write compressed instance data */
+    static void __WriteParticleHigh(coreByte* OUTPUT pCursor, const coreVector3 vPosition, const coreFloat fScale, const coreFloat fAngle, const coreFloat fValue, const coreVector4 vColor);
+    static void __WriteParticleLow (coreByte* OUTPUT pCursor, const coreVector3 vPosition, const coreFloat fScale, const coreFloat fAngle, const coreFloat fValue, const coreVector4 vColor);
 };
 
 
@@ -239,6 +276,10 @@ public:
     /* advance continuous particle creation */
     inline void AdvanceCreation(const coreFloat fTicks) {ASSERT(fTicks > 0.0f) m_fCreation += fTicks;}
 
+    /* advance simulation without stepping through frames (e.g. to warm up effects) */
+    template <typename F> void WarmUp(const coreFloat fTime, const coreUintW iNum, const coreFloat fFrequency, F&& nInitFunc);   // [](coreParticle* OUTPUT pParticle, const coreUintW i) -> void
+    inline void Advance(const coreFloat fTime) {if(m_pSystem) m_pSystem->Advance(this, fTime);}
+
     /* update particles with custom simulation */
     template <typename F> inline void ForEachParticle(F&& nUpdateFunc) {ASSERT(m_pSystem) m_pSystem->ForEachParticle(this, std::forward<F>(nUpdateFunc));}   // [](coreParticle* OUTPUT pParticle, const coreUintW i) -> void
 
@@ -251,6 +292,11 @@ public:
     inline const coreUint8&    GetTimeID()const {return m_iTimeID;}
     inline coreObject3D*       GetOrigin()const {return m_pOrigin;}
     inline coreParticleSystem* GetSystem()const {return m_pSystem;}
+
+
+private:
+    /* create new particles for all pending creation steps */
+    template <typename F> void __CreateSteps(const coreUintW iNum, const coreFloat fFrequency, const coreBool bDiscard, F&& nInitFunc);
 };
 
 
@@ -313,8 +359,43 @@ template <typename F> void coreParticleSystem::ForEachParticleAll(F&& nUpdateFun
 /* create new particles */
 template <typename F> void coreParticleEffect::CreateParticle(const coreUintW iNum, const coreFloat fFrequency, F&& nInitFunc)
 {
-    // update and check status value
+    // update status value
     m_fCreation.Update(fFrequency, m_iTimeID);
+
+    // create particles for all passed steps
+    this->__CreateSteps(iNum, fFrequency, false, std::forward<F>(nInitFunc));
+}
+
+template <typename F> void coreParticleEffect::CreateParticle(const coreUintW iNum, F&& nInitFunc)
+{
+    // create particles and call init function
+    for(coreUintW i = iNum; i--; )
+    {
+        nInitFunc(this->CreateParticle(), i);
+    }
+}
+
+
+// ****************************************************************
+/* advance simulation without stepping through frames */
+template <typename F> void coreParticleEffect::WarmUp(const coreFloat fTime, const coreUintW iNum, const coreFloat fFrequency, F&& nInitFunc)
+{
+    ASSERT(m_pSystem && (fTime >= 0.0f) && (fFrequency > 0.0f))
+
+    // advance already created particles
+    m_pSystem->Advance(this, fTime);
+
+    // create all particles of the skipped time at once (with their correct age)
+    m_fCreation += fTime * fFrequency;
+    this->__CreateSteps(iNum, fFrequency, true, std::forward<F>(nInitFunc));
+}
+
+
+// ****************************************************************
+/* create new particles for all pending creation steps */
+template <typename F> void coreParticleEffect::__CreateSteps(const coreUintW iNum, const coreFloat fFrequency, const coreBool bDiscard, F&& nInitFunc)
+{
+    // check status value
     if(m_fCreation >= 1.0f)
     {
         // adjust status value
@@ -332,22 +413,23 @@ template <typename F> void coreParticleEffect::CreateParticle(const coreUintW iN
                 coreParticle* pParticle = this->CreateParticle();
                 nInitFunc(pParticle, i);
 
-                // adjust simulation value
-                pParticle->__Adjust(fTime);
+                if(bDiscard && (pParticle->m_fValue <= pParticle->m_fSpeed * fTime))
+                {
+                    // remove particle which would have already finished (always the last one)
+                    ASSERT(m_pSystem->m_apRenderList.back() == pParticle)
+                    pParticle->Deactivate();
+                    m_pSystem->m_apRenderList.pop_back();
+                }
+                else
+                {
+                    // adjust simulation value
+                    pParticle->__Adjust(fTime);
+                }
             }
         }
     }
 }
 
-template <typename F> void coreParticleEffect::CreateParticle(const coreUintW iNum, F&& nInitFunc)
-{
-    // create particles and call init function
-    for(coreUintW i = iNum; i--; )
-    {
-        nInitFunc(this->CreateParticle(), i);
-    }
-}
-
 
 // ****************************************************************
 /* additional checks */
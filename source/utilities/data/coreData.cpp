@@ -45,10 +45,11 @@
 THREAD_LOCAL coreData::coreTempString coreData::s_TempString         = {};
 coreMapStrFull<const coreChar*>       coreData::s_apcCommandLine     = {};
 coreString                            coreData::s_sUserFolder        = "";
-ZSTD_CCtx*                            coreData::s_pCompressContext   = ZSTD_createCCtx();   // never cleaned up
-ZSTD_DCtx*                            coreData::s_pDecompressContext = ZSTD_createDCtx();
+coreList<ZSTD_CCtx*>                  coreData::s_apCompressPool     = {};   // never cleaned up
+coreList<ZSTD_DCtx*>                  coreData::s_apDecompressPool   = {};
 coreLock                              coreData::s_CompressLock       = coreLock();
 coreLock                              coreData::s_DecompressLock     = coreLock();
+coreAtomic<coreUint64>                coreData::s_iCompressWait      = 0u;
 
 extern "C" const coreChar*        g_pcUserFolder = "";   // to allow access from C files
 extern "C" coreInt32              g_iArgc        = 0;
@@ -1750,6 +1751,9 @@ coreStatus coreData::FileCopy(const coreChar* pcFrom, const coreChar* pcTo)
                 coreIntW iRet;
                 coreIntW iLen = oBuffer.st_size ? oBuffer.st_size : SSIZE_MAX;
 
+                // announce sequential access (improve readahead)
+                posix_fadvise(iFileFrom, 0, 0, POSIX_FADV_SEQUENTIAL);
+
                 // copy directly in kernel space
                 if((iRet = copy_file_range(iFileFrom, NULL, iFileTo, NULL, iLen, 0u)) > 0)
                 {
@@ -1983,6 +1987,37 @@ coreStatus coreData::FileUnmap(const coreFileMap* pMap)
 }
 
 
+// ****************************************************************
+/* hint upcoming file read (start readahead in the background) */
+coreStatus coreData::FilePrefetch(const coreChar* pcPath, const coreInt64 iOffset, const coreInt64 iLength)
+{
+    ASSERT(pcPath && (iOffset >= 0) && (iLength >= 0))
+
+#if defined(_CORE_LINUX_)
+
+    // open file
+    const coreInt32 iFile = open(pcPath, O_RDONLY);
+    if(iFile != -1)
+    {
+        // request data into page cache (without blocking, 0 = until end of file)
+        const coreInt32 iResult = posix_fadvise(iFile, iOffset, iLength, POSIX_FADV_WILLNEED);
+
+        // close file (page cache is not affected)
+        close(iFile);
+
+        return iResult ? CORE_ERROR_SYSTEM : CORE_OK;
+    }
+
+    return CORE_ERROR_FILE;
+
+#else
+
+    return CORE_ERROR_SUPPORT;
+
+#endif
+}
+
+
 // ****************************************************************
 /* check if directory exists */
 coreBool coreData::DirectoryExists(const coreChar* pcPath)
@@ -2476,10 +2511,11 @@ coreStatus coreData::Compress(const coreByte* pInput, const coreUint32 iInputSiz
     const coreUintW iBound  = ZSTD_compressBound(iInputSize);
     coreByte*       pBuffer = new coreByte[iBound + sizeof(coreUint32)];
 
-    const coreLocker oLocker(&s_CompressLock);
-
     // compress data
-    const coreUintW iWritten = ZSTD_compressCCtx(s_pCompressContext, pBuffer + sizeof(coreUint32), iBound, pInput, iInputSize, iLevel);
+    ZSTD_CCtx*      pContext = coreData::__AcquireCompressContext();
+    const coreUintW iWritten = ZSTD_compressCCtx(pContext, pBuffer + sizeof(coreUint32), iBound, pInput, iInputSize, iLevel);
+    coreData::__ReleaseContext(pContext);
+
     WARN_IF(ZSTD_isError(iWritten))
     {
         SAFE_DELETE_ARRAY(pBuffer)
@@ -2512,10 +2548,11 @@ coreStatus coreData::Compress(const coreByte* pInput, const coreUint32 iInputSiz
         return CORE_BUSY;
     }
 
-    const coreLocker oLocker(&s_CompressLock);
-
     // compress data
-    const coreUintW iWritten = ZSTD_compressCCtx(s_pCompressContext, pOutput + sizeof(coreUint32), iBound, pInput, iInputSize, iLevel);
+    ZSTD_CCtx*      pContext = coreData::__AcquireCompressContext();
+    const coreUintW iWritten = ZSTD_compressCCtx(pContext, pOutput + sizeof(coreUint32), iBound, pInput, iInputSize, iLevel);
+    coreData::__ReleaseContext(pContext);
+
     WARN_IF(ZSTD_isError(iWritten))
     {
         Core::Log->Warning("Error compressing data (ZSTD: %s)", ZSTD_getErrorName(iWritten));
@@ -2550,10 +2587,11 @@ coreStatus coreData::Decompress(const coreByte* pInput, const coreUint32 iInputS
     const coreUint32 iBound  = MIN(*r_cast<const coreUint32*>(pInput), iLimit);
     coreByte*        pBuffer = new coreByte[iBound];
 
-    const coreLocker oLocker(&s_DecompressLock);
-
     // decompress data
-    const coreUintW iWritten = ZSTD_decompressDCtx(s_pDecompressContext, pBuffer, iBound, pInput + sizeof(coreUint32), iInputSize - sizeof(coreUint32));
+    ZSTD_DCtx*      pContext = coreData::__AcquireDecompressContext();
+    const coreUintW iWritten = ZSTD_decompressDCtx(pContext, pBuffer, iBound, pInput + sizeof(coreUint32), iInputSize - sizeof(coreUint32));
+    coreData::__ReleaseContext(pContext);
+
     WARN_IF(ZSTD_isError(iWritten) || (iWritten != iBound))
     {
         SAFE_DELETE_ARRAY(pBuffer)
@@ -2569,7 +2607,7 @@ coreStatus coreData::Decompress(const coreByte* pInput, const coreUint32 iInputS
     return CORE_OK;
 }
 
-coreStatus coreData::Decompress(const coreByte* pInput, const coreUint32 iInputSize, coreByte* OUTPUT pOutput, coreUint32* OUTPUT piOutputSize)
+coreStatus coreData::Decompress(const coreByte* pInput, const coreUint32 iInputSize, coreByte* OUTPUT pOutput, coreUint32* OUTPUT piOutputSize, const ZSTD_DDict* pDictionary)
 {
     ASSERT(pInput && iInputSize && piOutputSize)
 
@@ -2591,10 +2629,11 @@ coreStatus coreData::Decompress(const coreByte* pInput, const coreUint32 iInputS
         return CORE_BUSY;
     }
 
-    const coreLocker oLocker(&s_DecompressLock);
-
-    // decompress data
-    const coreUintW iWritten = ZSTD_decompressDCtx(s_pDecompressContext, pOutput, iBound, pInput + sizeof(coreUint32), iInputSize - sizeof(coreUint32));
+    // decompress data (with optional dictionary)
+    ZSTD_DCtx*      pContext = coreData::__AcquireDecompressContext();
+    const coreUintW iWritten = pDictionary ? ZSTD_decompress_usingDDict(pContext, pOutput, iBound, pInput + sizeof(coreUint32), iInputSize - sizeof(coreUint32), pDictionary) :
+                                             ZSTD_decompressDCtx       (pContext, pOutput, iBound, pInput + sizeof(coreUint32), iInputSize - sizeof(coreUint32));
+    coreData::__ReleaseContext(pContext);
     WARN_IF(ZSTD_isError(iWritten) || (iWritten != iBound))
     {
         Core::Log->Warning("Error decompressing data (ZSTD: %s)", ZSTD_getErrorName(iWritten));
@@ -2608,6 +2647,173 @@ coreStatus coreData::Decompress(const coreByte* pInput, const coreUint32 iInputS
 }
 
 
+// ****************************************************************
+/* compress stream with Zstandard library */
+coreStatus coreData::CompressStream(SDL_IOStream* pInput, SDL_IOStream* pOutput, const coreInt32 iLevel)
+{
+    ASSERT(pInput && pOutput && (iLevel >= ZSTD_minCLevel()) && (iLevel <= ZSTD_maxCLevel()))
+
+    // get remaining size from the current position (-1 = unknown)
+    const coreInt64 iFullSize = SDL_GetIOSize(pInput);
+    const coreInt64 iPosition = SDL_TellIO   (pInput);
+    const coreInt64 iRestSize = ((iFullSize >= 0) && (iPosition >= 0) && (iPosition <= iFullSize)) ? (iFullSize - iPosition) : -1;
+
+    // store original size (same layout as regular compression, 0 = unknown or too large)
+    const coreUint32 iSize = ((iRestSize > 0) && (iRestSize <= 0xFFFFFFFF)) ? coreUint32(iRestSize) : 0u;
+    if(SDL_WriteIO(pOutput, &iSize, sizeof(coreUint32)) != sizeof(coreUint32)) return CORE_ERROR_FILE;
+
+    // prepare compression context
+    ZSTD_CCtx* pContext = coreData::__AcquireCompressContext();
+    ZSTD_CCtx_setParameter(pContext, ZSTD_c_compressionLevel, iLevel);
+    if(iRestSize >= 0) ZSTD_CCtx_setPledgedSrcSize(pContext, iRestSize);
+
+    // create stream buffers
+    const coreUintW iInputSize  = ZSTD_CStreamInSize();
+    const coreUintW iOutputSize = ZSTD_CStreamOutSize();
+    coreByte*       pInBuffer   = new coreByte[iInputSize];
+    coreByte*       pOutBuffer  = new coreByte[iOutputSize];
+
+    coreStatus eError = CORE_OK;
+    coreBool   bLast  = false;
+
+    while(!bLast && (eError == CORE_OK))
+    {
+        // read next chunk
+        const coreUintW    iRead   = SDL_ReadIO(pInput, pInBuffer, iInputSize);
+        const SDL_IOStatus eStatus = SDL_GetIOStatus(pInput);
+        if(eStatus == SDL_IO_STATUS_ERROR)
+        {
+            eError = CORE_ERROR_FILE;
+            break;
+        }
+
+        // finish frame on end of stream (short reads are possible before, e.g. on pipes)
+        bLast = (eStatus == SDL_IO_STATUS_EOF);
+        const ZSTD_EndDirective eMode = bLast ? ZSTD_e_end : ZSTD_e_continue;
+
+        ZSTD_inBuffer oIn = {pInBuffer, iRead, 0u};
+        coreBool bDone;
+        do
+        {
+            ZSTD_outBuffer oOut = {pOutBuffer, iOutputSize, 0u};
+
+            // compress chunk
+            const coreUintW iRemaining = ZSTD_compressStream2(pContext, &oOut, &oIn, eMode);
+            WARN_IF(ZSTD_isError(iRemaining))
+            {
+                Core::Log->Warning("Error compressing stream (ZSTD: %s)", ZSTD_getErrorName(iRemaining));
+                eError = CORE_INVALID_DATA;
+                break;
+            }
+
+            // write compressed output
+            if(oOut.pos && (SDL_WriteIO(pOutput, pOutBuffer, oOut.pos) != oOut.pos))
+            {
+                eError = CORE_ERROR_FILE;
+                break;
+            }
+
+            bDone = bLast ? (iRemaining == 0u) : (oIn.pos == oIn.size);
+        }
+        while(!bDone);
+    }
+
+    // delete stream buffers
+    SAFE_DELETE_ARRAY(pInBuffer)
+    SAFE_DELETE_ARRAY(pOutBuffer)
+
+    // reset and return compression context
+    ZSTD_CCtx_reset(pContext, ZSTD_reset_session_and_parameters);
+    coreData::__ReleaseContext(pContext);
+
+    return eError;
+}
+
+
+// ****************************************************************
+/* decompress stream with Zstandard library */
+coreStatus coreData::DecompressStream(SDL_IOStream* pInput, SDL_IOStream* pOutput)
+{
+    ASSERT(pInput && pOutput)
+
+    // skip original size (not required)
+    coreUint32 iSize;
+    if(SDL_ReadIO(pInput, &iSize, sizeof(coreUint32)) != sizeof(coreUint32)) return CORE_INVALID_DATA;
+
+    // prepare decompression context
+    ZSTD_DCtx* pContext = coreData::__AcquireDecompressContext();
+
+    // create stream buffers
+    const coreUintW iInputSize  = ZSTD_DStreamInSize();
+    const coreUintW iOutputSize = ZSTD_DStreamOutSize();
+    coreByte*       pInBuffer   = new coreByte[iInputSize];
+    coreByte*       pOutBuffer  = new coreByte[iOutputSize];
+
+    coreStatus eError = CORE_OK;
+    coreUintW  iHint  = 1u;   // (0 = frame completely decoded)
+
+    while(eError == CORE_OK)
+    {
+        // read next chunk
+        const coreUintW iRead = SDL_ReadIO(pInput, pInBuffer, iInputSize);
+        if(SDL_GetIOStatus(pInput) == SDL_IO_STATUS_ERROR)
+        {
+            eError = CORE_ERROR_FILE;
+            break;
+        }
+
+        if(!iRead) break;
+
+        ZSTD_inBuffer oIn = {pInBuffer, iRead, 0u};
+        while(oIn.pos < oIn.size)
+        {
+            ZSTD_outBuffer oOut = {pOutBuffer, iOutputSize, 0u};
+
+            // decompress chunk
+            iHint = ZSTD_decompressStream(pContext, &oOut, &oIn);
+            WARN_IF(ZSTD_isError(iHint))
+            {
+                Core::Log->Warning("Error decompressing stream (ZSTD: %s)", ZSTD_getErrorName(iHint));
+                eError = CORE_INVALID_DATA;
+                break;
+            }
+
+            // write decompressed output
+            if(oOut.pos && (SDL_WriteIO(pOutput, pOutBuffer, oOut.pos) != oOut.pos))
+            {
+                eError = CORE_ERROR_FILE;
+                break;
+            }
+        }
+    }
+
+    // check for truncated input
+    WARN_IF((eError == CORE_OK) && iHint)
+    {
+        Core::Log->Warning("Error decompressing stream (unexpected end)");
+        eError = CORE_INVALID_DATA;
+    }
+
+    // delete stream buffers
+    SAFE_DELETE_ARRAY(pInBuffer)
+    SAFE_DELETE_ARRAY(pOutBuffer)
+
+    // reset and return decompression context
+    ZSTD_DCtx_reset(pContext, ZSTD_reset_session_only);
+    coreData::__ReleaseContext(pContext);
+
+    return eError;
+}
+
+
+// ****************************************************************
+/* get accumulated time spent waiting on compression locks (in seconds) */
+coreDouble coreData::CompressLockWait()
+{
+    return coreDouble(s_iCompressWait.Get()) / coreDouble(SDL_GetPerformanceFrequency());
+}
+
+
 // ****************************************************************
 /* scramble data with 64-bit key */
 void coreData::Scramble(coreByte* OUTPUT pData, const coreUintW iSize, const coreUint64 iKey)
@@ -2937,4 +3143,93 @@ ONCE_START
 #endif
 
 ONCE_END
+}
+
+
+// ****************************************************************
+/* acquire compression context from the pool */
+ZSTD_CCtx* coreData::__AcquireCompressContext()
+{
+    ZSTD_CCtx* pContext = NULL;
+
+    // take available context
+    coreData::__LockPool(&s_CompressLock);
+    {
+        if(!s_apCompressPool.empty())
+        {
+            pContext = s_apCompressPool.back();
+            s_apCompressPool.pop_back();
+        }
+    }
+    s_CompressLock.Unlock();
+
+    // create new context (outside of the lock)
+    if(!pContext) pContext = ZSTD_createCCtx();
+
+    return pContext;
+}
+
+
+// ****************************************************************
+/* acquire decompression context from the pool */
+ZSTD_DCtx* coreData::__AcquireDecompressContext()
+{
+    ZSTD_DCtx* pContext = NULL;
+
+    // take available context
+    coreData::__LockPool(&s_DecompressLock);
+    {
+        if(!s_apDecompressPool.empty())
+        {
+            pContext = s_apDecompressPool.back();
+            s_apDecompressPool.pop_back();
+        }
+    }
+    s_DecompressLock.Unlock();
+
+    // create new context (outside of the lock)
+    if(!pContext) pContext = ZSTD_createDCtx();
+
+    return pContext;
+}
+
+
+// ****************************************************************
+/* return context to its pool */
+void coreData::__ReleaseContext(ZSTD_CCtx* pContext)
+{
+    ASSERT(pContext)
+
+    coreData::__LockPool(&s_CompressLock);
+    {
+        s_apCompressPool.push_back(pContext);
+    }
+    s_CompressLock.Unlock();
+}
+
+void coreData::__ReleaseContext(ZSTD_DCtx* pContext)
+{
+    ASSERT(pContext)
+
+    coreData::__LockPool(&s_DecompressLock);
+    {
+        s_apDecompressPool.push_back(pContext);
+    }
+    s_DecompressLock.Unlock();
+}
+
+
+// ****************************************************************
+/* acquire pool lock and measure waiting time */
+void coreData::__LockPool(coreLock* pLock)
+{
+    ASSERT(pLock)
+
+    // try without waiting first
+    if(pLock->TryLock()) return;
+
+    // wait and accumulate time
+    const coreUint64 iStart = SDL_GetPerformanceCounter();
+    pLock->Lock();
+    s_iCompressWait.FetchAdd(SDL_GetPerformanceCounter() - iStart);
 }
\ No newline at end of file
@@ -24,7 +24,6 @@
 // TODO 2: find all functions which are not thread-safe and either change them or add a lock (e.g. nftw)
 // TODO 2: improve all the unreliable file and directory checks (sub-paths, separator handling)
 // TODO 4: when to use #else or individual platforms? #else for generic solutions, individual even for posix stuff? (though return-value at the bottom needs adjustment)
-// TODO 3: posix_fadvise(iFileFrom, 0, iLen, POSIX_FADV_SEQUENTIAL);
 
 
 // ****************************************************************
@@ -121,10 +120,11 @@ private:
     static coreMapStrFull<const coreChar*> s_apcCommandLine;   // parsed command line arguments
     static coreString                      s_sUserFolder;      // selected user folder
 
-    static ZSTD_CCtx* s_pCompressContext;                      // reusable compression context
-    static ZSTD_DCtx* s_pDecompressContext;                    // reusable decompression context
-    static coreLock   s_CompressLock;                          // compression context lock
-    static coreLock   s_DecompressLock;                        // decompression context lock
+    static coreList<ZSTD_CCtx*>   s_apCompressPool;            // reusable compression contexts (grows with concurrent usage)
+    static coreList<ZSTD_DCtx*>   s_apDecompressPool;          // reusable decompression contexts (grows with concurrent usage)
+    static coreLock               s_CompressLock;              // compression context pool lock
+    static coreLock               s_DecompressLock;            // decompression context pool lock
+    static coreAtomic<coreUint64> s_iCompressWait;             // accumulated time spent waiting on pool locks (in performance counter ticks)
 
 
 public:
@@ -218,6 +218,7 @@ public:
     static coreStatus    FileDelete       (const coreChar* pcPath);
     static coreStatus    FileMap          (const coreChar* pcPath, const coreInt64 iOffset, const coreInt64 iLength, coreFileMap* OUTPUT pMap);
     static coreStatus    FileUnmap        (const coreFileMap* pMap);
+    static coreStatus    FilePrefetch     (const coreChar* pcPath, const coreInt64 iOffset, const coreInt64 iLength);
     static coreBool      DirectoryExists  (const coreChar* pcPath);
     static coreBool      DirectoryWritable(const coreChar* pcPath);
     static coreStatus    DirectoryCopy    (const coreChar* pcFrom, const coreChar* pcTo);
@@ -243,7 +244,10 @@ public:
     static coreStatus Compress  (const coreByte* pInput, const coreUint32 iInputSize, coreByte** OUTPUT ppOutput, coreUint32* OUTPUT piOutputSize, const coreInt32  iLevel = ZSTD_CLEVEL_DEFAULT);
     static coreStatus Compress  (const coreByte* pInput, const coreUint32 iInputSize, coreByte*  OUTPUT pOutput,  coreUint32* OUTPUT piOutputSize, const coreInt32  iLevel = ZSTD_CLEVEL_DEFAULT);
     static coreStatus Decompress(const coreByte* pInput, const coreUint32 iInputSize, coreByte** OUTPUT ppOutput, coreUint32* OUTPUT piOutputSize, const coreUint32 iLimit = UINT32_MAX);
-    static coreStatus Decompress(const coreByte* pInput, const coreUint32 iInputSize, coreByte*  OUTPUT pOutput,  coreUint32* OUTPUT piOutputSize);
+    static coreStatus Decompress(const coreByte* pInput, const coreUint32 iInputSize, coreByte*  OUTPUT pOutput,  coreUint32* OUTPUT piOutputSize, const ZSTD_DDict* pDictionary = NULL);
+    static coreStatus CompressStream  (SDL_IOStream* pInput, SDL_IOStream* pOutput, const coreInt32 iLevel = ZSTD_CLEVEL_DEFAULT);
+    static coreStatus DecompressStream(SDL_IOStream* pInput, SDL_IOStream* pOutput);
+    static coreDouble CompressLockWait();
     static void       Scramble  (coreByte* OUTPUT pData, const coreUintW iSize, const coreUint64 iKey = 0u);
     static void       Unscramble(coreByte* OUTPUT pData, const coreUintW iSize, const coreUint64 iKey = 0u);
 
@@ -293,6 +297,13 @@ private:
 
     /* get memory mapping alignment */
     static coreUintW __GetMapAlign();
+
+    /* handle compression context pools */
+    static ZSTD_CCtx* __AcquireCompressContext  ();
+    static ZSTD_DCtx* __AcquireDecompressContext();
+    static void       __ReleaseContext          (ZSTD_CCtx* pContext);
+    static void       __ReleaseContext          (ZSTD_DCtx* pContext);
+    static void       __LockPool                (coreLock*  pLock);
 };
 
 
@@ -18,6 +18,10 @@
 /* hash-string definitions */
 #define CORE_HASHSTRING_FUNC coreHashXXH32
 
+#define CORE_STRINGTABLE_CHUNK  (1024u)         // number of entries per chunk
+#define CORE_STRINGTABLE_CHUNKS (4096u)         // max number of chunks (limits the number of interned strings)
+#define CORE_STRINGTABLE_PAGE   (64u * 1024u)   // size of each memory-page with string data
+
 
 // ****************************************************************
 /* hash-string class */
@@ -30,6 +34,7 @@ private:
 
 public:
     constexpr coreHashString(const coreChar* pcString = NULL)noexcept;
+    constexpr coreHashString(const coreUint32 iHash, const coreChar* pcString)noexcept : m_iHash (iHash), m_pcString (pcString) {}
 
     ENABLE_COPY(coreHashString)
 
@@ -42,6 +47,55 @@ public:
 };
 
 
+// ****************************************************************
+/* string-table class (global append-only interning of strings) */
+class coreStringTable final
+{
+public:
+    DISABLE_CONSTRUCTION(coreStringTable)
+
+    /* intern string and return its stable identifier (0 = no string) */
+    static coreUint32 Intern(const coreChar*       pcString);
+    static coreUint32 Intern(const coreHashString& sString);
+
+    /* find already interned string (0 = not interned, does not add the string) */
+    static coreUint32 Find(const coreHashString& sString);
+
+    /* access interned string (without locking) */
+    static const coreChar* GetString(const coreUint32 iID);
+    static coreUint32      GetHash  (const coreUint32 iID);
+    static coreUint32      GetLength(const coreUint32 iID);
+
+    /* get number of interned strings */
+    static coreUint32 GetNum();
+};
+
+
+// ****************************************************************
+/* interned string class */
+class coreInternString final
+{
+private:
+    coreUint32 m_iID;   // string-table identifier
+
+
+public:
+    coreInternString(const coreChar*       pcString = NULL)noexcept : m_iID (coreStringTable::Intern(pcString)) {}
+    coreInternString(const coreHashString& sString)noexcept         : m_iID (coreStringTable::Intern(sString))  {}
+
+    ENABLE_COPY(coreInternString)
+
+    /* convert to hash-string (without hashing again) */
+    inline operator coreHashString ()const {return coreHashString(this->GetHash(), this->GetString());}
+
+    /* get object properties */
+    constexpr const coreUint32& GetID    ()const {return m_iID;}
+    inline const coreChar*      GetString()const {return coreStringTable::GetString(m_iID);}
+    inline coreUint32           GetHash  ()const {return coreStringTable::GetHash  (m_iID);}
+    inline coreUint32           GetLength()const {return coreStringTable::GetLength(m_iID);}
+};
+
+
 // ****************************************************************
 /* constructor */
 constexpr coreHashString::coreHashString(const coreChar* pcString)noexcept
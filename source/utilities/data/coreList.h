@@ -19,24 +19,25 @@
 
 // ****************************************************************
 /* base list container type */
-template <typename T> using coreListBase = std::vector<T>;
+template <typename T, typename M = std::allocator<T>> using coreListBase = std::vector<T, M>;
 
 
 // ****************************************************************
-/* list container class */
-template <typename T> class coreList : public coreListBase<T>
+/* list container class (with optional memory allocator) */
+template <typename T, typename M = std::allocator<T>> class coreList : public coreListBase<T, M>
 {
 private:
     /* internal types */
-    using coreIterator      = coreListBase<T>::iterator;
-    using coreConstIterator = coreListBase<T>::const_iterator;
+    using coreIterator      = coreListBase<T, M>::iterator;
+    using coreConstIterator = coreListBase<T, M>::const_iterator;
 
     /* hide undesired functions */
-    using coreListBase<T>::at;
+    using coreListBase<T, M>::at;
 
 
 public:
     coreList() = default;
+    constexpr explicit coreList(const M& oAllocator)noexcept : coreListBase<T, M> (oAllocator) {}
 
     ENABLE_COPY(coreList)
 
@@ -88,7 +89,7 @@ private:
 
 // ****************************************************************
 /* insert new item (without reallocation check) */
-template <typename T> template <typename... A> constexpr T& coreList<T>::emplace_back_unsafe(A&&... vArgs)
+template <typename T, typename M> template <typename... A> constexpr T& coreList<T, M>::emplace_back_unsafe(A&&... vArgs)
 {
     ASSERT(this->size() < this->capacity())
 
@@ -112,7 +113,7 @@ template <typename T> template <typename... A> constexpr T& coreList<T>::emplace
     }
 }
 
-template <typename T> template <typename... A> constexpr coreList<T>::coreIterator coreList<T>::emplace_unsafe(const coreConstIterator& it, A&&... vArgs)
+template <typename T, typename M> template <typename... A> constexpr coreList<T, M>::coreIterator coreList<T, M>::emplace_unsafe(const coreConstIterator& it, A&&... vArgs)
 {
     ASSERT(this->size() < this->capacity())
 
@@ -159,7 +160,7 @@ template <typename T> template <typename... A> constexpr coreList<T>::coreIterat
 
 // ****************************************************************
 /* remove existing item without compaction */
-template <typename T> constexpr coreList<T>::coreIterator coreList<T>::erase_swap(const coreIterator& it)
+template <typename T, typename M> constexpr coreList<T, M>::coreIterator coreList<T, M>::erase_swap(const coreIterator& it)
 {
     ASSERT(!this->empty())
 
@@ -16,7 +16,7 @@
 // TODO 3: erase and clear strings in coreMapStrFull ?
 // TODO 3: reserve and shrink_to_fit strings in coreMapStrFull ?
 // TODO 3: "deducing this" in C++23, to get rid of the const and non-const variants for at and at_bs (maybe somewhere else too)
-// TODO 3: change m_asStringList to regular list
+// TODO 3: change m_apcStringList to regular list
 // TODO 3: turn into constexpr container
 
 
@@ -24,6 +24,9 @@
 /* map container definitions */
 #define CORE_MAP_INVALID (coreUintW(-1))   // invalid cache index
 
+#define CORE_HASHMAP_EMPTY (0xFFFFFFFFu)   // empty slot in the hash index
+#define CORE_HASHMAP_SLOTS (16u)           // minimum number of slots in the hash index
+
 
 // ****************************************************************
 /* generic map container class */
@@ -178,7 +181,7 @@ template <typename T> using coreMapStrBase = coreMapGen<coreUint32, coreHashStri
 template <typename T> class coreMapStrFull final : public coreMapStrBase<T>
 {
 private:
-    coreMap<coreUint32, coreString> m_asStringList;   // list with original strings
+    coreMap<coreUint32, const coreChar*> m_apcStringList;   // list with original strings (interned)
 
 
 public:
@@ -193,8 +196,8 @@ public:
     inline       T&          bs (const coreHashString& sKey)        {this->__save_string(sKey); return this->coreMapStrBase<T>::         bs (sKey);}
 
     /* control memory allocation */
-    inline void reserve      (const coreUintW iCapacity) {m_asStringList.reserve(iCapacity); this->coreMapStrBase<T>::reserve(iCapacity);}
-    inline void shrink_to_fit()                          {m_asStringList.shrink_to_fit();    this->coreMapStrBase<T>::shrink_to_fit();}
+    inline void reserve      (const coreUintW iCapacity) {m_apcStringList.reserve(iCapacity); this->coreMapStrBase<T>::reserve(iCapacity);}
+    inline void shrink_to_fit()                          {m_apcStringList.shrink_to_fit();    this->coreMapStrBase<T>::shrink_to_fit();}
 
     /* create new entry */
     template <typename... A> inline T& emplace          (const coreHashString& sKey,                                                 A&&... vArgs) {this->__save_string(sKey); return this->coreMapStrBase<T>::emplace          (sKey,     std::forward<A>(vArgs)...);}
@@ -207,16 +210,16 @@ public:
     /* remove existing entry */
     using coreMapStrBase<T>::erase;
     inline coreMapStrBase<T>::coreValueIterator erase(const coreUintW iIndex) {this->_cache_clear(); this->m_atKeyList.erase_index(iIndex); return this->m_atValueList.erase_index(iIndex);}
-    inline void                                 clear()                       {m_asStringList.clear(); this->coreMapStrBase<T>::clear();}
+    inline void                                 clear()                       {m_apcStringList.clear(); this->coreMapStrBase<T>::clear();}
 
     /* return original string */
-    inline const coreChar* get_string(const coreMapStrBase<T>::coreValueIterator&      it)      {return m_asStringList.at_bs(*this->get_key(it)).c_str();}
-    inline const coreChar* get_string(const coreMapStrBase<T>::coreValueConstIterator& it)const {return m_asStringList.at_bs(*this->get_key(it)).c_str();}
+    inline const coreChar* get_string(const coreMapStrBase<T>::coreValueIterator&      it)      {return m_apcStringList.at_bs(*this->get_key(it));}
+    inline const coreChar* get_string(const coreMapStrBase<T>::coreValueConstIterator& it)const {return m_apcStringList.at_bs(*this->get_key(it));}
 
 
 private:
     /* save original string */
-    inline void __save_string(const coreHashString& sKey) {if(!m_asStringList.count_bs(sKey)) m_asStringList.emplace_bs(sKey, sKey.GetString()); ASSERT(m_asStringList.at_bs(sKey) == sKey.GetString())}
+    inline void __save_string(const coreHashString& sKey) {if(!m_apcStringList.count_bs(sKey)) m_apcStringList.emplace_bs(sKey, coreStringTable::GetString(coreStringTable::Intern(sKey))); ASSERT(!std::strcmp(m_apcStringList.at_bs(sKey), sKey.GetString()))}
 };
 
 
@@ -249,6 +252,228 @@ public:
 #endif
 
 
+// ****************************************************************
+/* generic hash map container class (dense entries with open-addressing hash index) */
+template <typename K, typename I, typename T> class coreHashMapGen
+{
+protected:
+    /* internal types */
+    using coreValueList             = coreList<T>;
+    using coreKeyList               = coreList<K>;
+    using coreHashList              = coreList<coreUint32>;
+    using coreValueIterator         = coreValueList::iterator;
+    using coreValueConstIterator    = coreValueList::const_iterator;
+    using coreValueRevIterator      = coreValueList::reverse_iterator;
+    using coreValueConstRevIterator = coreValueList::const_reverse_iterator;
+    using coreKeyIterator           = coreKeyList  ::iterator;
+    using coreKeyConstIterator      = coreKeyList  ::const_iterator;
+
+    /* hash index slot */
+    struct coreSlot final
+    {
+        coreUint32 iIndex;   // index of the entry (or empty)
+        coreUint32 iHash;    // full hash-value of the entry
+    };
+
+
+protected:
+    coreValueList      m_atValueList;   // list with values
+    coreKeyList        m_atKeyList;     // list with keys
+    coreHashList       m_aiHashList;    // list with hash-values (to rehash without touching keys)
+    coreList<coreSlot> m_aSlot;         // hash index with Robin Hood probing (power-of-two size)
+
+
+public:
+    coreHashMapGen()noexcept;
+
+    ENABLE_COPY(coreHashMapGen)
+
+    /* access specific entry */
+    T&              operator [] (const I& tKey);
+    inline T&       bs          (const I& tKey)      {return (*this)[tKey];}
+    T&              at          (const I& tKey);
+    const T&        at          (const I& tKey)const;
+    inline T&       at_bs       (const I& tKey)      {return this->at(tKey);}
+    inline const T& at_bs       (const I& tKey)const {return this->at(tKey);}
+
+    /* check number of existing entries */
+    inline coreBool  count   (const I& tKey)const {return (this->_retrieve(tKey) != CORE_HASHMAP_EMPTY);}
+    inline coreBool  count_bs(const I& tKey)const {return this->count(tKey);}
+    inline coreUintW size    ()const              {return m_atValueList.size ();}
+    inline coreBool  empty   ()const              {return m_atValueList.empty();}
+
+    /* get internal index */
+    inline coreUintW index   (const I& tKey)const                    {const coreUint32 iSlot = this->_retrieve(tKey); return (iSlot != CORE_HASHMAP_EMPTY) ? m_aSlot[iSlot].iIndex : this->size();}
+    inline coreUintW index_bs(const I& tKey)const                    {return this->index(tKey);}
+    inline coreUintW index   (const coreValueIterator&      it)const {return m_atValueList.index(it);}
+    inline coreUintW index   (const coreValueConstIterator& it)const {return m_atValueList.index(it);}
+
+    /* control memory allocation */
+    inline void      reserve      (const coreUintW iCapacity) {m_atValueList.reserve(iCapacity); m_atKeyList.reserve(iCapacity); m_aiHashList.reserve(iCapacity); if(this->_slots(iCapacity) > m_aSlot.size()) this->_rehash(this->_slots(iCapacity));}
+    inline void      shrink_to_fit()                          {m_atValueList.shrink_to_fit();    m_atKeyList.shrink_to_fit();    m_aiHashList.shrink_to_fit();    this->_rehash(this->_slots(this->size())); m_aSlot.shrink_to_fit();}
+    inline coreUintW capacity     ()const                     {return m_atValueList.capacity();}
+
+    /* manage container ordering */
+    inline void sort_asc  () {if(!this->empty()) this->_sort([](const K& a, const K& b) {return (a < b);});}
+    inline void sort_desc () {if(!this->empty()) this->_sort([](const K& a, const K& b) {return (a > b);});}
+    inline void reverse   () {std::reverse(m_atValueList.begin(), m_atValueList.end()); std::reverse(m_atKeyList.begin(), m_atKeyList.end()); std::reverse(m_aiHashList.begin(), m_aiHashList.end()); this->_rehash(m_aSlot.size());}
+    inline void prepare_bs() {}
+
+    /* create new entry */
+    template <typename... A> T&        emplace          (const I& tKey, A&&... vArgs) {return this->emplace(std::move(I(tKey)), std::forward<A>(vArgs)...);}
+    template <typename... A> T&        emplace          (I&&      tKey, A&&... vArgs);
+    template <typename... A> inline T& emplace_unsafe   (const I& tKey, A&&... vArgs) {return this->emplace(tKey,            std::forward<A>(vArgs)...);}
+    template <typename... A> inline T& emplace_unsafe   (I&&      tKey, A&&... vArgs) {return this->emplace(std::move(tKey), std::forward<A>(vArgs)...);}
+    template <typename... A> inline T& emplace_bs       (const I& tKey, A&&... vArgs) {return this->emplace(tKey,            std::forward<A>(vArgs)...);}
+    template <typename... A> inline T& emplace_bs       (I&&      tKey, A&&... vArgs) {return this->emplace(std::move(tKey), std::forward<A>(vArgs)...);}
+    template <typename... A> inline T& emplace_bs_unsafe(const I& tKey, A&&... vArgs) {return this->emplace(tKey,            std::forward<A>(vArgs)...);}
+    template <typename... A> inline T& emplace_bs_unsafe(I&&      tKey, A&&... vArgs) {return this->emplace(std::move(tKey), std::forward<A>(vArgs)...);}
+
+    /* remove existing entry (last entry is moved into the gap) */
+    coreBool                 erase   (const I& tKey);
+    inline coreBool          erase_bs(const I& tKey)               {return this->erase(tKey);}
+    inline coreValueIterator erase   (const coreValueIterator& it) {const coreUintW iIndex = this->index(it); this->_erase_entry(this->_find_slot(iIndex)); return m_atValueList.begin() + iIndex;}
+    inline void              clear   ()                            {m_atValueList.clear(); m_atKeyList.clear(); m_aiHashList.clear(); std::fill(m_aSlot.begin(), m_aSlot.end(), coreSlot{CORE_HASHMAP_EMPTY, 0u});}
+    inline void              pop_back()                            {this->erase(m_atValueList.end() - 1u);}
+
+    /* return first and last entry */
+    inline T&       front()      {return m_atValueList.front();}
+    inline const T& front()const {return m_atValueList.front();}
+    inline T&       back ()      {return m_atValueList.back ();}
+    inline const T& back ()const {return m_atValueList.back ();}
+
+    /* return internal iterator */
+    inline coreValueIterator         begin  ()                   {return m_atValueList.begin ();}
+    inline coreValueConstIterator    begin  ()const              {return m_atValueList.begin ();}
+    inline coreValueIterator         end    ()                   {return m_atValueList.end   ();}
+    inline coreValueConstIterator    end    ()const              {return m_atValueList.end   ();}
+    inline coreValueRevIterator      rbegin ()                   {return m_atValueList.rbegin();}
+    inline coreValueConstRevIterator rbegin ()const              {return m_atValueList.rbegin();}
+    inline coreValueRevIterator      rend   ()                   {return m_atValueList.rend  ();}
+    inline coreValueConstRevIterator rend   ()const              {return m_atValueList.rend  ();}
+    inline coreValueIterator         find   (const I& tKey)      {return m_atValueList.begin() + this->index(tKey);}
+    inline coreValueConstIterator    find   (const I& tKey)const {return m_atValueList.begin() + this->index(tKey);}
+    inline coreValueIterator         find_bs(const I& tKey)      {return this->find(tKey);}
+    inline coreValueConstIterator    find_bs(const I& tKey)const {return this->find(tKey);}
+
+    /* operate between values and keys */
+    inline coreValueIterator      get_value    (const coreKeyIterator&        it)      {return m_atValueList.begin() + m_atKeyList  .index(it);}
+    inline coreValueConstIterator get_value    (const coreKeyConstIterator&   it)const {return m_atValueList.begin() + m_atKeyList  .index(it);}
+    inline coreKeyIterator        get_key      (const coreValueIterator&      it)      {return m_atKeyList  .begin() + m_atValueList.index(it);}
+    inline coreKeyConstIterator   get_key      (const coreValueConstIterator& it)const {return m_atKeyList  .begin() + m_atValueList.index(it);}
+    inline coreValueList&         get_valuelist()                                      {return m_atValueList;}
+    inline const coreValueList&   get_valuelist()const                                 {return m_atValueList;}
+    inline const coreKeyList&     get_keylist  ()const                                 {return m_atKeyList;}
+
+
+protected:
+    /* calculate hash-value of a key */
+    static inline coreUint32 _hash(const K& tKey);
+
+    /* convert lookup key to stored key */
+    static constexpr decltype(auto) _convert(const I& tKey);
+
+    /* lookup slot by key or by entry index */
+    coreUint32 _retrieve (const I& tKey)const;
+    coreUint32 _find_slot(const coreUintW iIndex)const;
+
+    /* handle hash index */
+    void _insert_slot(const coreUint32 iIndex, const coreUint32 iHash);
+    void _erase_slot (const coreUint32 iSlot);
+    void _erase_entry(const coreUint32 iSlot);
+    void _rehash     (const coreUintW iNumSlots);
+    static constexpr coreUintW _slots(const coreUintW iCapacity) {return MAX(coreMath::CeilPot(iCapacity + iCapacity / 3u + 1u), CORE_HASHMAP_SLOTS);}
+
+    /* sort entries with comparison function */
+    template <typename F> void _sort(F&& nCompareFunc);   // [](const K& a, const K& b) -> coreBool
+};
+
+
+// ****************************************************************
+/* simplified generic hash map container type */
+template <typename K, typename T> using coreHashMap = coreHashMapGen<K, K, T>;
+
+
+// ****************************************************************
+/* base string hash map container type */
+template <typename T> using coreHashMapStrBase = coreHashMapGen<coreUint32, coreHashString, T>;
+
+
+// ****************************************************************
+/* string hash map container class (with original strings) */
+template <typename T> class coreHashMapStrFull final : public coreHashMapStrBase<T>
+{
+private:
+    coreHashMap<coreUint32, const coreChar*> m_apcStringList;   // list with original strings (interned)
+
+
+public:
+    coreHashMapStrFull() = default;
+
+    ENABLE_COPY(coreHashMapStrFull)
+
+    /* access specific entry */
+    inline       T& operator [] (const coreUintW       iIndex)      {ASSERT(iIndex < this->size()) return this->m_atValueList[iIndex];}
+    inline const T& operator [] (const coreUintW       iIndex)const {ASSERT(iIndex < this->size()) return this->m_atValueList[iIndex];}
+    inline       T& operator [] (const coreHashString& sKey)        {this->__save_string(sKey); return this->coreHashMapStrBase<T>::operator [] (sKey);}
+    inline       T&          bs (const coreHashString& sKey)        {this->__save_string(sKey); return this->coreHashMapStrBase<T>::         bs (sKey);}
+
+    /* create new entry */
+    template <typename... A> inline T& emplace          (const coreHashString& sKey, A&&... vArgs) {this->__save_string(sKey); return this->coreHashMapStrBase<T>::emplace(sKey, std::forward<A>(vArgs)...);}
+    template <typename... A> inline T& emplace_unsafe   (const coreHashString& sKey, A&&... vArgs) {this->__save_string(sKey); return this->coreHashMapStrBase<T>::emplace(sKey, std::forward<A>(vArgs)...);}
+    template <typename... A> inline T& emplace_bs       (const coreHashString& sKey, A&&... vArgs) {this->__save_string(sKey); return this->coreHashMapStrBase<T>::emplace(sKey, std::forward<A>(vArgs)...);}
+    template <typename... A> inline T& emplace_bs_unsafe(const coreHashString& sKey, A&&... vArgs) {this->__save_string(sKey); return this->coreHashMapStrBase<T>::emplace(sKey, std::forward<A>(vArgs)...);}
+
+    /* remove existing entry */
+    using coreHashMapStrBase<T>::erase;
+    inline coreHashMapStrBase<T>::coreValueIterator erase(const coreUintW iIndex) {ASSERT(iIndex < this->size()) return this->erase(this->begin() + iIndex);}
+    inline void                                     clear()                       {m_apcStringList.clear(); this->coreHashMapStrBase<T>::clear();}
+
+    /* return original string */
+    inline const coreChar* get_string(const coreHashMapStrBase<T>::coreValueIterator&      it)      {return m_apcStringList.at(*this->get_key(it));}
+    inline const coreChar* get_string(const coreHashMapStrBase<T>::coreValueConstIterator& it)const {return m_apcStringList.at(*this->get_key(it));}
+
+
+private:
+    /* save original string */
+    inline void __save_string(const coreHashString& sKey) {if(!m_apcStringList.count(sKey)) m_apcStringList.emplace(sKey, coreStringTable::GetString(coreStringTable::Intern(sKey))); ASSERT(!std::strcmp(m_apcStringList.at(sKey), sKey.GetString()))}
+};
+
+
+// ****************************************************************
+/* string hash map container class (without original strings) */
+template <typename T> class coreHashMapStrSlim final : public coreHashMapStrBase<T>
+{
+public:
+    coreHashMapStrSlim() = default;
+
+    ENABLE_COPY(coreHashMapStrSlim)
+
+    /* access specific entry */
+    using coreHashMapStrBase<T>::operator [];
+    inline       T& operator [] (const coreUintW iIndex)      {ASSERT(iIndex < this->size()) return this->m_atValueList[iIndex];}
+    inline const T& operator [] (const coreUintW iIndex)const {ASSERT(iIndex < this->size()) return this->m_atValueList[iIndex];}
+
+    /* remove existing entry */
+    using coreHashMapStrBase<T>::erase;
+    inline coreHashMapStrBase<T>::coreValueIterator erase(const coreUintW iIndex) {ASSERT(iIndex < this->size()) return this->erase(this->begin() + iIndex);}
+};
+
+
+// ****************************************************************
+/* interned string hash map container type (key is the string-table identifier) */
+template <typename T> using coreHashMapIntern = coreHashMapGen<coreUint32, coreInternString, T>;
+
+
+// ****************************************************************
+/* simplified string hash map container type */
+#if defined(_CORE_DEBUG_)
+    template <typename T> using coreHashMapStr = coreHashMapStrFull<T>;
+#else
+    template <typename T> using coreHashMapStr = coreHashMapStrSlim<T>;
+#endif
+
+
 // ****************************************************************
 /* constructor */
 template <typename K, typename I, typename T> coreMapGen<K, I, T>::coreMapGen()noexcept
@@ -615,4 +840,300 @@ template <typename K, typename I, typename T> template <typename F> void coreMap
 }
 
 
+// ****************************************************************
+/* constructor */
+template <typename K, typename I, typename T> coreHashMapGen<K, I, T>::coreHashMapGen()noexcept
+: m_atValueList {}
+, m_atKeyList   {}
+, m_aiHashList  {}
+, m_aSlot       {}
+{
+}
+
+
+// ****************************************************************
+/* access specific entry and create it if necessary */
+template <typename K, typename I, typename T> T& coreHashMapGen<K, I, T>::operator [] (const I& tKey)
+{
+    // lookup entry by key
+    const coreUint32 iSlot = this->_retrieve(tKey);
+    if(iSlot == CORE_HASHMAP_EMPTY)
+    {
+        // create new entry
+        return this->emplace(tKey);
+    }
+
+    return m_atValueList[m_aSlot[iSlot].iIndex];
+}
+
+
+// ****************************************************************
+/* access specific entry */
+template <typename K, typename I, typename T> T& coreHashMapGen<K, I, T>::at(const I& tKey)
+{
+    // lookup entry by key
+    const coreUint32 iSlot = this->_retrieve(tKey);
+    ASSERT(iSlot != CORE_HASHMAP_EMPTY)
+
+    return m_atValueList[m_aSlot[iSlot].iIndex];
+}
+
+template <typename K, typename I, typename T> const T& coreHashMapGen<K, I, T>::at(const I& tKey)const
+{
+    // lookup entry by key
+    const coreUint32 iSlot = this->_retrieve(tKey);
+    ASSERT(iSlot != CORE_HASHMAP_EMPTY)
+
+    return m_atValueList[m_aSlot[iSlot].iIndex];
+}
+
+
+// ****************************************************************
+/* create new entry */
+template <typename K, typename I, typename T> template <typename... A> T& coreHashMapGen<K, I, T>::emplace(I&& tKey, A&&... vArgs)
+{
+    ASSERT(!this->count(tKey) && (this->size() < CORE_HASHMAP_EMPTY))
+
+    // grow hash index (max load factor of 0.75)
+    if((this->size() + 1u) * 4u > m_aSlot.size() * 3u) this->_rehash(MAX(m_aSlot.size() * 2u, CORE_HASHMAP_SLOTS));
+
+    // create new entry
+    T& tValue = m_atValueList.emplace_back(std::forward<A>(vArgs)...);
+    if constexpr(std::is_same_v<K, I>) m_atKeyList.push_back(std::move(tKey));
+                                  else m_atKeyList.push_back(coreHashMapGen::_convert(tKey));
+
+    // insert entry into hash index
+    const coreUint32 iHash = coreHashMapGen::_hash(m_atKeyList.back());
+    m_aiHashList.push_back(iHash);
+    this->_insert_slot(m_atValueList.size() - 1u, iHash);
+
+    return tValue;
+}
+
+
+// ****************************************************************
+/* remove existing entry */
+template <typename K, typename I, typename T> coreBool coreHashMapGen<K, I, T>::erase(const I& tKey)
+{
+    // lookup entry by key
+    const coreUint32 iSlot = this->_retrieve(tKey);
+    if(iSlot != CORE_HASHMAP_EMPTY)
+    {
+        // remove existing entry
+        this->_erase_entry(iSlot);
+        return true;
+    }
+
+    return false;
+}
+
+
+// ****************************************************************
+/* calculate hash-value of a key */
+template <typename K, typename I, typename T> inline coreUint32 coreHashMapGen<K, I, T>::_hash(const K& tKey)
+{
+    if constexpr(std::is_same_v<K, coreString>)
+    {
+        // hash string content
+        return coreHashMurmur32(r_cast<const coreByte*>(tKey.data()), tKey.size());
+    }
+    else if constexpr(std::is_integral_v<K> || std::is_enum_v<K> || std::is_pointer_v<K>)
+    {
+        // mix all bits of the value (also required for hash-strings, which only use the lower bits in the index)
+        coreUint64 iValue;
+        if constexpr(std::is_pointer_v<K>) iValue = P_TO_UI(tKey);
+                                      else iValue = coreUint64(tKey);
+
+        iValue ^= iValue >> 33u;
+        iValue *= 0xFF51AFD7ED558CCDu;
+        iValue ^= iValue >> 33u;
+        iValue *= 0xC4CEB9FE1A85EC53u;
+        iValue ^= iValue >> 33u;
+
+        return coreUint32(iValue);
+    }
+    else
+    {
+        // hash object representation
+        STATIC_ASSERT(std::has_unique_object_representations_v<K>)
+        return coreHashMurmur32(r_cast<const coreByte*>(&tKey), sizeof(K));
+    }
+}
+
+
+// ****************************************************************
+/* convert lookup key to stored key */
+template <typename K, typename I, typename T> constexpr decltype(auto) coreHashMapGen<K, I, T>::_convert(const I& tKey)
+{
+         if constexpr(std::is_same_v<K, I>)                return (tKey);         // same type (without copy)
+    else if constexpr(std::is_same_v<I, coreInternString>) return tKey.GetID();   // string-table identifier (no implicit conversion)
+    else                                                   return K(tKey);
+}
+
+
+// ****************************************************************
+/* lookup slot by key */
+template <typename K, typename I, typename T> coreUint32 coreHashMapGen<K, I, T>::_retrieve(const I& tKey)const
+{
+    if(m_aSlot.empty()) return CORE_HASHMAP_EMPTY;
+
+    // convert to stored key type
+    const K& tConverted = coreHashMapGen::_convert(tKey);
+
+    const coreUint32 iHash = coreHashMapGen::_hash(tConverted);
+    const coreUint32 iMask = m_aSlot.size() - 1u;
+
+    for(coreUint32 iPos = iHash & iMask, iDist = 0u; ; iPos = (iPos + 1u) & iMask, ++iDist)
+    {
+        const coreSlot& oSlot = m_aSlot[iPos];
+
+        // stop at empty slot or at entry closer to its home slot (Robin Hood invariant)
+        if(oSlot.iIndex == CORE_HASHMAP_EMPTY)     return CORE_HASHMAP_EMPTY;
+        if(((iPos - oSlot.iHash) & iMask) < iDist) return CORE_HASHMAP_EMPTY;
+
+        // compare hash-value first (to skip expensive key comparisons)
+        if((oSlot.iHash == iHash) && (m_atKeyList[oSlot.iIndex] == tConverted)) return iPos;
+    }
+}
+
+
+// ****************************************************************
+/* lookup slot by entry index */
+template <typename K, typename I, typename T> coreUint32 coreHashMapGen<K, I, T>::_find_slot(const coreUintW iIndex)const
+{
+    ASSERT(iIndex < this->size())
+
+    const coreUint32 iMask = m_aSlot.size() - 1u;
+
+    for(coreUint32 iPos = m_aiHashList[iIndex] & iMask; ; iPos = (iPos + 1u) & iMask)
+    {
+        if(m_aSlot[iPos].iIndex == iIndex) return iPos;
+    }
+}
+
+
+// ****************************************************************
+/* insert entry into hash index */
+template <typename K, typename I, typename T> void coreHashMapGen<K, I, T>::_insert_slot(const coreUint32 iIndex, const coreUint32 iHash)
+{
+    const coreUint32 iMask = m_aSlot.size() - 1u;
+
+    coreSlot oCurrent = {iIndex, iHash};
+
+    for(coreUint32 iPos = iHash & iMask, iDist = 0u; ; iPos = (iPos + 1u) & iMask, ++iDist)
+    {
+        coreSlot& oSlot = m_aSlot[iPos];
+
+        // place entry into empty slot
+        if(oSlot.iIndex == CORE_HASHMAP_EMPTY)
+        {
+            oSlot = oCurrent;
+            return;
+        }
+
+        // displace entries closer to their home slot
+        const coreUint32 iOther = (iPos - oSlot.iHash) & iMask;
+        if(iOther < iDist)
+        {
+            std::swap(oSlot, oCurrent);
+            iDist = iOther;
+        }
+    }
+}
+
+
+// ****************************************************************
+/* remove entry from hash index */
+template <typename K, typename I, typename T> void coreHashMapGen<K, I, T>::_erase_slot(const coreUint32 iSlot)
+{
+    const coreUint32 iMask = m_aSlot.size() - 1u;
+
+    // shift following entries back (instead of using tombstones)
+    coreUint32 iPos  = iSlot;
+    coreUint32 iNext = (iPos + 1u) & iMask;
+    while((m_aSlot[iNext].iIndex != CORE_HASHMAP_EMPTY) && ((iNext - m_aSlot[iNext].iHash) & iMask))
+    {
+        m_aSlot[iPos] = m_aSlot[iNext];
+
+        iPos  = iNext;
+        iNext = (iNext + 1u) & iMask;
+    }
+
+    m_aSlot[iPos].iIndex = CORE_HASHMAP_EMPTY;
+}
+
+
+// ****************************************************************
+/* remove entry from lists and hash index */
+template <typename K, typename I, typename T> void coreHashMapGen<K, I, T>::_erase_entry(const coreUint32 iSlot)
+{
+    const coreUint32 iIndex = m_aSlot[iSlot].iIndex;
+    const coreUint32 iLast  = this->size() - 1u;
+
+    this->_erase_slot(iSlot);
+
+    if(iIndex != iLast)
+    {
+        // move last entry into the gap
+        m_aSlot[this->_find_slot(iLast)].iIndex = iIndex;
+
+        m_atValueList[iIndex] = std::move(m_atValueList[iLast]);
+        m_atKeyList  [iIndex] = std::move(m_atKeyList  [iLast]);
+        m_aiHashList [iIndex] = m_aiHashList[iLast];
+    }
+
+    m_atValueList.pop_back();
+    m_atKeyList  .pop_back();
+    m_aiHashList .pop_back();
+}
+
+
+// ****************************************************************
+/* rebuild hash index */
+template <typename K, typename I, typename T> void coreHashMapGen<K, I, T>::_rehash(const coreUintW iNumSlots)
+{
+    ASSERT(coreMath::IsPot(iNumSlots) && (iNumSlots * 3u >= this->size() * 4u))
+
+    // clear all slots
+    m_aSlot.assign(iNumSlots, coreSlot{CORE_HASHMAP_EMPTY, 0u});
+
+    // insert all entries with stored hash-values
+    for(coreUintW i = 0u, ie = this->size(); i < ie; ++i)
+    {
+        this->_insert_slot(i, m_aiHashList[i]);
+    }
+}
+
+
+// ****************************************************************
+/* sort entries with comparison function */
+template <typename K, typename I, typename T> template <typename F> void coreHashMapGen<K, I, T>::_sort(F&& nCompareFunc)
+{
+    ASSERT(!this->empty())
+
+    // sort entry indices
+    coreList<coreUint32> aiOrder;
+    aiOrder.resize(this->size());
+    for(coreUintW i = 0u, ie = aiOrder.size(); i < ie; ++i) aiOrder[i] = i;
+    std::sort(aiOrder.begin(), aiOrder.end(), [&](const coreUint32 a, const coreUint32 b) {return nCompareFunc(m_atKeyList[a], m_atKeyList[b]);});
+
+    // reorder all lists
+    coreValueList atValueList; atValueList.reserve(aiOrder.size());
+    coreKeyList   atKeyList;   atKeyList  .reserve(aiOrder.size());
+    coreHashList  aiHashList;  aiHashList .reserve(aiOrder.size());
+    FOR_EACH(it, aiOrder)
+    {
+        atValueList.push_back(std::move(m_atValueList[*it]));
+        atKeyList  .push_back(std::move(m_atKeyList  [*it]));
+        aiHashList .push_back(m_aiHashList[*it]);
+    }
+    m_atValueList = std::move(atValueList);
+    m_atKeyList   = std::move(atKeyList);
+    m_aiHashList  = std::move(aiHashList);
+
+    // rebuild hash index
+    this->_rehash(m_aSlot.size());
+}
+
+
 #endif /* _CORE_GUARD_MAP_H_ */
\ No newline at end of file
@@ -9,6 +9,206 @@
 #include "Core.h"
 
 
+// ****************************************************************
+/* string-table entry */
+struct coreStringEntry final
+{
+    const coreChar* pcString;   // interned string (stable pointer)
+    coreUint32      iHash;      // hash-value of the string
+    coreUint32      iLength;    // length of the string
+};
+
+
+// ****************************************************************
+/* string-table data */
+static struct coreStringTableData final
+{
+    coreStringEntry*     apChunk[CORE_STRINGTABLE_CHUNKS];   // chunks with entries (never moved, to allow access without locking)
+    coreList<coreChar*>  apcPage;                            // memory-pages with string data
+    coreUintW            iPageUsed;                          // used memory in the current memory-page
+    coreList<coreUint32> aiIndex;                            // open-addressing hash index with identifiers (0 = empty)
+    coreUint32           iNum;                               // number of interned strings
+    coreSharedLock       oLock;                              // lock for interning strings
+
+    ~coreStringTableData()
+    {
+        // delete all chunks and memory-pages
+        for(coreUintW i = 0u; i < CORE_STRINGTABLE_CHUNKS; ++i) SAFE_DELETE_ARRAY(apChunk[i])
+        FOR_EACH(it, apcPage) SAFE_DELETE_ARRAY(*it)
+    }
+}
+s_StringTable = {};
+
+
+// ****************************************************************
+/* get string-table entry */
+static coreStringEntry& GetStringEntry(const coreUint32 iID)
+{
+    ASSERT(iID && s_StringTable.apChunk[(iID - 1u) / CORE_STRINGTABLE_CHUNK])
+    return s_StringTable.apChunk[(iID - 1u) / CORE_STRINGTABLE_CHUNK][(iID - 1u) % CORE_STRINGTABLE_CHUNK];
+}
+
+
+// ****************************************************************
+/* find interned string in the hash index */
+static coreUint32 FindStringEntry(const coreChar* pcString, const coreUint32 iHash)
+{
+    if(s_StringTable.aiIndex.empty()) return 0u;
+
+    const coreUint32 iMask = s_StringTable.aiIndex.size() - 1u;
+
+    for(coreUint32 iPos = iHash & iMask; ; iPos = (iPos + 1u) & iMask)
+    {
+        const coreUint32 iID = s_StringTable.aiIndex[iPos];
+        if(!iID) return 0u;
+
+        // compare hash-value first (to skip string comparisons)
+        const coreStringEntry& oEntry = GetStringEntry(iID);
+        if((oEntry.iHash == iHash) && !std::strcmp(oEntry.pcString, pcString)) return iID;
+    }
+}
+
+
+// ****************************************************************
+/* insert identifier into the hash index */
+static void IndexStringEntry(const coreUint32 iID)
+{
+    const coreUint32 iMask = s_StringTable.aiIndex.size() - 1u;
+
+    for(coreUint32 iPos = GetStringEntry(iID).iHash & iMask; ; iPos = (iPos + 1u) & iMask)
+    {
+        if(!s_StringTable.aiIndex[iPos])
+        {
+            s_StringTable.aiIndex[iPos] = iID;
+            return;
+        }
+    }
+}
+
+
+// ****************************************************************
+/* add new string to the string-table */
+static coreUint32 AddStringEntry(const coreChar* pcString, const coreUint32 iHash)
+{
+    WARN_IF(s_StringTable.iNum >= CORE_STRINGTABLE_CHUNK * CORE_STRINGTABLE_CHUNKS) return 0u;
+
+    const coreUintW iLength = std::strlen(pcString);
+
+    // create new memory-page (large strings get their own)
+    if(s_StringTable.apcPage.empty() || (s_StringTable.iPageUsed + iLength + 1u > CORE_STRINGTABLE_PAGE))
+    {
+        s_StringTable.apcPage.push_back(new coreChar[MAX(iLength + 1u, CORE_STRINGTABLE_PAGE)]);
+        s_StringTable.iPageUsed = 0u;
+    }
+
+    // copy string data
+    coreChar* pcCopy = s_StringTable.apcPage.back() + s_StringTable.iPageUsed;
+    std::memcpy(pcCopy, pcString, iLength + 1u);
+    s_StringTable.iPageUsed += iLength + 1u;
+
+    // create new chunk
+    const coreUint32 iID    = s_StringTable.iNum + 1u;
+    const coreUintW  iChunk = (iID - 1u) / CORE_STRINGTABLE_CHUNK;
+    if(!s_StringTable.apChunk[iChunk]) s_StringTable.apChunk[iChunk] = new coreStringEntry[CORE_STRINGTABLE_CHUNK];
+
+    // write entry before publishing the identifier
+    s_StringTable.apChunk[iChunk][(iID - 1u) % CORE_STRINGTABLE_CHUNK] = {pcCopy, iHash, coreUint32(iLength)};
+    s_StringTable.iNum = iID;
+
+    // grow hash index (max load factor of 0.5)
+    if(iID * 2u > s_StringTable.aiIndex.size())
+    {
+        s_StringTable.aiIndex.assign(MAX(s_StringTable.aiIndex.size() * 2u, 1024u), 0u);
+        for(coreUint32 i = 1u; i < iID; ++i) IndexStringEntry(i);
+    }
+    IndexStringEntry(iID);
+
+    return iID;
+}
+
+
+// ****************************************************************
+/* intern string and return its stable identifier */
+static coreUint32 InternString(const coreChar* pcString, const coreUint32 iHash)
+{
+    if(!pcString) return 0u;
+
+    // lookup existing string (shared)
+    s_StringTable.oLock.LockRead();
+    {
+        const coreUint32 iID = FindStringEntry(pcString, iHash);
+        s_StringTable.oLock.UnlockRead();
+
+        if(iID) return iID;
+    }
+
+    // lookup again and add new string (exclusive)
+    s_StringTable.oLock.LockWrite();
+    {
+        coreUint32 iID = FindStringEntry(pcString, iHash);
+        if(!iID) iID = AddStringEntry(pcString, iHash);
+        s_StringTable.oLock.UnlockWrite();
+
+        return iID;
+    }
+}
+
+coreUint32 coreStringTable::Intern(const coreChar* pcString)
+{
+    return InternString(pcString, pcString ? CORE_HASHSTRING_FUNC(pcString) : 0u);
+}
+
+coreUint32 coreStringTable::Intern(const coreHashString& sString)
+{
+    return InternString(sString.GetString(), sString.GetHash());
+}
+
+
+// ****************************************************************
+/* find already interned string */
+coreUint32 coreStringTable::Find(const coreHashString& sString)
+{
+    if(!sString.GetString()) return 0u;
+
+    // lookup existing string (shared)
+    s_StringTable.oLock.LockRead();
+    const coreUint32 iID = FindStringEntry(sString.GetString(), sString.GetHash());
+    s_StringTable.oLock.UnlockRead();
+
+    return iID;
+}
+
+
+// ****************************************************************
+/* access interned string */
+const coreChar* coreStringTable::GetString(const coreUint32 iID)
+{
+    return iID ? GetStringEntry(iID).pcString : "";
+}
+
+coreUint32 coreStringTable::GetHash(const coreUint32 iID)
+{
+    return iID ? GetStringEntry(iID).iHash : 0u;
+}
+
+coreUint32 coreStringTable::GetLength(const coreUint32 iID)
+{
+    return iID ? GetStringEntry(iID).iLength : 0u;
+}
+
+
+// ****************************************************************
+/* get number of interned strings */
+coreUint32 coreStringTable::GetNum()
+{
+    s_StringTable.oLock.LockRead();
+    const coreUint32 iNum = s_StringTable.iNum;
+    s_StringTable.oLock.UnlockRead();
+
+    return iNum;
+}
+
+
 // ****************************************************************
 /* destructor */
 coreWorkString::~coreWorkString()
@@ -16,54 +16,57 @@
 
 // ****************************************************************
 /* base string type */
-using coreStringBase = std::string;
+template <typename M = std::allocator<coreChar>> using coreStringBase = std::basic_string<coreChar, std::char_traits<coreChar>, M>;
 
 
 // ****************************************************************
-/* string class */
-class coreString final : public coreStringBase
+/* string class (with optional memory allocator) */
+template <typename M> class coreStringAlloc final : public coreStringBase<M>
 {
 public:
-    coreString() = default;
-    constexpr coreString(const coreChar* pcText)noexcept                       : coreStringBase (pcText ? pcText : "")       {}
-    constexpr coreString(const coreChar* pcText, const coreUintW iNum)noexcept : coreStringBase (pcText ? pcText : "", iNum) {}
-    constexpr coreString(const coreUintW iNum, const coreChar cChar)noexcept   : coreStringBase (iNum, cChar)                {}
-    constexpr coreString(coreStringBase&& m)noexcept                           : coreStringBase (std::move(m))               {}
+    coreStringAlloc() = default;
+    constexpr coreStringAlloc(const coreChar* pcText)noexcept                       : coreStringBase<M> (pcText ? pcText : "")       {}
+    constexpr coreStringAlloc(const coreChar* pcText, const coreUintW iNum)noexcept : coreStringBase<M> (pcText ? pcText : "", iNum) {}
+    constexpr coreStringAlloc(const coreUintW iNum, const coreChar cChar)noexcept   : coreStringBase<M> (iNum, cChar)                {}
+    constexpr coreStringAlloc(coreStringBase<M>&& m)noexcept                        : coreStringBase<M> (std::move(m))               {}
+    constexpr explicit coreStringAlloc(const M& oAllocator)noexcept                 : coreStringBase<M> (oAllocator)                 {}
 
-    ENABLE_COPY(coreString)
+    ENABLE_COPY(coreStringAlloc)
 
     /* assign new string */
-    using coreStringBase::assign;
-    constexpr coreString& assign(const coreChar* pcText)                       {this->coreStringBase::assign(pcText ? pcText : "");       return *this;}
-    constexpr coreString& assign(const coreChar* pcText, const coreUintW iNum) {this->coreStringBase::assign(pcText ? pcText : "", iNum); return *this;}
+    using coreStringBase<M>::assign;
+    constexpr coreStringAlloc& assign(const coreChar* pcText)                       {this->coreStringBase<M>::assign(pcText ? pcText : "");       return *this;}
+    constexpr coreStringAlloc& assign(const coreChar* pcText, const coreUintW iNum) {this->coreStringBase<M>::assign(pcText ? pcText : "", iNum); return *this;}
 
     /* append new string */
-    using coreStringBase::append;
-    constexpr coreString& append(const coreChar* pcText)                       {this->coreStringBase::append(pcText ? pcText : "");       return *this;}
-    constexpr coreString& append(const coreChar* pcText, const coreUintW iNum) {this->coreStringBase::append(pcText ? pcText : "", iNum); return *this;}
+    using coreStringBase<M>::append;
+    constexpr coreStringAlloc& append(const coreChar* pcText)                       {this->coreStringBase<M>::append(pcText ? pcText : "");       return *this;}
+    constexpr coreStringAlloc& append(const coreChar* pcText, const coreUintW iNum) {this->coreStringBase<M>::append(pcText ? pcText : "", iNum); return *this;}
 
     /* append new string with operator */
-    using coreStringBase::operator +=;
-    constexpr coreString& operator += (const coreChar* pcText) {return this->append(pcText);}
+    using coreStringBase<M>::operator +=;
+    constexpr coreStringAlloc& operator += (const coreChar* pcText) {return this->append(pcText);}
 
     /* prepend new string */
-    constexpr coreString& prepend(const coreChar* pcText)                       {this->insert(0u, pcText);       return *this;}
-    constexpr coreString& prepend(const coreChar* pcText, const coreUintW iNum) {this->insert(0u, pcText, iNum); return *this;}
+    constexpr coreStringAlloc& prepend(const coreChar* pcText)                       {this->insert(0u, pcText);       return *this;}
+    constexpr coreStringAlloc& prepend(const coreChar* pcText, const coreUintW iNum) {this->insert(0u, pcText, iNum); return *this;}
 
     /* replace all occurrences of a sub-string with another one */
-    using coreStringBase::replace;
-    constexpr coreString& replace(const coreChar* pcOld, const coreChar* pcNew);
+    using coreStringBase<M>::replace;
+    constexpr coreStringAlloc& replace(const coreChar* pcOld, const coreChar* pcNew);
 
     /* replace multiple sub-strings at once */
-    template <typename... A> constexpr coreString& replace_many(A&&... vArgs);
+    template <typename... A> constexpr coreStringAlloc& replace_many(A&&... vArgs);
 
     /* trim string on both sides */
-    constexpr coreString& trim(const coreChar* pcRemove = " \n\r\t");
+    constexpr coreStringAlloc& trim(const coreChar* pcRemove = " \n\r\t");
 
     /* remove last multibyte UTF-8 character */
-    constexpr coreString& pop_back_utf8();
+    constexpr coreStringAlloc& pop_back_utf8();
 };
 
+using coreString = coreStringAlloc<std::allocator<coreChar>>;
+
 
 // ****************************************************************
 /* work-string class */
@@ -124,7 +127,7 @@ private:
 
 // ****************************************************************
 /* replace all occurrences of a sub-string with another one */
-constexpr coreString& coreString::replace(const coreChar* pcOld, const coreChar* pcNew)
+template <typename M> constexpr coreStringAlloc<M>& coreStringAlloc<M>::replace(const coreChar* pcOld, const coreChar* pcNew)
 {
     ASSERT(pcOld && pcNew)
 
@@ -135,7 +138,7 @@ constexpr coreString& coreString::replace(const coreChar* pcOld, const coreChar*
     const coreUintW iNewLen = coreStrLen(pcNew);
 
     // loop only once and replace all findings
-    while((iPos = this->find(pcOld, iPos, iOldLen)) != coreString::npos)
+    while((iPos = this->find(pcOld, iPos, iOldLen)) != coreStringAlloc::npos)
     {
         this->replace(iPos, iOldLen, pcNew, iNewLen);
         iPos += iNewLen;
@@ -147,7 +150,7 @@ constexpr coreString& coreString::replace(const coreChar* pcOld, const coreChar*
 
 // ****************************************************************
 /* replace multiple sub-strings at once */
-template <typename... A> constexpr coreString& coreString::replace_many(A&&... vArgs)
+template <typename M> template <typename... A> constexpr coreStringAlloc<M>& coreStringAlloc<M>::replace_many(A&&... vArgs)
 {
     STATIC_ASSERT(coreMath::IsAligned(sizeof...(A), 2u))
 
@@ -166,9 +169,9 @@ template <typename... A> constexpr coreString& coreString::replace_many(A&&... v
 
 // ****************************************************************
 /* trim string on both sides */
-constexpr coreString& coreString::trim(const coreChar* pcRemove)
+template <typename M> constexpr coreStringAlloc<M>& coreStringAlloc<M>::trim(const coreChar* pcRemove)
 {
-    STATIC_ASSERT(coreString::npos == coreUintW(-1))
+    STATIC_ASSERT(coreStringAlloc::npos == coreUintW(-1))
 
     // trim right
     const coreUintW iLast = this->find_last_not_of(pcRemove);
@@ -176,7 +179,7 @@ constexpr coreString& coreString::trim(const coreChar* pcRemove)
 
     // trim left
     const coreUintW iFirst = this->find_first_not_of(pcRemove);
-    if(iFirst != coreString::npos) this->erase(0u, iFirst);
+    if(iFirst != coreStringAlloc::npos) this->erase(0u, iFirst);
 
     return *this;
 }
@@ -184,7 +187,7 @@ constexpr coreString& coreString::trim(const coreChar* pcRemove)
 
 // ****************************************************************
 /* remove last multibyte UTF-8 character */
-constexpr coreString& coreString::pop_back_utf8()
+template <typename M> constexpr coreStringAlloc<M>& coreStringAlloc<M>::pop_back_utf8()
 {
     ASSERT(!this->empty())
 
@@ -8,19 +8,32 @@
 ///////////////////////////////////////////////////////////
 #include "Core.h"
 
+#if defined(CORE_READQUEUE_URING)
+    #include <linux/io_uring.h>
+    #include <sys/syscall.h>
+    #include <sys/mman.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
 
 // ****************************************************************
 /* constructor */
 coreFile::coreFile(const coreChar* pcPath)noexcept
-: m_sPath       (pcPath)
-, m_pData       (NULL)
-, m_iSize       (0u)
-, m_iArchivePos (__CORE_FILE_TYPE_DIRECT)
-, m_pArchive    (NULL)
-, m_bMapped     (false)
-, m_bExtern     (false)
-, m_iRefCount   (0u)
-, m_DataLock    ()
+: m_sPath        (pcPath)
+, m_pData        (NULL)
+, m_iSize        (0u)
+, m_iArchivePos  (__CORE_FILE_TYPE_DIRECT)
+, m_iArchiveSize (0u)
+, m_iChecksum    (0u)
+, m_bArchiveDict (false)
+, m_pArchive     (NULL)
+, m_bMapped      (false)
+, m_bShared      (false)
+, m_bExtern      (false)
+, m_bVerified    (false)
+, m_iRefCount    (0u)
+, m_DataLock     ()
 {
     if(m_sPath.empty()) return;
 
@@ -34,15 +47,20 @@ coreFile::coreFile(const coreChar* pcPath)noexcept
 }
 
 coreFile::coreFile(const coreChar* pcPath, coreByte* pData, const coreUint32 iSize, const coreBool bExtern)noexcept
-: m_sPath       (pcPath)
-, m_pData       (pData)
-, m_iSize       (iSize)
-, m_iArchivePos (__CORE_FILE_TYPE_MEMORY)
-, m_pArchive    (NULL)
-, m_bMapped     (false)
-, m_bExtern     (bExtern)
-, m_iRefCount   (0u)
-, m_DataLock    ()
+: m_sPath        (pcPath)
+, m_pData        (pData)
+, m_iSize        (iSize)
+, m_iArchivePos  (__CORE_FILE_TYPE_MEMORY)
+, m_iArchiveSize (0u)
+, m_iChecksum    (0u)
+, m_bArchiveDict (false)
+, m_pArchive     (NULL)
+, m_bMapped      (false)
+, m_bShared      (false)
+, m_bExtern      (bExtern)
+, m_bVerified    (false)
+, m_iRefCount    (0u)
+, m_DataLock     ()
 {
 }
 
@@ -173,6 +191,9 @@ coreStatus coreFile::Scramble(const coreUint64 iKey)
     this->LoadData();
     if(!m_pData || !m_iSize) return CORE_INVALID_CALL;
 
+    // copy out of the shared archive mapping
+    this->__DetachData();
+
     ASSERT(!m_bMapped)
 
     // scramble data
@@ -186,6 +207,9 @@ coreStatus coreFile::Unscramble(const coreUint64 iKey)
     this->LoadData();
     if(!m_pData || !m_iSize) return CORE_INVALID_CALL;
 
+    // copy out of the shared archive mapping
+    this->__DetachData();
+
     ASSERT(!m_bMapped)
 
     // scramble data
@@ -205,8 +229,41 @@ SDL_IOStream* coreFile::CreateReadStream()const
         if(!m_pData || !m_iSize) return NULL;
         pFile = SDL_IOFromConstMem(m_pData, m_iSize);
     }
+    else if(m_pArchive && m_iArchiveSize)
+    {
+        // decompress file data into owned memory
+        coreByte* pData = s_cast<coreByte*>(SDL_malloc(m_iSize));
+        if(this->__ReadArchive(pData) != CORE_OK)
+        {
+            SDL_free(pData);
+            return NULL;
+        }
+
+        // create memory stream (which frees the memory on close)
+        pFile = SDL_IOFromConstMem(pData, m_iSize);
+        if(!pFile)
+        {
+            SDL_free(pData);
+            return NULL;
+        }
+        SDL_SetPointerProperty(SDL_GetIOProperties(pFile), SDL_PROP_IOSTREAM_MEMORY_FREE_FUNC_POINTER, r_cast<void*>(SDL_free));
+    }
     else if(m_pArchive)
     {
+#if defined(CORE_ARCHIVE_SHARED)
+
+        // create memory stream directly on the shared archive mapping
+        const coreByte* pMapping = m_pArchive->__GetMapping();
+        if(pMapping)
+        {
+            const coreByte* pView = pMapping + m_iArchivePos;
+            if(this->__VerifyView(pView) != CORE_OK) return NULL;
+
+            return SDL_IOFromConstMem(pView, m_iSize);
+        }
+
+#endif
+
         // open archive
         pFile = SDL_IOFromFile(m_pArchive->GetPath(), CORE_FILE_OPEN_READ);
         if(!pFile) return NULL;
@@ -249,7 +306,30 @@ coreStatus coreFile::LoadData(const coreBool bMapped)
 
 #endif
 
-    if(bMapped)
+#if defined(CORE_ARCHIVE_SHARED)
+
+    if(m_pArchive && !m_iArchiveSize)
+    {
+        // reference file data directly in the shared archive mapping
+        const coreByte* pMapping = m_pArchive->__GetMapping();
+        if(pMapping)
+        {
+            const coreByte* pView = pMapping + m_iArchivePos;
+
+            // verify data integrity (without writing into the read-only mapping)
+            WARN_IF(this->__VerifyView(pView) != CORE_OK) return CORE_INVALID_DATA;
+
+            // cache memory view (# never written, data is only detached by copying)
+            m_pData   = c_cast<coreByte*>(pView);
+            m_bShared = true;
+
+            return CORE_OK;
+        }
+    }
+
+#endif
+
+    if(bMapped && !m_iArchiveSize)
     {
         coreFileMap oMap;
         if(m_pArchive)
@@ -273,26 +353,22 @@ coreStatus coreFile::LoadData(const coreBool bMapped)
         }
     }
 
-    SDL_IOStream* pFile;
     if(m_pArchive)
     {
-        // open archive
-        pFile = SDL_IOFromFile(m_pArchive->GetPath(), CORE_FILE_OPEN_READ);
-        if(!pFile) return CORE_ERROR_FILE;
-
-        // seek file data position
-        WARN_IF(SDL_SeekIO(pFile, m_iArchivePos, SDL_IO_SEEK_SET) != m_iArchivePos)
+        // cache file data (verified and decompressed)
+        m_pData = new coreByte[m_iSize];
+        WARN_IF(this->__ReadArchive(m_pData) != CORE_OK)
         {
-            SDL_CloseIO(pFile);
+            this->__DeleteData();
             return CORE_ERROR_FILE;
         }
+
+        return CORE_OK;
     }
-    else
-    {
-        // open direct file
-        pFile = SDL_IOFromFile(m_sPath.c_str(), CORE_FILE_OPEN_READ);
-        if(!pFile) return CORE_ERROR_FILE;
-    }
+
+    // open direct file
+    SDL_IOStream* pFile = SDL_IOFromFile(m_sPath.c_str(), CORE_FILE_OPEN_READ);
+    if(!pFile) return CORE_ERROR_FILE;
 
     coreBool bSuccess = true;
 
@@ -329,6 +405,86 @@ coreStatus coreFile::UnloadData()
 }
 
 
+// ****************************************************************
+/* load file data asynchronously */
+coreStatus coreFile::LoadDataAsync(coreReadQueue* OUTPUT pQueue, std::function<void()> nCallback)
+{
+    ASSERT(pQueue)
+
+    coreUint32 iSize;
+    {
+        const coreLocker oLocker(&m_DataLock);
+
+        // check current state (compressed data has to be verified and decoded, which is done on loading)
+        if(m_pData || !m_iSize || (m_iArchivePos == __CORE_FILE_TYPE_MEMORY) || m_iArchiveSize || !pQueue->IsAsync()) return CORE_INVALID_CALL;
+
+#if defined(CORE_ARCHIVE_SHARED)
+
+        // read through the shared archive mapping instead
+        if(m_pArchive) return CORE_INVALID_CALL;
+
+#endif
+
+#if defined(_CORE_DEBUG_)
+
+        // for correct hot-reloading (not in release, not for archives)
+        if(!m_pArchive)
+        {
+            m_iSize = coreData::FileSize(m_sPath.c_str());
+            if(!m_iSize) return CORE_INVALID_CALL;
+        }
+
+#endif
+
+        iSize = m_iSize;
+    }
+
+    // queue read into new memory (integrity is not checked, like with memory mapping)
+    pQueue->Submit(this, new coreByte[iSize], [this, nCallback = std::move(nCallback)](const coreStatus eStatus, coreByte* pOutput, const coreUint32 iOutputSize)
+    {
+        coreBool bAdopted = false;
+        if(eStatus == CORE_OK)
+        {
+            const coreLocker oLocker(&m_DataLock);
+
+            // cache file data (if not loaded in the meantime)
+            if(!m_pData && (m_iSize == iOutputSize))
+            {
+                m_pData  = pOutput;
+                bAdopted = true;
+            }
+        }
+
+        // delete unused memory (file data is loaded regularly later)
+        if(!bAdopted) SAFE_DELETE_ARRAY(pOutput)
+
+        if(nCallback) nCallback();
+    });
+
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* hint upcoming data load (start readahead in the background) */
+void coreFile::Prefetch()const
+{
+    // check current state (without lock, only a hint)
+    if(m_pData || !m_iSize || (m_iArchivePos == __CORE_FILE_TYPE_MEMORY)) return;
+
+    if(m_pArchive)
+    {
+        // hint stored data range in the associated archive
+        coreData::FilePrefetch(m_pArchive->GetPath(), m_iArchivePos, m_iArchiveSize ? m_iArchiveSize : m_iSize);
+    }
+    else
+    {
+        // hint whole direct file
+        coreData::FilePrefetch(m_sPath.c_str(), 0, 0);
+    }
+}
+
+
 // ****************************************************************
 /* handle explicit copy (for internal use) */
 void coreFile::InternalNew(coreFile** OUTPUT ppTarget, const coreFile* pSource)
@@ -347,17 +503,24 @@ void coreFile::InternalNew(coreFile** OUTPUT ppTarget, const coreFile* pSource)
     (*ppTarget) = MANAGED_NEW(coreFile, pSource->m_sPath.c_str(), pData, pSource->m_iSize);
 
     // forward archive attributes
-    (*ppTarget)->m_pArchive    = pSource->m_pArchive;
-    (*ppTarget)->m_iArchivePos = pSource->m_iArchivePos;
+    (*ppTarget)->m_pArchive     = pSource->m_pArchive;
+    (*ppTarget)->m_iArchivePos  = pSource->m_iArchivePos;
+    (*ppTarget)->m_iArchiveSize = pSource->m_iArchiveSize;
+    (*ppTarget)->m_iChecksum    = pSource->m_iChecksum;
+    (*ppTarget)->m_bArchiveDict = pSource->m_bArchiveDict;
 
     if(Core::Config->GetBool(CORE_CONFIG_BASE_PERSISTMODE) || DEFINED(_CORE_SWITCH_))
     {
         // always load into memory
         (*ppTarget)->LoadData();
+        (*ppTarget)->__DetachData();
 
         // remove association
-        (*ppTarget)->m_pArchive    = NULL;
-        (*ppTarget)->m_iArchivePos = __CORE_FILE_TYPE_MEMORY;
+        (*ppTarget)->m_pArchive     = NULL;
+        (*ppTarget)->m_iArchivePos  = __CORE_FILE_TYPE_MEMORY;
+        (*ppTarget)->m_iArchiveSize = 0u;
+        (*ppTarget)->m_iChecksum    = 0u;
+        (*ppTarget)->m_bArchiveDict = false;
     }
 }
 
@@ -387,6 +550,133 @@ void coreFile::FlushFilesystem()
 }
 
 
+// ****************************************************************
+/* read file data from the associated archive */
+coreStatus coreFile::__ReadArchive(coreByte* OUTPUT pOutput)const
+{
+    ASSERT(m_pArchive && (m_iArchivePos != __CORE_FILE_TYPE_MEMORY) && pOutput)
+
+#if defined(CORE_ARCHIVE_SHARED)
+
+    // decode directly from the shared archive mapping
+    const coreByte* pMapping = m_pArchive->__GetMapping();
+    if(pMapping)
+    {
+        const coreByte* pView = pMapping + m_iArchivePos;
+
+        const coreStatus eError = this->__VerifyView(pView);
+        if(eError != CORE_OK) return eError;
+
+        return this->__DecodeArchive(pView, pOutput);
+    }
+
+#endif
+
+    // open archive
+    SDL_IOStream* pFile = SDL_IOFromFile(m_pArchive->GetPath(), CORE_FILE_OPEN_READ);
+    if(!pFile) return CORE_ERROR_FILE;
+
+    // seek file data position
+    WARN_IF(SDL_SeekIO(pFile, m_iArchivePos, SDL_IO_SEEK_SET) != m_iArchivePos)
+    {
+        SDL_CloseIO(pFile);
+        return CORE_ERROR_FILE;
+    }
+
+    // read stored data (directly into the output, if not compressed)
+    const coreUint32 iStoredSize = m_iArchiveSize ? m_iArchiveSize : m_iSize;
+    coreByte*        pStored     = m_iArchiveSize ? (new coreByte[iStoredSize]) : pOutput;
+
+    coreBool bSuccess = true;
+    coreFile::__Read(pFile, pStored, iStoredSize, &bSuccess);
+
+    // close archive, verify and decode stored data
+    coreStatus eError = (SDL_CloseIO(pFile) && bSuccess) ? this->__VerifyArchive(pStored) : CORE_ERROR_FILE;
+    if(eError == CORE_OK) eError = this->__DecodeArchive(pStored, pOutput);
+
+    if(pStored != pOutput) SAFE_DELETE_ARRAY(pStored)
+    return eError;
+}
+
+
+// ****************************************************************
+/* decompress stored file data (already verified) */
+coreStatus coreFile::__DecodeArchive(const coreByte* pStored, coreByte* OUTPUT pOutput)const
+{
+    ASSERT(pStored && pOutput && (pStored != pOutput))
+
+    const coreUint32 iStoredSize = m_iArchiveSize ? m_iArchiveSize : m_iSize;
+
+    if(m_iArchiveSize)
+    {
+        const ZSTD_DDict* pDictionary = m_bArchiveDict ? m_pArchive->m_pDictionary : NULL;
+
+        // decompress data (with the archive dictionary, if required)
+        coreUint32 iOutputSize = m_iSize;
+        WARN_IF(m_bArchiveDict && !pDictionary) return CORE_INVALID_DATA;
+        WARN_IF((coreData::Decompress(pStored, iStoredSize, pOutput, &iOutputSize, pDictionary) != CORE_OK) || (iOutputSize != m_iSize)) return CORE_INVALID_DATA;
+    }
+    else
+    {
+        // copy data
+        std::memcpy(pOutput, pStored, m_iSize);
+    }
+
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* verify stored file data */
+coreStatus coreFile::__VerifyArchive(const coreByte* pStored)const
+{
+    ASSERT(pStored)
+
+    const coreUint32 iStoredSize = m_iArchiveSize ? m_iArchiveSize : m_iSize;
+
+    // compare with the stored checksum
+    WARN_IF(m_iChecksum && (coreHashXXH64(pStored, iStoredSize) != m_iChecksum))
+    {
+        Core::Log->Warning("File (%s) in Archive (%s) is corrupted", m_sPath.c_str(), m_pArchive->GetPath());
+        return CORE_INVALID_DATA;
+    }
+
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* verify stored file data in the shared archive mapping (only once, the mapping does not change) */
+coreStatus coreFile::__VerifyView(const coreByte* pView)const
+{
+    if(m_bVerified) return CORE_OK;
+
+    const coreStatus eError = this->__VerifyArchive(pView);
+    if(eError == CORE_OK) m_bVerified = true;
+
+    return eError;
+}
+
+
+// ****************************************************************
+/* copy file data out of the shared archive mapping */
+void coreFile::__DetachData()
+{
+    const coreLocker oLocker(&m_DataLock);
+
+    // check current state
+    if(!m_bShared) return;
+
+    // copy file data
+    coreByte* pData = new coreByte[m_iSize];
+    std::memcpy(pData, m_pData, m_iSize);
+
+    // release shared archive mapping
+    this->__DeleteData();
+    m_pData = pData;
+}
+
+
 // ****************************************************************
 /* delete file data */
 void coreFile::__DeleteData()
@@ -405,6 +695,12 @@ void coreFile::__DeleteData()
         m_pData   = NULL;
         m_bMapped = false;
     }
+    else if(m_bShared)
+    {
+        // remove memory view (shared archive mapping is kept)
+        m_pData   = NULL;
+        m_bShared = false;
+    }
     else if(m_bExtern)
     {
         // remove external data
@@ -457,14 +753,20 @@ void coreFile::__Write(SDL_IOStream* pFile, const void* pPointer, const coreUint
 // ****************************************************************
 /* constructor */
 coreArchive::coreArchive()noexcept
-: m_sPath  ("")
-, m_apFile {}
+: m_sPath       ("")
+, m_apFile      {}
+, m_pDictionary (NULL)
+, m_Mapping     {}
+, m_MapLock     ()
 {
 }
 
 coreArchive::coreArchive(const coreChar* pcPath)noexcept
-: m_sPath  (pcPath)
-, m_apFile {}
+: m_sPath       (pcPath)
+, m_apFile      {}
+, m_pDictionary (NULL)
+, m_Mapping     {}
+, m_MapLock     ()
 {
     // open archive
     SDL_IOStream* pArchive = SDL_IOFromFile(m_sPath.c_str(), CORE_FILE_OPEN_READ);
@@ -481,44 +783,15 @@ coreArchive::coreArchive(const coreChar* pcPath)noexcept
     coreFile::__Read(pArchive, &aiHead, sizeof(coreUint32) * 2u, &bSuccess);
 
     // check magic number and file version
-    if((aiHead[0] != CORE_ARCHIVE_MAGIC) || (aiHead[1] != CORE_ARCHIVE_VERSION))
+    if((aiHead[0] != CORE_ARCHIVE_MAGIC) || ((aiHead[1] != CORE_ARCHIVE_VERSION) && (aiHead[1] != CORE_ARCHIVE_LEGACY)))
     {
         SDL_CloseIO(pArchive);
         Core::Log->Warning("Archive (%s) is not a valid CFA-file", m_sPath.c_str());
         return;
     }
 
-    // read number of files
-    coreUint16 iNumFiles;
-    coreFile::__Read(pArchive, &iNumFiles, sizeof(coreUint16), &bSuccess);
-
-    // reserve some memory
-    m_apFile.reserve(iNumFiles);
-
     // read file headers
-    for(coreUintW i = iNumFiles; i--; )
-    {
-        coreUint8  iPathLen;
-        coreChar   acPath[256];
-        coreUint32 iSize;
-        coreUint32 iArchivePos;
-
-        // read file header data
-        coreFile::__Read(pArchive, &iPathLen,    sizeof(coreUint8),  &bSuccess);
-        coreFile::__Read(pArchive, acPath,       iPathLen,           &bSuccess);
-        coreFile::__Read(pArchive, &iSize,       sizeof(coreUint32), &bSuccess);
-        coreFile::__Read(pArchive, &iArchivePos, sizeof(coreUint32), &bSuccess);
-        acPath[iPathLen] = '\0';
-
-        // add new file object
-        if(bSuccess)
-        {
-            coreFile* pNewFile      = new coreFile(acPath, NULL, iSize);
-            pNewFile->m_pArchive    = this;
-            pNewFile->m_iArchivePos = iArchivePos;
-            m_apFile.emplace_bs_unsafe(acPath, pNewFile);
-        }
-    }
+    if(bSuccess) bSuccess = (aiHead[1] == CORE_ARCHIVE_LEGACY) ? this->__ReadHeadersLegacy(pArchive) : this->__ReadHeaders(pArchive);
 
     // close archive
     WARN_IF(!SDL_CloseIO(pArchive) || !bSuccess)
@@ -528,7 +801,7 @@ coreArchive::coreArchive(const coreChar* pcPath)noexcept
         return;
     }
 
-    Core::Log->Info("Archive (%s, %u files) opened", m_sPath.c_str(), iNumFiles);
+    Core::Log->Info("Archive (%s, %u files) opened", m_sPath.c_str(), coreUint32(m_apFile.size()));
 }
 
 
@@ -538,12 +811,18 @@ coreArchive::~coreArchive()
 {
     // remove all file objects
     this->ClearFiles();
+
+    // delete decompression dictionary
+    if(m_pDictionary) ZSTD_freeDDict(m_pDictionary);
+
+    // unmap archive from memory
+    this->__UnmapArchive();
 }
 
 
 // ****************************************************************
 /* save archive */
-coreStatus coreArchive::Save(const coreChar* pcPath)
+coreStatus coreArchive::Save(const coreChar* pcPath, const coreInt32 iLevel, const coreUint32 iDictSize, const coreUintW iThreads)
 {
     // save path
     if(pcPath) m_sPath = pcPath;
@@ -552,12 +831,91 @@ coreStatus coreArchive::Save(const coreChar* pcPath)
     // create directory hierarchy
     coreData::DirectoryCreate(coreData::StrDirectory(m_sPath.c_str()));
 
-    // cache missing file data
+    // cache missing file data (and copy out of the shared mapping, which may get overwritten)
     FOR_EACH(it, m_apFile)
     {
         (*it)->LoadData();
+        (*it)->__DetachData();
+    }
+
+    // unmap old archive from memory (file will be overwritten)
+    this->__UnmapArchive();
+
+    const coreUint32 iNumFiles = m_apFile.size();
+
+    // train compression dictionary on small files
+    coreList<coreByte> aDictionary;
+    if(iLevel && iDictSize) this->__TrainDictionary(iDictSize, &aDictionary);
+
+    // compress file data in parallel (deterministic, independent of the number of threads)
+    coreList<coreStored> aStored;
+    aStored.resize(iNumFiles, {});
+    if(iLevel) this->__CompressFiles(iLevel, aDictionary, iThreads, &aStored);
+
+    // calculate size of the header block (with additional entry for the dictionary)
+    const coreUint32 iNumEntries = iNumFiles + (aDictionary.empty() ? 0u : 1u);
+    coreUint32       iTableSize  = 0u;
+    FOR_EACH(it, m_apFile)
+    {
+        iTableSize += MIN(coreStrLen((*it)->GetPath()), 255u);
+    }
+    const coreUint32 iBlockSize = iNumEntries * sizeof(coreEntry) + iTableSize;
+
+    // create header block (entries sorted by path hash, followed by the path table)
+    coreByte*  pBlock  = new coreByte[MAX(iBlockSize, 1u)];
+    coreEntry* pEntry  = r_cast<coreEntry*>(pBlock);
+    coreChar*  pcTable = r_cast<coreChar*>(pBlock + iNumEntries * sizeof(coreEntry));
+    std::memset(pBlock, 0, iBlockSize);
+
+    coreUint32 iCurPosition = sizeof(coreHeader) + iBlockSize;
+    coreUint32 iCurOffset   = 0u;
+    for(coreUintW i = 0u; i < iNumFiles; ++i)
+    {
+        coreFile*        pFile    = m_apFile[i];
+        const coreUint8  iPathLen = MIN(coreStrLen(pFile->GetPath()), 255u);
+        const coreByte*  pStored  = aStored[i].pData ? aStored[i].pData : pFile->GetData();
+        const coreUint32 iStored  = aStored[i].pData ? aStored[i].iSize : pFile->GetSize();
+
+        // fill file entry
+        pEntry[i].iHash       = m_apFile.get_keylist()[i];
+        pEntry[i].iPosition   = iCurPosition;
+        pEntry[i].iSize       = pFile->GetSize();
+        pEntry[i].iStoredSize = iStored;
+        pEntry[i].iChecksum   = iStored ? coreHashXXH64(pStored, iStored) : 0u;
+        pEntry[i].iPathOffset = iCurOffset;
+        pEntry[i].iPathLen    = iPathLen;
+        pEntry[i].iFlags      = aStored[i].iFlags;
+
+        // copy path into the path table
+        std::memcpy(pcTable + iCurOffset, pFile->GetPath(), iPathLen);
+
+        iCurPosition += iStored;
+        iCurOffset   += iPathLen;
+    }
+
+    if(!aDictionary.empty())
+    {
+        // fill dictionary entry (stored behind all files)
+        pEntry[iNumFiles].iPosition   = iCurPosition;
+        pEntry[iNumFiles].iSize       = aDictionary.size();
+        pEntry[iNumFiles].iStoredSize = aDictionary.size();
+        pEntry[iNumFiles].iChecksum   = coreHashXXH64(aDictionary.data(), aDictionary.size());
+        pEntry[iNumFiles].iPathOffset = iCurOffset;
+        pEntry[iNumFiles].iFlags      = CORE_ARCHIVE_FLAG_INTERNAL;
+
+        iCurPosition += aDictionary.size();
     }
 
+    // create archive header
+    const coreHeader oHeader = {CORE_ARCHIVE_MAGIC, CORE_ARCHIVE_VERSION, iNumEntries, iBlockSize, coreHashXXH64(pBlock, iBlockSize)};
+
+    // free temporary memory
+    const auto nFreeFunc = [&]()
+    {
+        FOR_EACH(it, aStored) SAFE_DELETE_ARRAY(it->pData)
+        SAFE_DELETE_ARRAY(pBlock)
+    };
+
     // write to temporary file first (to improve robustness)
     const coreChar* pcTemp = DEFINED(CORE_FILE_SAFEWRITE) ? PRINT("%s.temp_%u", m_sPath.c_str(), coreData::ProcessID()) : m_sPath.c_str();
 
@@ -565,43 +923,30 @@ coreStatus coreArchive::Save(const coreChar* pcPath)
     SDL_IOStream* pArchive = SDL_IOFromFile(pcTemp, CORE_FILE_OPEN_WRITE);
     if(!pArchive)
     {
+        nFreeFunc();
         Core::Log->Warning("Archive (%s) could not be saved (SDL: %s)", m_sPath.c_str(), SDL_GetError());
         return CORE_ERROR_FILE;
     }
 
     coreBool bSuccess = true;
 
-    // save magic number and file version
-    const coreUint32 aiHead[2] = {CORE_ARCHIVE_MAGIC, CORE_ARCHIVE_VERSION};
-    coreFile::__Write(pArchive, aiHead, sizeof(coreUint32) * 2u, &bSuccess);
-
-    // save number of files
-    const coreUint16 iNumFiles = m_apFile.size();
-    coreFile::__Write(pArchive, &iNumFiles, sizeof(coreUint16), &bSuccess);
-
-    // save file headers
-    this->__CalculatePositions();
-    FOR_EACH(it, m_apFile)
-    {
-        // get path length
-        const coreUint8 iPathLen = MIN(coreStrLen((*it)->GetPath()), 255u);
-
-        // write header
-        coreFile::__Write(pArchive, &iPathLen,             sizeof(coreUint8),  &bSuccess);
-        coreFile::__Write(pArchive,  (*it)->GetPath(),     iPathLen,           &bSuccess);
-        coreFile::__Write(pArchive, &(*it)->GetSize(),     sizeof(coreUint32), &bSuccess);
-        coreFile::__Write(pArchive, &(*it)->m_iArchivePos, sizeof(coreUint32), &bSuccess);
-    }
+    // save archive header and header block
+    coreFile::__Write(pArchive, &oHeader, sizeof(coreHeader), &bSuccess);
+    if(iBlockSize) coreFile::__Write(pArchive, pBlock, iBlockSize, &bSuccess);
 
     // save file data
-    FOR_EACH(it, m_apFile)
+    for(coreUintW i = 0u; i < iNumFiles; ++i)
     {
-        coreFile::__Write(pArchive, (*it)->GetData(), (*it)->GetSize(), &bSuccess);
+        if(pEntry[i].iStoredSize) coreFile::__Write(pArchive, aStored[i].pData ? aStored[i].pData : m_apFile[i]->GetData(), pEntry[i].iStoredSize, &bSuccess);
     }
 
+    // save dictionary
+    if(!aDictionary.empty()) coreFile::__Write(pArchive, aDictionary.data(), aDictionary.size(), &bSuccess);
+
     // close archive
     WARN_IF(!SDL_CloseIO(pArchive) || !bSuccess)
     {
+        nFreeFunc();
         Core::Log->Warning("Archive (%s) could not be saved properly (SDL: %s)", m_sPath.c_str(), SDL_GetError());
         return CORE_ERROR_FILE;
     }
@@ -609,17 +954,33 @@ coreStatus coreArchive::Save(const coreChar* pcPath)
     // move temporary file over real file
     WARN_IF(DEFINED(CORE_FILE_SAFEWRITE) && (coreData::FileMove(pcTemp, m_sPath.c_str()) != CORE_OK))
     {
+        nFreeFunc();
         Core::Log->Warning("Archive (%s) could not be moved", m_sPath.c_str());
         return CORE_ERROR_FILE;
     }
 
-    // unload file data
-    FOR_EACH(it, m_apFile)
+    // replace decompression dictionary
+    if(m_pDictionary) ZSTD_freeDDict(m_pDictionary);
+    m_pDictionary = aDictionary.empty() ? NULL : ZSTD_createDDict(aDictionary.data(), aDictionary.size());
+
+    // associate files with the written archive (only after success)
+    for(coreUintW i = 0u; i < iNumFiles; ++i)
     {
-        (*it)->UnloadData();
+        coreFile* pFile = m_apFile[i];
+
+        pFile->m_pArchive     = this;
+        pFile->m_iArchivePos  = pEntry[i].iPosition;
+        pFile->m_iArchiveSize = HAS_FLAG(pEntry[i].iFlags, CORE_ARCHIVE_FLAG_COMPRESSED) ? pEntry[i].iStoredSize : 0u;
+        pFile->m_iChecksum    = pEntry[i].iChecksum;
+        pFile->m_bArchiveDict = HAS_FLAG(pEntry[i].iFlags, CORE_ARCHIVE_FLAG_DICTIONARY);
+
+        // unload file data
+        pFile->UnloadData();
     }
 
-    Core::Log->Info("Archive (%s, %u files) written", m_sPath.c_str(), iNumFiles);
+    nFreeFunc();
+
+    Core::Log->Info("Archive (%s, %u files, %.1f KB dictionary, %.1f KB) written", m_sPath.c_str(), iNumFiles, I_TO_F(aDictionary.size()) / 1024.0f, I_TO_F(iCurPosition) / 1024.0f);
     return CORE_OK;
 }
 
@@ -732,22 +1093,802 @@ void coreArchive::ClearFiles()
 
 
 // ****************************************************************
-/* calculate the data positions of all files */
-void coreArchive::__CalculatePositions()
+/* train compression dictionary on small files */
+void coreArchive::__TrainDictionary(const coreUint32 iMaxSize, coreList<coreByte>* OUTPUT paOutput)
 {
-    // calculate data start position
-    coreUint32 iCurPosition = 2u*sizeof(coreUint32) + sizeof(coreUint16);
+    ASSERT(iMaxSize && paOutput)
+
+    coreList<coreByte>  aSample;
+    coreList<coreUintW> aiSampleSize;
+
+    // collect samples (in archive order, to stay deterministic)
     FOR_EACH(it, m_apFile)
     {
-        iCurPosition += sizeof(coreUint8) + MIN(coreStrLen((*it)->GetPath()), 255u) + 2u*sizeof(coreUint32);
+        const coreUint32 iSize = (*it)->GetSize();
+        if(!iSize || (iSize > CORE_ARCHIVE_DICT_LIMIT)) continue;
+
+        aSample.insert(aSample.end(), (*it)->GetData(), (*it)->GetData() + iSize);
+        aiSampleSize.push_back(iSize);
     }
 
-    // set absolute data position
-    FOR_EACH(it, m_apFile)
-    {
-        (*it)->m_pArchive    = this;
-        (*it)->m_iArchivePos = iCurPosition;
+    // check for enough samples
+    if(aiSampleSize.size() < CORE_ARCHIVE_DICT_SAMPLES) return;
+
+    // train dictionary
+    paOutput->resize(iMaxSize);
+    const coreUintW iSize = ZDICT_trainFromBuffer(paOutput->data(), iMaxSize, aSample.data(), aiSampleSize.data(), aiSampleSize.size());
 
-        iCurPosition += (*it)->GetSize();
+    // check for success (may fail on unsuitable samples)
+    if(ZDICT_isError(iSize))
+    {
+        Core::Log->Warning("Archive (%s) dictionary could not be trained (ZDICT: %s)", m_sPath.c_str(), ZDICT_getErrorName(iSize));
+        paOutput->clear();
+        return;
     }
+
+    paOutput->resize(iSize);
+}
+
+
+// ****************************************************************
+/* compress file data in parallel */
+void coreArchive::__CompressFiles(const coreInt32 iLevel, const coreList<coreByte>& aDictionary, const coreUintW iThreads, coreList<coreStored>* OUTPUT paOutput)
+{
+    ASSERT(iLevel && (paOutput->size() == m_apFile.size()))
+
+    // create shared compression dictionary
+    ZSTD_CDict* pDictionary = aDictionary.empty() ? NULL : ZSTD_createCDict(aDictionary.data(), aDictionary.size(), iLevel);
+
+    // prepare compression job
+    coreCompressJob oJob;
+    oJob.pArchive    = this;
+    oJob.iLevel      = iLevel;
+    oJob.pDictionary = pDictionary;
+    oJob.pOutput     = paOutput->data();
+    oJob.iCurrent    = 0u;
+
+    // distribute compression tasks over all threads (each task with own compression context, files are distributed dynamically)
+    const coreUintW iNumTasks = MIN(iThreads ? iThreads : Core::Manager::Job->GetNumThreads(), m_apFile.size());
+    Core::Manager::Job->ParallelFor(iNumTasks, 1u, [&](const coreUintW, const coreUintW)
+    {
+        coreArchive::__CompressTask(&oJob);
+    });
+
+    // delete shared compression dictionary
+    if(pDictionary) ZSTD_freeCDict(pDictionary);
+}
+
+
+// ****************************************************************
+/* compress files until none are left */
+void coreArchive::__CompressTask(coreCompressJob* pJob)
+{
+    // create own compression context
+    ZSTD_CCtx* pContext = ZSTD_createCCtx();
+
+    for(coreUint32 i, ie = pJob->pArchive->m_apFile.size(); (i = pJob->iCurrent.FetchAdd(1u)) < ie; )
+    {
+        const coreFile* pFile = pJob->pArchive->m_apFile[i];
+        if(!pFile->m_pData || !pFile->m_iSize) continue;
+
+        // use dictionary only on small files
+        const ZSTD_CDict* pDictionary = (pFile->m_iSize <= CORE_ARCHIVE_DICT_LIMIT) ? pJob->pDictionary : NULL;
+
+        // compress data (same layout as coreData::Compress, with original size in front)
+        const coreUintW iBound   = ZSTD_compressBound(pFile->m_iSize);
+        coreByte*       pBuffer  = new coreByte[iBound + sizeof(coreUint32)];
+        const coreUintW iWritten = pDictionary ? ZSTD_compress_usingCDict(pContext, pBuffer + sizeof(coreUint32), iBound, pFile->m_pData, pFile->m_iSize, pDictionary) :
+                                                 ZSTD_compressCCtx       (pContext, pBuffer + sizeof(coreUint32), iBound, pFile->m_pData, pFile->m_iSize, pJob->iLevel);
+
+        // keep only when it is actually smaller
+        if(ZSTD_isError(iWritten) || (iWritten + sizeof(coreUint32) >= pFile->m_iSize))
+        {
+            SAFE_DELETE_ARRAY(pBuffer)
+            continue;
+        }
+
+        // store original size
+        (*r_cast<coreUint32*>(pBuffer)) = pFile->m_iSize;
+
+        // return compressed data
+        pJob->pOutput[i].pData  = pBuffer;
+        pJob->pOutput[i].iSize  = iWritten + sizeof(coreUint32);
+        pJob->pOutput[i].iFlags = CORE_ARCHIVE_FLAG_COMPRESSED | (pDictionary ? CORE_ARCHIVE_FLAG_DICTIONARY : 0u);
+    }
+
+    // delete compression context
+    ZSTD_freeCCtx(pContext);
+}
+
+
+// ****************************************************************
+/* read file headers */
+coreBool coreArchive::__ReadHeaders(SDL_IOStream* pArchive)
+{
+    coreBool bSuccess = true;
+
+    // read remaining archive header
+    coreHeader oHeader;
+    coreFile::__Read(pArchive, &oHeader.iNumFiles,  sizeof(coreUint32), &bSuccess);
+    coreFile::__Read(pArchive, &oHeader.iBlockSize, sizeof(coreUint32), &bSuccess);
+    coreFile::__Read(pArchive, &oHeader.iChecksum,  sizeof(coreUint64), &bSuccess);
+    if(!bSuccess) return false;
+
+    // check header block boundaries
+    const coreUint64 iArchiveSize = MAX(SDL_GetIOSize(pArchive), 0);
+    WARN_IF((coreUint64(oHeader.iNumFiles) * sizeof(coreEntry) > oHeader.iBlockSize) || (sizeof(coreHeader) + coreUint64(oHeader.iBlockSize) > iArchiveSize))
+    {
+        Core::Log->Warning("Archive (%s) has an invalid header", m_sPath.c_str());
+        return false;
+    }
+
+    if(!oHeader.iNumFiles) return true;
+
+    // read whole header block at once
+    coreByte* pBlock = new coreByte[oHeader.iBlockSize];
+    coreFile::__Read(pArchive, pBlock, oHeader.iBlockSize, &bSuccess);
+
+    // verify header integrity (covers all file checksums)
+    WARN_IF(!bSuccess || (coreHashXXH64(pBlock, oHeader.iBlockSize) != oHeader.iChecksum))
+    {
+        SAFE_DELETE_ARRAY(pBlock)
+        Core::Log->Warning("Archive (%s) has a corrupted header", m_sPath.c_str());
+        return false;
+    }
+
+    const coreEntry* pEntry     = r_cast<const coreEntry*>(pBlock);
+    const coreChar*  pcTable    = r_cast<const coreChar*> (pBlock + oHeader.iNumFiles * sizeof(coreEntry));
+    const coreUint32 iTableSize = oHeader.iBlockSize - oHeader.iNumFiles * sizeof(coreEntry);
+    const coreUint64 iDataStart = sizeof(coreHeader) + oHeader.iBlockSize;
+
+    // reserve some memory
+    m_apFile.reserve(oHeader.iNumFiles);
+
+    for(coreUintW i = 0u, ie = oHeader.iNumFiles; i < ie; ++i)
+    {
+        const coreEntry& oEntry      = pEntry[i];
+        const coreBool   bCompressed = HAS_FLAG(oEntry.iFlags, CORE_ARCHIVE_FLAG_COMPRESSED);
+        const coreBool   bInternal   = HAS_FLAG(oEntry.iFlags, CORE_ARCHIVE_FLAG_INTERNAL);
+
+        // check file entry boundaries
+        WARN_IF((coreUint64(oEntry.iPathOffset) + oEntry.iPathLen > iTableSize) || (oEntry.iSize && (oEntry.iPosition < iDataStart)) ||
+                (coreUint64(oEntry.iPosition) + oEntry.iStoredSize > iArchiveSize) || (!bCompressed && (oEntry.iStoredSize != oEntry.iSize)))
+        {
+            bSuccess = false;
+            break;
+        }
+
+        if(bInternal)
+        {
+            // read archive dictionary
+            coreList<coreByte> aDictionary;
+            aDictionary.resize(oEntry.iSize);
+            if(oEntry.iSize && (SDL_SeekIO(pArchive, oEntry.iPosition, SDL_IO_SEEK_SET) == oEntry.iPosition)) coreFile::__Read(pArchive, aDictionary.data(), oEntry.iSize, &bSuccess);
+
+            // verify and create decompression dictionary
+            WARN_IF(!bSuccess || !oEntry.iSize || m_pDictionary || (coreHashXXH64(aDictionary.data(), oEntry.iSize) != oEntry.iChecksum))
+            {
+                bSuccess = false;
+                break;
+            }
+            m_pDictionary = ZSTD_createDDict(aDictionary.data(), oEntry.iSize);
+
+            continue;
+        }
+
+        // copy path from the path table
+        coreChar acPath[256];
+        std::memcpy(acPath, pcTable + oEntry.iPathOffset, oEntry.iPathLen);
+        acPath[oEntry.iPathLen] = '\0';
+
+        // add new file object (entries are already sorted)
+        coreFile* pNewFile       = new coreFile(acPath, NULL, oEntry.iSize);
+        pNewFile->m_pArchive     = this;
+        pNewFile->m_iArchivePos  = oEntry.iPosition;
+        pNewFile->m_iArchiveSize = bCompressed ? oEntry.iStoredSize : 0u;
+        pNewFile->m_iChecksum    = oEntry.iChecksum;
+        pNewFile->m_bArchiveDict = HAS_FLAG(oEntry.iFlags, CORE_ARCHIVE_FLAG_DICTIONARY);
+        m_apFile.emplace_bs_unsafe(acPath, pNewFile);
+    }
+
+    SAFE_DELETE_ARRAY(pBlock)
+    return bSuccess;
+}
+
+coreBool coreArchive::__ReadHeadersLegacy(SDL_IOStream* pArchive)
+{
+    coreBool bSuccess = true;
+
+    // read number of files
+    coreUint16 iNumFiles;
+    coreFile::__Read(pArchive, &iNumFiles, sizeof(coreUint16), &bSuccess);
+
+    // reserve some memory
+    m_apFile.reserve(iNumFiles);
+
+    // read file headers
+    for(coreUintW i = iNumFiles; i--; )
+    {
+        coreUint8  iPathLen;
+        coreChar   acPath[256];
+        coreUint32 iSize;
+        coreUint32 iArchivePos;
+
+        // read file header data
+        coreFile::__Read(pArchive, &iPathLen,    sizeof(coreUint8),  &bSuccess);
+        coreFile::__Read(pArchive, acPath,       iPathLen,           &bSuccess);
+        coreFile::__Read(pArchive, &iSize,       sizeof(coreUint32), &bSuccess);
+        coreFile::__Read(pArchive, &iArchivePos, sizeof(coreUint32), &bSuccess);
+        acPath[iPathLen] = '\0';
+
+        // add new file object
+        if(bSuccess)
+        {
+            coreFile* pNewFile      = new coreFile(acPath, NULL, iSize);
+            pNewFile->m_pArchive    = this;
+            pNewFile->m_iArchivePos = iArchivePos;
+            m_apFile.emplace_bs_unsafe(acPath, pNewFile);
+        }
+    }
+
+    return bSuccess;
+}
+
+
+// ****************************************************************
+/* get shared memory mapping (created on first use) */
+const coreByte* coreArchive::__GetMapping()
+{
+    const coreLocker oLocker(&m_MapLock);
+
+    if(!m_Mapping.pData)
+    {
+        // retrieve archive size (explicitly, to get a valid mapping size on every platform)
+        const coreInt64 iSize = coreData::FileSize(m_sPath.c_str());
+        if(iSize <= 0) return NULL;
+
+        // map whole archive into memory
+        WARN_IF(coreData::FileMap(m_sPath.c_str(), 0, iSize, &m_Mapping) != CORE_OK) return NULL;
+    }
+
+    return s_cast<const coreByte*>(m_Mapping.pData);
+}
+
+
+// ****************************************************************
+/* unmap shared memory mapping */
+void coreArchive::__UnmapArchive()
+{
+    const coreLocker oLocker(&m_MapLock);
+
+    // check for remaining references
+    FOR_EACH(it, m_apFile) ASSERT(!(*it)->m_bShared)
+
+    if(m_Mapping.pData)
+    {
+        // invalidate verification of all memory views
+        FOR_EACH(it, m_apFile) (*it)->m_bVerified = false;
+
+        // unmap archive from memory
+        WARN_IF(coreData::FileUnmap(&m_Mapping) != CORE_OK) {}
+        std::memset(&m_Mapping, 0, sizeof(coreFileMap));
+    }
+}
+
+// ****************************************************************
+/* io_uring state structure */
+#if defined(CORE_READQUEUE_URING)
+
+struct coreReadQueue::coreRing final
+{
+    coreInt32     iDescriptor;      // io_uring file descriptor
+    coreByte*     pRing;            // mapped submission and completion queue rings (single mapping)
+    io_uring_sqe* pEntries;         // mapped submission queue entries
+    coreUintW     iRingSize;        // size of the ring mapping
+    coreUintW     iEntrySize;       // size of the entry mapping
+
+    coreUint32*   piSubmitTail;     // submission queue tail (written by us)
+    coreUint32*   piSubmitArray;    // submission queue index array
+    coreUint32    iSubmitMask;      // submission queue index mask
+    coreUint32*   piCompleteHead;   // completion queue head (written by us)
+    coreUint32*   piCompleteTail;   // completion queue tail (written by the kernel)
+    io_uring_cqe* pCompletions;     // completion queue entries
+    coreUint32    iCompleteMask;    // completion queue index mask
+
+    coreUint32    iCapacity;        // number of submission queue entries
+    coreUint32    iInRing;          // number of requests currently owned by the ring
+    coreUint32    iQueued;          // number of entries not yet consumed by the kernel
+};
+
+#endif
+
+
+// ****************************************************************
+/* constructor */
+coreReadQueue::coreReadQueue()noexcept
+: m_apPending    {}
+, m_iPendingNext (0u)
+, m_apFinished   {}
+, m_iActive      (0u)
+, m_pRing        (NULL)
+, m_apThread     {}
+, m_pSemaphore   (NULL)
+, m_pComplete    (NULL)
+, m_bShutdown    (false)
+, m_Lock         ()
+{
+    // use io_uring if possible
+    if(this->__RingInit()) return;
+
+#if !defined(_CORE_SINGLE_)
+
+    // start reader threads otherwise
+    m_pSemaphore = SDL_CreateSemaphore(0u);
+    m_pComplete  = SDL_CreateSemaphore(0u);
+    if(m_pSemaphore && m_pComplete)
+    {
+        for(coreUintW i = 0u; i < CORE_READQUEUE_THREADS; ++i)
+        {
+            SDL_Thread* pThread = SDL_CreateThread(coreReadQueue::__ReadThread, "read_queue", this);
+            if(pThread) m_apThread.push_back(pThread);
+        }
+    }
+
+#endif
+}
+
+
+// ****************************************************************
+/* destructor */
+coreReadQueue::~coreReadQueue()
+{
+    // finish all reads
+    this->Wait();
+
+    if(!m_apThread.empty())
+    {
+        // notify reader threads
+        m_Lock.Lock();
+        {
+            m_bShutdown = true;
+        }
+        m_Lock.Unlock();
+
+        FOR_EACH(it, m_apThread) SDL_SignalSemaphore(m_pSemaphore);
+
+        // wait for all reader threads to finish
+        FOR_EACH(it, m_apThread)
+        {
+            SDL_WaitThread(*it, NULL);
+        }
+    }
+
+    // delete remaining resources
+    if(m_pSemaphore) SDL_DestroySemaphore(m_pSemaphore);
+    if(m_pComplete)  SDL_DestroySemaphore(m_pComplete);
+    this->__RingExit();
+}
+
+
+// ****************************************************************
+/* queue file read */
+void coreReadQueue::Submit(const coreChar* pcPath, const coreUint64 iOffset, coreByte* OUTPUT pOutput, const coreUint32 iSize, coreReadCallback nCallback)
+{
+    ASSERT(pcPath && pOutput)
+
+    // create new request
+    coreRequest* pRequest = new coreRequest();
+    pRequest->sPath     = pcPath;
+    pRequest->iOffset   = iOffset;
+    pRequest->pOutput   = pOutput;
+    pRequest->iSize     = iSize;
+    pRequest->iDone     = 0u;
+    pRequest->iFile     = -1;
+    pRequest->eStatus   = CORE_BUSY;
+    pRequest->nCallback = std::move(nCallback);
+
+    ++m_iActive;
+
+    // complete empty reads immediately
+    if(!iSize)
+    {
+        pRequest->eStatus = CORE_OK;
+
+        const coreLocker oLocker(&m_Lock);
+        m_apFinished.push_back(pRequest);
+        return;
+    }
+
+    if(m_apThread.empty())
+    {
+        // queue for the next batch
+        m_apPending.push_back(pRequest);
+    }
+    else
+    {
+        // start readahead already (reader threads may be busy for a while)
+        coreData::FilePrefetch(pcPath, iOffset, iSize);
+
+        // hand over to reader threads
+        m_Lock.Lock();
+        {
+            m_apPending.push_back(pRequest);
+        }
+        m_Lock.Unlock();
+
+        SDL_SignalSemaphore(m_pSemaphore);
+    }
+}
+
+void coreReadQueue::Submit(const coreFile* pFile, coreByte* OUTPUT pOutput, coreReadCallback nCallback)
+{
+    ASSERT(pFile)
+
+    // only raw file data can be read directly
+    WARN_IF((pFile->m_iArchivePos == __CORE_FILE_TYPE_MEMORY) || pFile->m_iArchiveSize || pFile->m_sPath.empty())
+    {
+        if(nCallback) nCallback(CORE_INVALID_INPUT, pOutput, pFile->m_iSize);
+        return;
+    }
+
+    // read from the associated archive or the direct file (without integrity check)
+    if(pFile->m_pArchive) this->Submit(pFile->m_pArchive->GetPath(), pFile->m_iArchivePos, pOutput, pFile->m_iSize, std::move(nCallback));
+                     else this->Submit(pFile->m_sPath.c_str(),       0u,                   pOutput, pFile->m_iSize, std::move(nCallback));
+}
+
+
+// ****************************************************************
+/* submit queued reads and execute callbacks of completed reads */
+coreUintW coreReadQueue::Update()
+{
+    if(m_pRing)
+    {
+        // submit new batch and collect completions
+        this->__RingSubmit();
+        this->__RingReap(false);
+    }
+    else if(m_apThread.empty())
+    {
+        // read synchronously (no asynchronous backend available)
+        FOR_EACH(it, m_apPending)
+        {
+            coreReadQueue::__ReadRequest(*it);
+            m_apFinished.push_back(*it);
+        }
+        m_apPending.clear();
+    }
+
+    // take all completed requests
+    coreList<coreRequest*> apFinished;
+    m_Lock.Lock();
+    {
+        apFinished.swap(m_apFinished);
+    }
+    m_Lock.Unlock();
+
+    FOR_EACH(it, apFinished)
+    {
+        coreRequest* pRequest = (*it);
+
+        // execute callback (may submit new reads)
+        if(pRequest->nCallback) pRequest->nCallback(pRequest->eStatus, pRequest->pOutput, pRequest->iSize);
+
+        // delete request
+        SAFE_DELETE(pRequest)
+        --m_iActive;
+    }
+
+    return m_iActive;
+}
+
+
+// ****************************************************************
+/* wait until all reads are completed */
+void coreReadQueue::Wait()
+{
+    while(this->Update())
+    {
+        // block until next completion (synchronous reads are already completed during update)
+        if(m_pRing) this->__RingReap(true);
+        else if(!m_apThread.empty()) SDL_WaitSemaphore(m_pComplete);
+    }
+}
+
+
+// ****************************************************************
+/* create io_uring instance */
+coreBool coreReadQueue::__RingInit()
+{
+#if defined(CORE_READQUEUE_URING)
+
+    io_uring_params oParams = {};
+
+    // create ring (may be blocked or unsupported)
+    const coreInt32 iDescriptor = syscall(__NR_io_uring_setup, CORE_READQUEUE_DEPTH, &oParams);
+    if(iDescriptor < 0) return false;
+
+    // check for single ring mapping (Linux 5.4) and read operation (Linux 5.6)
+    alignas(io_uring_probe) coreByte aProbe[sizeof(io_uring_probe) + sizeof(io_uring_probe_op) * 256u] = {};
+    io_uring_probe* pProbe = r_cast<io_uring_probe*>(aProbe);
+
+    if(!HAS_FLAG(oParams.features, IORING_FEAT_SINGLE_MMAP) || (syscall(__NR_io_uring_register, iDescriptor, IORING_REGISTER_PROBE, pProbe, 256u) < 0) ||
+       (pProbe->last_op < IORING_OP_READ) || !HAS_FLAG(pProbe->ops[IORING_OP_READ].flags, IO_URING_OP_SUPPORTED))
+    {
+        close(iDescriptor);
+        return false;
+    }
+
+    // map rings and submission entries
+    const coreUintW iRingSize  = MAX(oParams.sq_off.array + oParams.sq_entries * sizeof(coreUint32), oParams.cq_off.cqes + oParams.cq_entries * sizeof(io_uring_cqe));
+    const coreUintW iEntrySize = oParams.sq_entries * sizeof(io_uring_sqe);
+
+    void* pRing    = mmap(NULL, iRingSize,  PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, iDescriptor, IORING_OFF_SQ_RING);
+    void* pEntries = mmap(NULL, iEntrySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, iDescriptor, IORING_OFF_SQES);
+
+    if((pRing == MAP_FAILED) || (pEntries == MAP_FAILED))
+    {
+        if(pRing    != MAP_FAILED) munmap(pRing,    iRingSize);
+        if(pEntries != MAP_FAILED) munmap(pEntries, iEntrySize);
+        close(iDescriptor);
+        return false;
+    }
+
+    coreByte* pBase = s_cast<coreByte*>(pRing);
+
+    // prepare ring state
+    m_pRing = new coreRing();
+    m_pRing->iDescriptor    = iDescriptor;
+    m_pRing->pRing          = pBase;
+    m_pRing->pEntries       = s_cast<io_uring_sqe*>(pEntries);
+    m_pRing->iRingSize      = iRingSize;
+    m_pRing->iEntrySize     = iEntrySize;
+    m_pRing->piSubmitTail   = r_cast<coreUint32*>  (pBase + oParams.sq_off.tail);
+    m_pRing->piSubmitArray  = r_cast<coreUint32*>  (pBase + oParams.sq_off.array);
+    m_pRing->iSubmitMask    = *r_cast<coreUint32*> (pBase + oParams.sq_off.ring_mask);
+    m_pRing->piCompleteHead = r_cast<coreUint32*>  (pBase + oParams.cq_off.head);
+    m_pRing->piCompleteTail = r_cast<coreUint32*>  (pBase + oParams.cq_off.tail);
+    m_pRing->pCompletions   = r_cast<io_uring_cqe*>(pBase + oParams.cq_off.cqes);
+    m_pRing->iCompleteMask  = *r_cast<coreUint32*> (pBase + oParams.cq_off.ring_mask);
+    m_pRing->iCapacity      = oParams.sq_entries;
+    m_pRing->iInRing        = 0u;
+    m_pRing->iQueued        = 0u;
+
+    return true;
+
+#else
+
+    return false;
+
+#endif
+}
+
+
+// ****************************************************************
+/* delete io_uring instance */
+void coreReadQueue::__RingExit()
+{
+#if defined(CORE_READQUEUE_URING)
+
+    if(!m_pRing) return;
+    ASSERT(!m_pRing->iInRing)
+
+    // unmap rings and close descriptor
+    munmap(m_pRing->pEntries, m_pRing->iEntrySize);
+    munmap(m_pRing->pRing,    m_pRing->iRingSize);
+    close(m_pRing->iDescriptor);
+
+    SAFE_DELETE(m_pRing)
+
+#endif
+}
+
+
+// ****************************************************************
+/* submit queued reads as one batch */
+void coreReadQueue::__RingSubmit()
+{
+#if defined(CORE_READQUEUE_URING)
+
+    coreRing* pRing = m_pRing;
+
+    // only written by us
+    coreUint32 iTail = *pRing->piSubmitTail;
+
+    // fill free submission entries
+    coreUintW iNum = 0u;
+    while((iNum < m_apPending.size()) && (pRing->iInRing < pRing->iCapacity))
+    {
+        coreRequest* pRequest = m_apPending[iNum++];
+
+        // open file once (kept open for short reads)
+        if(pRequest->iFile < 0) pRequest->iFile = open(pRequest->sPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if(pRequest->iFile < 0)
+        {
+            pRequest->eStatus = CORE_ERROR_FILE;
+            m_apFinished.push_back(pRequest);
+            continue;
+        }
+
+        // prepare read operation (for remaining bytes)
+        const coreUint32 iIndex = iTail & pRing->iSubmitMask;
+        io_uring_sqe*    pEntry = &pRing->pEntries[iIndex];
+
+        std::memset(pEntry, 0, sizeof(io_uring_sqe));
+        pEntry->opcode    = IORING_OP_READ;
+        pEntry->fd        = pRequest->iFile;
+        pEntry->off       = pRequest->iOffset + pRequest->iDone;
+        pEntry->addr      = P_TO_UI(pRequest->pOutput + pRequest->iDone);
+        pEntry->len       = pRequest->iSize - pRequest->iDone;
+        pEntry->user_data = P_TO_UI(pRequest);
+
+        pRing->piSubmitArray[iIndex] = iIndex;
+
+        iTail          += 1u;
+        pRing->iInRing += 1u;
+        pRing->iQueued += 1u;
+    }
+    m_apPending.erase(m_apPending.begin(), m_apPending.begin() + iNum);
+
+    // publish new entries
+    __atomic_store_n(pRing->piSubmitTail, iTail, __ATOMIC_RELEASE);
+
+    // submit all entries with a single system call (retry next time on failure)
+    if(pRing->iQueued)
+    {
+        const coreIntW iResult = syscall(__NR_io_uring_enter, pRing->iDescriptor, pRing->iQueued, 0u, 0u, NULL, 0u);
+        if(iResult > 0) pRing->iQueued -= iResult;
+    }
+
+#endif
+}
+
+
+// ****************************************************************
+/* collect completed reads */
+void coreReadQueue::__RingReap(UNUSED const coreBool bWait)
+{
+#if defined(CORE_READQUEUE_URING)
+
+    coreRing* pRing = m_pRing;
+
+    // wait for at least one completion (only with submitted entries)
+    if(bWait && (pRing->iInRing > pRing->iQueued))
+    {
+        syscall(__NR_io_uring_enter, pRing->iDescriptor, 0u, 1u, IORING_ENTER_GETEVENTS, NULL, 0u);
+    }
+
+    coreUint32       iHead = *pRing->piCompleteHead;
+    const coreUint32 iTail = __atomic_load_n(pRing->piCompleteTail, __ATOMIC_ACQUIRE);
+
+    for(; iHead != iTail; ++iHead)
+    {
+        const io_uring_cqe* pCompletion = &pRing->pCompletions[iHead & pRing->iCompleteMask];
+
+        coreRequest*    pRequest = s_cast<coreRequest*>(I_TO_P(pCompletion->user_data));
+        const coreInt32 iResult  = pCompletion->res;
+
+        pRing->iInRing -= 1u;
+
+        if(iResult > 0)
+        {
+            pRequest->iDone += iResult;
+
+            // resubmit remaining bytes (short read)
+            if(pRequest->iDone < pRequest->iSize)
+            {
+                m_apPending.push_back(pRequest);
+                continue;
+            }
+
+            pRequest->eStatus = CORE_OK;
+        }
+        else if((iResult == -EAGAIN) || (iResult == -EINTR))
+        {
+            // resubmit interrupted read
+            m_apPending.push_back(pRequest);
+            continue;
+        }
+        else
+        {
+            // end of file or read error
+            pRequest->eStatus = CORE_ERROR_FILE;
+        }
+
+        // close file
+        close(pRequest->iFile);
+        pRequest->iFile = -1;
+
+        m_apFinished.push_back(pRequest);
+    }
+
+    // release completion entries
+    __atomic_store_n(pRing->piCompleteHead, iHead, __ATOMIC_RELEASE);
+
+#endif
+}
+
+
+// ****************************************************************
+/* read file data (blocking) */
+void coreReadQueue::__ReadRequest(coreRequest* OUTPUT pRequest)
+{
+    pRequest->eStatus = CORE_ERROR_FILE;
+
+    // open file
+    SDL_IOStream* pFile = SDL_IOFromFile(pRequest->sPath.c_str(), CORE_FILE_OPEN_READ);
+    if(pFile)
+    {
+        // read requested range
+        if(SDL_SeekIO(pFile, pRequest->iOffset, SDL_IO_SEEK_SET) == coreInt64(pRequest->iOffset))
+        {
+            while(pRequest->iDone < pRequest->iSize)
+            {
+                const coreUintW iRead = SDL_ReadIO(pFile, pRequest->pOutput + pRequest->iDone, pRequest->iSize - pRequest->iDone);
+                if(!iRead) break;
+
+                pRequest->iDone += iRead;
+            }
+
+            if(pRequest->iDone == pRequest->iSize) pRequest->eStatus = CORE_OK;
+        }
+
+        // close file
+        SDL_CloseIO(pFile);
+    }
+}
+
+
+// ****************************************************************
+/* read files until shutdown */
+coreInt32 SDLCALL coreReadQueue::__ReadThread(void* pData)
+{
+    coreReadQueue* pQueue = s_cast<coreReadQueue*>(pData);
+
+    while(true)
+    {
+        // wait for next request
+        SDL_WaitSemaphore(pQueue->m_pSemaphore);
+
+        coreRequest* pRequest = NULL;
+        coreBool     bShutdown;
+
+        pQueue->m_Lock.Lock();
+        {
+            if(pQueue->m_iPendingNext < pQueue->m_apPending.size())
+            {
+                // take oldest request
+                pRequest = pQueue->m_apPending[pQueue->m_iPendingNext++];
+
+                // restart list when all requests are taken
+                if(pQueue->m_iPendingNext == pQueue->m_apPending.size())
+                {
+                    pQueue->m_apPending.clear();
+                    pQueue->m_iPendingNext = 0u;
+                }
+            }
+            bShutdown = pQueue->m_bShutdown;
+        }
+        pQueue->m_Lock.Unlock();
+
+        if(!pRequest)
+        {
+            if(bShutdown) break;
+            continue;
+        }
+
+        // read file data
+        coreReadQueue::__ReadRequest(pRequest);
+
+        // return completed request
+        pQueue->m_Lock.Lock();
+        {
+            pQueue->m_apFinished.push_back(pRequest);
+        }
+        pQueue->m_Lock.Unlock();
+
+        // wake up waiting thread
+        SDL_SignalSemaphore(pQueue->m_pComplete);
+    }
+
+    return 0;
 }
\ No newline at end of file
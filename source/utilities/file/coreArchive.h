@@ -11,11 +11,9 @@
 #define _CORE_GUARD_ARCHIVE_H_
 
 // TODO 3: make archive a file
-// TODO 3: archive check sum (would need to read full file, maybe just for header, or check for correct size with offsets)
 // TODO 5: <old comment style>
 // TODO 4: get rid of Internal* functions ? but files should not be copied (normally)
-// TODO 3: add status-enum to file and store in archive: compressed, scrambled
-// TODO 2: when saving an archive fails late, file-state was already adjusted and cannot be recovered (archive-pos)
+// TODO 3: store scrambled-status in archive (next to compressed-flag)
 // TODO 3: get size from archive (sum up all files and headers, but paths have variable sizes)
 // TODO 3: allow caching a file-stream in an archive to make reading multiple files faster (thread-safety?) (stored in a manager?) (though many systems take a separate stream)
 
@@ -24,7 +22,15 @@
 /* file definitions */
 #define CORE_ARCHIVE_EXTENSION "cfa"                    // default file extension of core-archives
 #define CORE_ARCHIVE_MAGIC     (UINT_LITERAL("CFA0"))   // magic number of core-archives
-#define CORE_ARCHIVE_VERSION   (0x00000001u)            // current file version of core-archives
+#define CORE_ARCHIVE_VERSION   (0x00000002u)            // current file version of core-archives
+#define CORE_ARCHIVE_LEGACY    (0x00000001u)            // old file version of core-archives (still supported for loading)
+
+#define CORE_ARCHIVE_FLAG_COMPRESSED (0x01u)            // file data is compressed (with coreData::Compress)
+#define CORE_ARCHIVE_FLAG_DICTIONARY (0x02u)            // file data is compressed with the archive dictionary
+#define CORE_ARCHIVE_FLAG_INTERNAL   (0x04u)            // entry contains the archive dictionary (not a file)
+
+#define CORE_ARCHIVE_DICT_LIMIT   (0x00010000u)         // max file size for using (and training) the archive dictionary
+#define CORE_ARCHIVE_DICT_SAMPLES (8u)                  // min number of small files required to train the archive dictionary
 
 #define __CORE_FILE_TYPE_DIRECT (0u)
 #define __CORE_FILE_TYPE_MEMORY (1u)
@@ -41,9 +47,17 @@
 #endif
 
 #if !defined(_CORE_EMSCRIPTEN_) && !defined(_CORE_SWITCH_)
-    #define CORE_FILE_SAFEWRITE   // always write to temporary file first (to improve robustness)
+    #define CORE_FILE_SAFEWRITE     // always write to temporary file first (to improve robustness)
+    #define CORE_ARCHIVE_SHARED     // map whole archive into memory once and reference file data directly (instead of reading each file separately)
 #endif
 
+#if defined(_CORE_LINUX_) && !defined(_CORE_ANDROID_) && __has_include(<linux/io_uring.h>)
+    #define CORE_READQUEUE_URING    // submit reads in batches with io_uring (with fallback to reader threads, if not supported by the kernel)
+#endif
+
+#define CORE_READQUEUE_DEPTH   (64u)   // max number of reads in flight at the same time
+#define CORE_READQUEUE_THREADS (4u)    // number of reader threads (when io_uring is not available)
+
 
 // ****************************************************************
 /* file class */
@@ -56,11 +70,17 @@ private:
     coreUint32 m_iSize;                  // size of the file
 
     coreUint32   m_iArchivePos;          // absolute data position in the associated archive
+    coreUint32   m_iArchiveSize;         // compressed data size in the associated archive (0 = not compressed)
+    coreUint64   m_iChecksum;            // checksum of the data in the associated archive (0 = not available)
+    coreBool     m_bArchiveDict;         // data in the associated archive is compressed with its dictionary
     coreArchive* m_pArchive;             // associated archive
 
     coreBool m_bMapped;                  // current file data comes from memory mapping
+    coreBool m_bShared;                  // current file data comes from the shared archive mapping
     coreBool m_bExtern;                  // current file data is not owned and should not be deleted
 
+    mutable coreAtomic<coreBool> m_bVerified;   // stored data in the shared archive mapping was already verified
+
     coreAtomic<coreUint8> m_iRefCount;   // reference-counter to prevent early unloading
     coreLock              m_DataLock;    // lock to prevent concurrent loading and unloading
 
@@ -71,6 +91,7 @@ public:
     ~coreFile();
 
     FRIEND_CLASS(coreArchive)
+    FRIEND_CLASS(coreReadQueue)
     DISABLE_COPY(coreFile)
 
     /* save file */
@@ -89,8 +110,14 @@ public:
     coreStatus LoadData(const coreBool bMapped = false);
     coreStatus UnloadData();
 
+    /* load file data asynchronously (only uncompressed data not served by the shared archive mapping) */
+    coreStatus LoadDataAsync(coreReadQueue* OUTPUT pQueue, std::function<void()> nCallback);
+
+    /* hint upcoming data load (start readahead in the background) */
+    void Prefetch()const;
+
     /* edit file data directly */
-    inline coreByte* EditData() {this->LoadData(); ASSERT(!m_bMapped) return m_pData;}
+    inline coreByte* EditData() {this->LoadData(); this->__DetachData(); ASSERT(!m_bMapped) return m_pData;}
 
     /* handle concurrent file access */
     inline void Acquire() {m_iRefCount.FetchAdd(1u); ASSERT(m_iRefCount)}
@@ -110,6 +137,15 @@ public:
 
 
 private:
+    /* read file data from the associated archive */
+    coreStatus __ReadArchive  (coreByte* OUTPUT pOutput)const;
+    coreStatus __DecodeArchive(const coreByte* pStored, coreByte* OUTPUT pOutput)const;
+    coreStatus __VerifyArchive(const coreByte* pStored)const;
+    coreStatus __VerifyView   (const coreByte* pView)const;
+
+    /* copy file data out of the shared archive mapping */
+    void __DetachData();
+
     /* delete file data */
     void __DeleteData();
 
@@ -124,8 +160,57 @@ private:
 class coreArchive final
 {
 private:
-    coreString            m_sPath;    // relative path of the archive
-    coreMapStr<coreFile*> m_apFile;   // file objects
+    /* archive header structure */
+    struct coreHeader final
+    {
+        coreUint32 iMagic;        // magic number
+        coreUint32 iVersion;      // file version
+        coreUint32 iNumFiles;     // number of files
+        coreUint32 iBlockSize;    // size of the header block (entries and paths)
+        coreUint64 iChecksum;     // checksum of the header block (covers all file checksums)
+    };
+
+    /* stored file data structure */
+    struct coreStored final
+    {
+        coreByte*  pData;         // compressed data (NULL = stored uncompressed)
+        coreUint32 iSize;         // compressed data size
+        coreUint8  iFlags;        // additional file flags
+    };
+
+    /* parallel compression job structure */
+    struct coreCompressJob final
+    {
+        coreArchive*           pArchive;      // archive with the files to compress
+        coreInt32              iLevel;        // compression level (without dictionary)
+        const ZSTD_CDict*      pDictionary;   // compression dictionary (for small files, optional)
+        coreStored*            pOutput;       // stored file data (one per file, same order)
+        coreAtomic<coreUint32> iCurrent;      // next file to compress
+    };
+
+    /* file entry structure (sorted by path hash) */
+    struct coreEntry final
+    {
+        coreUint32 iHash;         // path hash (same as coreHashString)
+        coreUint32 iPosition;     // absolute data position
+        coreUint32 iSize;         // original data size
+        coreUint32 iStoredSize;   // stored data size (differs on compression)
+        coreUint64 iChecksum;     // checksum of the stored data
+        coreUint32 iPathOffset;   // position of the path in the path table
+        coreUint8  iPathLen;      // length of the path
+        coreUint8  iFlags;        // additional file flags
+        coreUint16 iPadding;      // (unused)
+    };
+
+
+private:
+    coreString            m_sPath;       // relative path of the archive
+    coreMapStr<coreFile*> m_apFile;      // file objects
+
+    ZSTD_DDict* m_pDictionary;           // decompression dictionary (shared by small compressed files)
+
+    coreFileMap m_Mapping;               // shared memory mapping of the whole archive (# lives as long as the archive, only unmapped on destruction or save, after all files were detached)
+    coreLock    m_MapLock;               // lock to prevent concurrent mapping and unmapping
 
 
 public:
@@ -133,10 +218,11 @@ public:
     explicit coreArchive(const coreChar* pcPath)noexcept;
     ~coreArchive();
 
+    FRIEND_CLASS(coreFile)
     DISABLE_COPY(coreArchive)
 
     /* save archive */
-    coreStatus Save(const coreChar* pcPath = NULL);
+    coreStatus Save(const coreChar* pcPath = NULL, const coreInt32 iLevel = 0, const coreUint32 iDictSize = 0u, const coreUintW iThreads = 0u);   // (0 = no compression, 0 = no dictionary, 0 = all cores)
 
     /* manage file objects */
     coreFile*  CreateFile(const coreHashString& sPath, coreByte* pData, const coreUint32 iSize, const coreBool bExtern = false);
@@ -157,8 +243,93 @@ public:
 
 
 private:
-    /* calculate absolute data positions of all files */
-    void __CalculatePositions();
+    /* read file headers */
+    coreBool __ReadHeaders      (SDL_IOStream* pArchive);
+    coreBool __ReadHeadersLegacy(SDL_IOStream* pArchive);
+
+    /* handle shared memory mapping */
+    const coreByte* __GetMapping   ();
+    void            __UnmapArchive ();
+
+    /* compress file data */
+    void __TrainDictionary(const coreUint32 iMaxSize, coreList<coreByte>* OUTPUT paOutput);
+    void __CompressFiles  (const coreInt32 iLevel, const coreList<coreByte>& aDictionary, const coreUintW iThreads, coreList<coreStored>* OUTPUT paOutput);
+    static void __CompressTask(coreCompressJob* pJob);
+};
+
+
+// ****************************************************************
+/* asynchronous read queue class */
+class coreReadQueue final
+{
+public:
+    /* read completion callback */
+    using coreReadCallback = std::function<void(const coreStatus eStatus, coreByte* pOutput, const coreUint32 iSize)>;   // (CORE_OK = all bytes read)
+
+
+private:
+    /* read request structure */
+    struct coreRequest final
+    {
+        coreString       sPath;       // path of the file to read from
+        coreUint64       iOffset;     // absolute read position
+        coreByte*        pOutput;     // target memory (has to stay valid until completion)
+        coreUint32       iSize;       // number of bytes to read
+        coreUint32       iDone;       // number of bytes already read
+        coreInt32        iFile;       // file descriptor (only with io_uring)
+        coreStatus       eStatus;     // final read status
+        coreReadCallback nCallback;   // completion callback (executed during update)
+    };
+
+    /* io_uring state structure (defined in source file) */
+    struct coreRing;
+
+
+private:
+    coreList<coreRequest*> m_apPending;    // requests waiting for submission (or for a reader thread)
+    coreUintW              m_iPendingNext; // next pending request for the reader threads
+    coreList<coreRequest*> m_apFinished;   // completed requests waiting for their callbacks
+    coreUintW              m_iActive;      // number of unfinished requests (from submission until callback)
+
+    coreRing*             m_pRing;         // io_uring state (NULL = not available)
+    coreList<SDL_Thread*> m_apThread;      // reader threads (fallback, empty = read synchronously during update)
+    SDL_Semaphore*        m_pSemaphore;    // signal for each request available to the reader threads
+    SDL_Semaphore*        m_pComplete;     // signal for each request completed by the reader threads (to block while waiting)
+    coreBool              m_bShutdown;     // reader threads should terminate
+    coreLock              m_Lock;          // lock to share requests with the reader threads
+
+
+public:
+    coreReadQueue()noexcept;
+    ~coreReadQueue();
+
+    DISABLE_COPY(coreReadQueue)
+
+    /* queue file read (submitted as batch with the next update at the latest) */
+    void Submit(const coreChar* pcPath, const coreUint64 iOffset, coreByte* OUTPUT pOutput, const coreUint32 iSize, coreReadCallback nCallback);
+    void Submit(const coreFile* pFile,                            coreByte* OUTPUT pOutput,                          coreReadCallback nCallback);   // (only uncompressed data)
+
+    /* submit queued reads and execute callbacks of completed reads */
+    coreUintW Update();
+    void      Wait();
+
+    /* check for unfinished reads */
+    inline coreBool IsBusy()const {return (m_iActive != 0u);}
+
+    /* check for asynchronous backend (otherwise reads are executed during update) */
+    inline coreBool IsAsync()const {return (m_pRing || !m_apThread.empty());}
+
+
+private:
+    /* handle io_uring backend */
+    coreBool __RingInit();
+    void     __RingExit();
+    void     __RingSubmit();
+    void     __RingReap(const coreBool bWait);
+
+    /* handle reader threads */
+    static void __ReadRequest(coreRequest* OUTPUT pRequest);
+    static coreInt32 SDLCALL __ReadThread(void* pData);
 };
 
 
@@ -56,7 +56,7 @@ void coreTranslate::RefreshLanguage()
     if(m_pLanguage)
     {
         // refresh everything in current language
-        FOR_EACH(it, m_apsPointer) m_pLanguage->RefreshForeign(*m_apsPointer.get_key(it), it->c_str());
+        FOR_EACH(it, m_apsPointer) m_pLanguage->RefreshForeign(*m_apsPointer.get_key(it), *it);
 
         // invoke object update
         this->__UpdateTranslate();
@@ -71,7 +71,7 @@ void coreTranslate::_BindString(coreString* psString, const coreHashString& sKey
     ASSERT(psString && sKey)
 
     // check current pointer
-    if((m_apsPointer[psString] == sKey.GetString()) && !nFunc) return;
+    if((m_apsPointer[psString].GetID() == coreInternString(sKey).GetID()) && !nFunc) return;
 
     if(!m_pLanguage)
     {
@@ -82,7 +82,7 @@ void coreTranslate::_BindString(coreString* psString, const coreHashString& sKey
 
     // bind string to language and save it internally
     m_pLanguage->BindForeign(psString, sKey, std::move(nFunc));
-    m_apsPointer.at(psString) = sKey.GetString();
+    m_apsPointer.at(psString) = sKey;
 
     // invoke object update
     this->__UpdateTranslate();
@@ -124,7 +124,7 @@ void coreTranslate::__ChangeLanguage(coreLanguage* pLanguage, const coreBool bUp
     {
         // bind everything to new language
         m_pLanguage->__BindObject(this);
-        FOR_EACH(it, m_apsPointer) m_pLanguage->BindForeign(*m_apsPointer.get_key(it), it->c_str());
+        FOR_EACH(it, m_apsPointer) m_pLanguage->BindForeign(*m_apsPointer.get_key(it), *it);
 
         // invoke object update
         if(bUpdate) this->__UpdateTranslate();   // # virtual function
@@ -234,7 +234,7 @@ coreStatus coreLanguage::Load(const coreChar* pcPath)
     m_asStringList.shrink_to_fit();
 
     // update all foreign strings and objects
-    FOR_EACH(it, m_asForeign)  (*m_asForeign.get_key(it))->assign(m_asStringList.at_bs(it->c_str()));
+    FOR_EACH(it, m_asForeign)  (*m_asForeign.get_key(it))->assign(m_asStringList.at_bs(*it));
     FOR_EACH(it, m_anAssemble) (*it)(*m_anAssemble.get_key(it), *this);
     FOR_EACH(it, m_apObject)   (*it)->__UpdateTranslate();
 
@@ -253,7 +253,7 @@ void coreLanguage::BindForeign(coreString* psForeign, const coreHashString& sKey
     if(!m_asStringList.count_bs(sKey)) m_asStringList.emplace_bs(sKey, PRINT(CORE_LANGUAGE_KEY "%s", sKey.GetString()));
 
     // save foreign string pointer and key
-    m_asForeign.bs(psForeign).assign(sKey.GetString());
+    m_asForeign.bs(psForeign) = sKey;
 
     // save possible assemble function
     if(nFunc) m_anAssemble.bs(psForeign) = std::move(nFunc);
@@ -47,8 +47,8 @@ using coreAssembleFunc = std::function<void(coreString* OUTPUT, const coreLangua
 class INTERFACE coreTranslate
 {
 private:
-    coreLanguage* m_pLanguage;                       // associated language file
-    coreMap<coreString*, coreString> m_apsPointer;   // own string pointers connected with keys <own, key>
+    coreLanguage*                          m_pLanguage;    // associated language file
+    coreMap<coreString*, coreInternString> m_apsPointer;   // own string pointers connected with keys <own, key>
 
 
 protected:
@@ -93,7 +93,7 @@ class coreLanguage final
 private:
     coreMapStrFull<coreString> m_asStringList;             // list with language-strings to specific keys
 
-    coreMap<coreString*, coreString>       m_asForeign;    // foreign string pointers connected with keys <foreign, key>
+    coreMap<coreString*, coreInternString> m_asForeign;    // foreign string pointers connected with keys <foreign, key>
     coreMap<coreString*, coreAssembleFunc> m_anAssemble;   // possible assemble functions (to allow complex text construction)
     coreSet<coreTranslate*>                m_apObject;     // objects to update after modification
 
@@ -1018,4 +1018,57 @@ inline void coreMath::DisableDenormals()
 }
 
 
+
+// ****************************************************************
+/* 4-wide float lane (for small SIMD kernels with scalar fallback) */
+#if defined(_CORE_SSE_)
+
+    using coreLane = __m128;
+
+    FORCE_INLINE coreLane   coreLaneLoad     (const coreFloat* pfData)            {return _mm_load_ps(pfData);}
+    FORCE_INLINE void       coreLaneStore    (coreFloat* OUTPUT pfData, const coreLane A) {_mm_store_ps(pfData, A);}
+    FORCE_INLINE coreLane   coreLaneSet      (const coreFloat fValue)             {return _mm_set1_ps(fValue);}
+    FORCE_INLINE coreLane   coreLaneAdd      (const coreLane A, const coreLane B) {return _mm_add_ps(A, B);}
+    FORCE_INLINE coreLane   coreLaneSub      (const coreLane A, const coreLane B) {return _mm_sub_ps(A, B);}
+    FORCE_INLINE coreLane   coreLaneMul      (const coreLane A, const coreLane B) {return _mm_mul_ps(A, B);}
+    FORCE_INLINE coreLane   coreLaneMin      (const coreLane A, const coreLane B) {return _mm_min_ps(A, B);}
+    FORCE_INLINE coreLane   coreLaneMax      (const coreLane A, const coreLane B) {return _mm_max_ps(A, B);}
+    FORCE_INLINE coreLane   coreLaneAbs      (const coreLane A)                   {return _mm_andnot_ps(_mm_set1_ps(-0.0f), A);}
+    FORCE_INLINE coreUint32 coreLaneLessEqual(const coreLane A, const coreLane B) {return _mm_movemask_ps(_mm_cmple_ps(A, B));}
+
+#elif defined(_CORE_NEON_)
+
+    using coreLane = float32x4_t;
+
+    FORCE_INLINE coreLane   coreLaneLoad     (const coreFloat* pfData)            {return vld1q_f32(pfData);}
+    FORCE_INLINE void       coreLaneStore    (coreFloat* OUTPUT pfData, const coreLane A) {vst1q_f32(pfData, A);}
+    FORCE_INLINE coreLane   coreLaneSet      (const coreFloat fValue)             {return vdupq_n_f32(fValue);}
+    FORCE_INLINE coreLane   coreLaneAdd      (const coreLane A, const coreLane B) {return vaddq_f32(A, B);}
+    FORCE_INLINE coreLane   coreLaneSub      (const coreLane A, const coreLane B) {return vsubq_f32(A, B);}
+    FORCE_INLINE coreLane   coreLaneMul      (const coreLane A, const coreLane B) {return vmulq_f32(A, B);}
+    FORCE_INLINE coreLane   coreLaneMin      (const coreLane A, const coreLane B) {return vminq_f32(A, B);}
+    FORCE_INLINE coreLane   coreLaneMax      (const coreLane A, const coreLane B) {return vmaxq_f32(A, B);}
+    FORCE_INLINE coreLane   coreLaneAbs      (const coreLane A)                   {return vabsq_f32(A);}
+    FORCE_INLINE coreUint32 coreLaneLessEqual(const coreLane A, const coreLane B) {const uint32x4_t vBit = {1u, 2u, 4u, 8u}; return vaddvq_u32(vandq_u32(vcleq_f32(A, B), vBit));}
+
+#else
+
+    struct coreLane final {coreFloat v[4];};
+
+    template <typename F> FORCE_INLINE coreLane coreLaneProcess(F&& nFunction) {coreLane C; for(coreUintW i = 0u; i < 4u; ++i) C.v[i] = nFunction(i); return C;}
+
+    FORCE_INLINE coreLane   coreLaneLoad     (const coreFloat* pfData)            {return coreLaneProcess([&](const coreUintW i) {return pfData[i];});}
+    FORCE_INLINE void       coreLaneStore    (coreFloat* OUTPUT pfData, const coreLane A) {std::memcpy(pfData, A.v, sizeof(A.v));}
+    FORCE_INLINE coreLane   coreLaneSet      (const coreFloat fValue)             {return coreLaneProcess([&](const coreUintW)   {return fValue;});}
+    FORCE_INLINE coreLane   coreLaneAdd      (const coreLane A, const coreLane B) {return coreLaneProcess([&](const coreUintW i) {return A.v[i] + B.v[i];});}
+    FORCE_INLINE coreLane   coreLaneSub      (const coreLane A, const coreLane B) {return coreLaneProcess([&](const coreUintW i) {return A.v[i] - B.v[i];});}
+    FORCE_INLINE coreLane   coreLaneMul      (const coreLane A, const coreLane B) {return coreLaneProcess([&](const coreUintW i) {return A.v[i] * B.v[i];});}
+    FORCE_INLINE coreLane   coreLaneMin      (const coreLane A, const coreLane B) {return coreLaneProcess([&](const coreUintW i) {return MIN(A.v[i], B.v[i]);});}
+    FORCE_INLINE coreLane   coreLaneMax      (const coreLane A, const coreLane B) {return coreLaneProcess([&](const coreUintW i) {return MAX(A.v[i], B.v[i]);});}
+    FORCE_INLINE coreLane   coreLaneAbs      (const coreLane A)                   {return coreLaneProcess([&](const coreUintW i) {return ABS(A.v[i]);});}
+    FORCE_INLINE coreUint32 coreLaneLessEqual(const coreLane A, const coreLane B) {coreUint32 iMask = 0u; for(coreUintW i = 0u; i < 4u; ++i) if(A.v[i] <= B.v[i]) ADD_BIT(iMask, i) return iMask;}
+
+#endif
+
+
 #endif /* _CORE_GUARD_MATH_H_ */
\ No newline at end of file